@@ -31,6 +31,273 @@ bool ledFlashEnabled = false;    // LED flash toggle - default OFF
 uint32_t lastCaptureTime = 0;    // Timestamp tracking for adaptive timing
 int consecutiveFailures = 0;     // Track failures to adapt capture timing
 
+// ===========================
+// Burst Capture (PSRAM ring)
+// ===========================
+// Rapid sequences (head turns, expression changes) were lost because each
+// /capture round-trip stalls on the SD write. Burst mode grabs frames
+// back-to-back into copies in PSRAM (the boards have 4 MB), then loop()
+// drains the ring to SD in the background - so the next burst can start
+// while the previous batch is still being written out.
+// (BURST_RING_SLOTS / BURST_DEFAULT_COUNT come from web_server.h.)
+struct BurstSlot {
+    uint8_t* buf;
+    size_t len;
+    size_t width;
+    size_t height;
+    pixformat_t format;
+};
+
+static BurstSlot burstRing[BURST_RING_SLOTS];
+static volatile int burstHead = 0;   // Next slot to fill (producer: HTTP handler)
+static volatile int burstTail = 0;   // Next slot to save (consumer: loop)
+bool burstAvailable = false;         // Set in setup() when PSRAM is present
+
+int burstPendingCount() {
+    return (burstHead - burstTail + BURST_RING_SLOTS) % BURST_RING_SLOTS;
+}
+
+// Capture up to `count` frames back-to-back into the PSRAM ring.
+// No SD I/O happens here - that is the whole point. Returns the
+// number of frames actually buffered.
+int burstCaptureFrames(int count) {
+    if(!burstAvailable) return 0;
+
+    int captured = 0;
+    for(int i = 0; i < count; i++) {
+        // Leave one slot free so head==tail always means "empty"
+        if(burstPendingCount() >= BURST_RING_SLOTS - 1) {
+            Serial.println("[BURST] Ring full, stopping early");
+            break;
+        }
+
+        camera_fb_t* fb = esp_camera_fb_get();
+        if(!fb) {
+            Serial.println("[BURST] Capture failed, stopping early");
+            break;
+        }
+
+        uint8_t* copy = (uint8_t*)ps_malloc(fb->len);
+        if(!copy) {
+            Serial.println("[BURST] PSRAM allocation failed, stopping early");
+            esp_camera_fb_return(fb);
+            break;
+        }
+        memcpy(copy, fb->buf, fb->len);
+
+        BurstSlot* slot = &burstRing[burstHead];
+        slot->buf = copy;
+        slot->len = fb->len;
+        slot->width = fb->width;
+        slot->height = fb->height;
+        slot->format = fb->format;
+        esp_camera_fb_return(fb);
+
+        burstHead = (burstHead + 1) % BURST_RING_SLOTS;
+        captured++;
+    }
+    return captured;
+}
+
+// Save the oldest buffered frame to SD and free its PSRAM copy.
+// Called from loop() so HTTP handlers never block on the SD card.
+void burstDrainOne() {
+    if(burstHead == burstTail) return;
+
+    BurstSlot* slot = &burstRing[burstTail];
+
+    // Wrap the stored copy in a frame-buffer struct so saveImage()
+    // works unchanged for both burst and single captures.
+    camera_fb_t fb = {};
+    fb.buf = slot->buf;
+    fb.len = slot->len;
+    fb.width = slot->width;
+    fb.height = slot->height;
+    fb.format = slot->format;
+
+    if(sdCardAvailable && currentPerson != "") {
+        imageCounter++;
+        saveImage(&fb, currentPerson, imageCounter);
+    }
+
+    free(slot->buf);
+    slot->buf = nullptr;
+    burstTail = (burstTail + 1) % BURST_RING_SLOTS;
+}
+
+// ===========================
+// Dataset Writer (SD double-buffered)
+// ===========================
+// The HTTP upload path is network-bound (~2 FPS on hotel WiFi). Writer
+// mode keeps frames on the card instead: loop() captures back-to-back
+// and appends framed records into one of two PSRAM buffers while a
+// writer task flushes the other to a pre-allocated segment file. The
+// capture side never waits on the card, and the card only ever sees
+// large sequential writes into clusters that were allocated up front -
+// no per-frame file creation, no FAT chatter. Segments come off the
+// rig in one go through /export.
+// Record layout: "FRM0", u32 len, u16 width, u16 height, u16 format,
+// then len payload bytes. A desktop script splits segments offline and
+// stops at the first bad magic (the pre-allocated tail is unused).
+// (DSW_BUFFER_BYTES / DSW_SEGMENT_BYTES come from web_server.h.)
+
+struct DswRecordHeader {
+    char magic[4];
+    uint32_t len;
+    uint16_t width;
+    uint16_t height;
+    uint16_t format;
+} __attribute__((packed));
+
+static uint8_t* dswBuf[2] = {nullptr, nullptr};
+static size_t dswFill[2] = {0, 0};
+static volatile bool dswFull[2] = {false, false};  // Handed to the writer task
+static int dswFillIdx = 0;
+
+bool dswActive = false;
+String dswPerson = "";
+uint32_t dswFrames = 0;
+uint32_t dswDropped = 0;
+uint32_t dswStartMs = 0;
+static int dswSegmentIdx = 0;
+static size_t dswSegmentBytes = 0;
+static File dswSegment;
+static TaskHandle_t dswTaskHandle = nullptr;
+
+static bool dswOpenSegment() {
+    String path = "/dataset/" + dswPerson + "/seg_" + String(dswSegmentIdx) + ".bin";
+    dswSegment = SD_MMC.open(path, FILE_WRITE);
+    if(!dswSegment) {
+        Serial.println("[DSW] Failed to open " + path);
+        return false;
+    }
+
+    // Pre-allocate the clusters once (seek to the end, write a byte)
+    // so the appends below never grow the file or touch the FAT
+    if(dswSegment.seek(DSW_SEGMENT_BYTES - 1)) {
+        uint8_t zero = 0;
+        dswSegment.write(&zero, 1);
+    }
+    dswSegment.seek(0);
+    dswSegmentBytes = 0;
+    Serial.println("[DSW] Segment: " + path);
+    return true;
+}
+
+// Flushes whichever buffer the capture side has handed over. At most
+// one buffer awaits writing while the other fills, so scan order
+// cannot reorder frames.
+static void dswWriterTask(void* arg) {
+    while(true) {
+        bool flushed = false;
+        for(int i = 0; i < 2; i++) {
+            if(!dswFull[i]) continue;
+
+            if(dswSegment && dswSegmentBytes + dswFill[i] > DSW_SEGMENT_BYTES) {
+                dswSegment.close();
+                dswSegmentIdx++;
+                dswOpenSegment();
+            }
+            if(dswSegment) {
+                dswSegment.write(dswBuf[i], dswFill[i]);
+                dswSegmentBytes += dswFill[i];
+            }
+            dswFill[i] = 0;
+            dswFull[i] = false;
+            flushed = true;
+        }
+        if(!flushed) {
+            vTaskDelay(pdMS_TO_TICKS(2));
+        }
+    }
+}
+
+// Append one frame to the filling buffer; swaps buffers when full.
+// Drops the frame (rather than stalling capture) if the card cannot
+// keep up and both buffers are busy.
+static bool dswAppendFrame(camera_fb_t* fb) {
+    size_t need = sizeof(DswRecordHeader) + fb->len;
+    if(need > DSW_BUFFER_BYTES) return false;
+
+    if(dswFill[dswFillIdx] + need > DSW_BUFFER_BYTES) {
+        dswFull[dswFillIdx] = true;  // Hand it to the writer task
+        int next = dswFillIdx ^ 1;
+        if(dswFull[next]) {
+            dswDropped++;
+            return false;
+        }
+        dswFillIdx = next;
+    }
+
+    uint8_t* dst = dswBuf[dswFillIdx] + dswFill[dswFillIdx];
+    DswRecordHeader hdr;
+    memcpy(hdr.magic, "FRM0", 4);
+    hdr.len = fb->len;
+    hdr.width = fb->width;
+    hdr.height = fb->height;
+    hdr.format = (uint16_t)fb->format;
+    memcpy(dst, &hdr, sizeof(hdr));
+    memcpy(dst + sizeof(hdr), fb->buf, fb->len);
+    dswFill[dswFillIdx] += need;
+    return true;
+}
+
+bool dswStart(String person) {
+    if(dswActive || !sdCardAvailable || person == "") return false;
+
+    for(int i = 0; i < 2; i++) {
+        if(!dswBuf[i]) dswBuf[i] = (uint8_t*)ps_malloc(DSW_BUFFER_BYTES);
+        if(!dswBuf[i]) {
+            Serial.println("[DSW] PSRAM buffer allocation failed");
+            return false;
+        }
+        dswFill[i] = 0;
+        dswFull[i] = false;
+    }
+
+    dswPerson = person;
+    createPersonDirectory(person);
+
+    // Continue after existing segments so restarts never overwrite
+    dswSegmentIdx = 0;
+    while(SD_MMC.exists("/dataset/" + person + "/seg_" + String(dswSegmentIdx) + ".bin")) {
+        dswSegmentIdx++;
+    }
+    if(!dswOpenSegment()) return false;
+
+    if(!dswTaskHandle) {
+        xTaskCreatePinnedToCore(dswWriterTask, "DswWriter", 4096, nullptr, 1,
+                                &dswTaskHandle, 0);
+    }
+
+    dswFillIdx = 0;
+    dswFrames = 0;
+    dswDropped = 0;
+    dswStartMs = millis();
+    dswActive = true;
+    Serial.println("[DSW] Writer started for " + person);
+    return true;
+}
+
+void dswStop() {
+    if(!dswActive) return;
+    dswActive = false;
+
+    // Push the partial buffer through the writer, then wait it out
+    if(dswFill[dswFillIdx] > 0) {
+        dswFull[dswFillIdx] = true;
+    }
+    while(dswFull[0] || dswFull[1]) {
+        delay(5);
+    }
+    if(dswSegment) dswSegment.close();
+
+    uint32_t elapsed = millis() - dswStartMs;
+    Serial.printf("[DSW] Stopped: %u frames, %u dropped, %u ms (%.1f FPS)\n",
+                  dswFrames, dswDropped, elapsed,
+                  elapsed ? (dswFrames * 1000.0f / elapsed) : 0.0f);
+}
+
 // ===========================
 // SD Card Functions
 // ===========================
@@ -135,6 +402,16 @@ void setup() {
     }
     Serial.println("✓ Camera initialized successfully");
     Serial.println();
+
+    // 1b. Check PSRAM for burst capture
+    if(psramFound()) {
+        burstAvailable = true;
+        Serial.printf("✓ PSRAM found (%u bytes) - burst capture enabled\n",
+                      ESP.getPsramSize());
+    } else {
+        Serial.println("✗ No PSRAM - burst capture disabled");
+    }
+    Serial.println();
     
     // 2. Setup LED Flash
 #if defined(LED_GPIO_NUM)
@@ -219,5 +496,24 @@ void setup() {
 // Loop
 // ===========================
 void loop() {
-    delay(10);  // Continuous capture now handled via HTTP /capture calls
+    // Dataset writer mode: capture back-to-back, camera-bound. The
+    // writer task owns all SD I/O, so this loop never blocks on it.
+    if(dswActive) {
+        camera_fb_t* fb = esp_camera_fb_get();
+        if(fb) {
+            if(dswAppendFrame(fb)) {
+                dswFrames++;
+            }
+            esp_camera_fb_return(fb);
+        }
+        return;
+    }
+
+    // Drain any burst frames buffered in PSRAM out to the SD card.
+    // One frame per iteration keeps the HTTP server responsive.
+    if(burstPendingCount() > 0) {
+        burstDrainOne();
+        return;
+    }
+    delay(10);  // Single captures handled via HTTP /capture calls
 }
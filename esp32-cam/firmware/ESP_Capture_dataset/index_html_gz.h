@@ -0,0 +1,343 @@
+// index_html_gz.h - gzip-compressed web interface (generated file)
+//
+// Source: index.html in this directory. Regenerate after editing it:
+//     python3 make_index_gz.py
+//
+// The page is served straight from flash with Content-Encoding: gzip
+// and a strong ETag, so browsers get a 304 on reload instead of the
+// full ~23 KB page (5144 bytes compressed).
+#ifndef INDEX_HTML_GZ_H
+#define INDEX_HTML_GZ_H
+
+#include <pgmspace.h>
+
+#define INDEX_HTML_ETAG "6a56b781-1418"
+
+const size_t index_html_gz_len = 5144;
+
+const uint8_t index_html_gz[] PROGMEM = {
+    0x1f, 0x8b, 0x08, 0x00, 0x00, 0x00, 0x00, 0x00, 0x02, 0x03, 0xd5, 0x5c, 0xeb, 0x76, 0xdb, 0xc8,
+    0x91, 0xfe, 0xef, 0xa7, 0x68, 0xd3, 0x33, 0x03, 0x32, 0x16, 0x49, 0x50, 0x12, 0x65, 0x59, 0x14,
+    0xe5, 0xb5, 0x65, 0x3b, 0xe3, 0x3d, 0x9e, 0xcb, 0x8e, 0xec, 0x9c, 0xcd, 0x7a, 0x67, 0x13, 0x10,
+    0x68, 0x90, 0x18, 0x83, 0x00, 0x83, 0x8b, 0x64, 0xc5, 0xd1, 0x1b, 0xec, 0x9f, 0x64, 0x7e, 0xe4,
+    0x4f, 0xce, 0x99, 0xb3, 0x6f, 0x91, 0xe7, 0xc9, 0x13, 0xcc, 0x23, 0xa4, 0xaa, 0xbb, 0x71, 0x6b,
+    0x74, 0x03, 0x20, 0x25, 0xcf, 0xee, 0x6a, 0xce, 0x58, 0x20, 0xd0, 0xa8, 0xae, 0xaa, 0xae, 0xcb,
+    0x57, 0xd5, 0x4d, 0x9d, 0xde, 0x7f, 0xfe, 0xcd, 0xf9, 0x9b, 0xdf, 0x7e, 0xfb, 0x82, 0xac, 0x92,
+    0xb5, 0x7f, 0x76, 0xef, 0x34, 0xfb, 0x45, 0x2d, 0xe7, 0xec, 0x1e, 0x81, 0x9f, 0xd3, 0xc4, 0x4b,
+    0x7c, 0x7a, 0xf6, 0xe2, 0xe2, 0xdb, 0x83, 0xfd, 0xe1, 0xf9, 0xd3, 0xaf, 0xc8, 0x73, 0x2b, 0xb1,
+    0x62, 0x9a, 0x90, 0x73, 0x6b, 0x93, 0xa4, 0x11, 0x3d, 0x1d, 0xf3, 0x01, 0x7c, 0xf0, 0x9a, 0x26,
+    0x16, 0x09, 0xac, 0x35, 0x9d, 0xf7, 0x2e, 0x3d, 0x7a, 0xb5, 0x09, 0xa3, 0xa4, 0x47, 0xec, 0x30,
+    0x48, 0x68, 0x90, 0xcc, 0x7b, 0x57, 0x9e, 0x93, 0xac, 0xe6, 0x0e, 0xbd, 0xf4, 0x6c, 0x3a, 0x64,
+    0x1f, 0xf6, 0x88, 0x17, 0x78, 0x89, 0x67, 0xf9, 0xc3, 0xd8, 0xb6, 0x7c, 0x3a, 0x9f, 0xf4, 0x04,
+    0xa1, 0x38, 0xb9, 0xce, 0x88, 0xe2, 0xcf, 0xaf, 0xc8, 0x47, 0xb2, 0xb6, 0xa2, 0xa5, 0x17, 0x9c,
+    0x10, 0x73, 0x46, 0x36, 0x96, 0xe3, 0x78, 0xc1, 0x92, 0x5d, 0x2f, 0xc2, 0x0f, 0xc3, 0xd8, 0xfb,
+    0x23, 0xfb, 0xb8, 0x08, 0x23, 0x87, 0x46, 0x43, 0xb8, 0x35, 0x23, 0x37, 0xf9, 0xcb, 0x8b, 0xd0,
+    0xb9, 0x26, 0x1f, 0xf3, 0x8f, 0xf8, 0xe3, 0x02, 0x4b, 0x43, 0xd7, 0x5a, 0x7b, 0xfe, 0xf5, 0x09,
+    0x79, 0x1a, 0x01, 0x03, 0x7b, 0x24, 0xb6, 0x82, 0x78, 0x18, 0xd3, 0xc8, 0x73, 0x67, 0x95, 0xb1,
+    0x0b, 0xcb, 0x7e, 0xbf, 0x8c, 0xc2, 0x34, 0x70, 0x4e, 0x88, 0xef, 0x05, 0xd4, 0x8a, 0x86, 0xcb,
+    0xc8, 0x72, 0x3c, 0x10, 0xa9, 0x3f, 0x39, 0x98, 0x3a, 0x74, 0xb9, 0x47, 0x1e, 0x1c, 0x1d, 0x3d,
+    0xa2, 0xd4, 0x22, 0xe6, 0xe7, 0x70, 0xfd, 0xe8, 0xe8, 0x70, 0x61, 0xed, 0x93, 0x89, 0x69, 0x7e,
+    0x3e, 0xa8, 0x92, 0x5a, 0x7b, 0xc1, 0x70, 0x45, 0xbd, 0xe5, 0x2a, 0x39, 0xc1, 0xc7, 0x97, 0xab,
+    0xea, 0xe3, 0x5c, 0xac, 0x7d, 0x73, 0xf3, 0xa1, 0x78, 0x54, 0x48, 0x32, 0x42, 0x55, 0x5a, 0xc0,
+    0x43, 0x24, 0xc9, 0xb3, 0xb6, 0x3e, 0x70, 0x85, 0x9e, 0x90, 0x63, 0xb3, 0xf2, 0x32, 0x7f, 0x2a,
+    0x34, 0x47, 0xac, 0x34, 0x09, 0xf5, 0xd2, 0x5d, 0xad, 0xbc, 0x84, 0x4a, 0x8f, 0xb9, 0x46, 0x51,
+    0xde, 0x34, 0x96, 0x19, 0xe3, 0x03, 0x40, 0xfd, 0x2b, 0xcb, 0x09, 0xaf, 0x90, 0x3e, 0x3e, 0x27,
+    0x47, 0xf8, 0x4f, 0xb4, 0x5c, 0x58, 0x7d, 0x73, 0x8f, 0xfd, 0x37, 0x3a, 0x18, 0x68, 0x04, 0x3d,
+    0xd0, 0x08, 0xba, 0x9a, 0x48, 0x02, 0xda, 0xa1, 0x1f, 0x46, 0x27, 0x99, 0x9e, 0xab, 0xd4, 0x12,
+    0xfa, 0x21, 0x19, 0x5a, 0xbe, 0xb7, 0x04, 0x11, 0x6d, 0x58, 0x15, 0x1a, 0xa9, 0xc4, 0x07, 0xab,
+    0x48, 0x92, 0x70, 0x8d, 0x8a, 0x97, 0x65, 0x60, 0xd6, 0x00, 0x36, 0x44, 0x41, 0xc0, 0x63, 0x8d,
+    0xe6, 0xe3, 0x74, 0xc1, 0x0c, 0x5d, 0xe2, 0xab, 0x6d, 0xee, 0x82, 0xef, 0xa3, 0x46, 0xa6, 0x0e,
+    0x9a, 0x98, 0x9a, 0x1c, 0xea, 0x98, 0xa2, 0x41, 0x1c, 0x82, 0xbd, 0x5b, 0xce, 0x52, 0x66, 0xac,
+    0xbc, 0xae, 0x4a, 0xad, 0x09, 0xce, 0x14, 0x6b, 0x9e, 0xaf, 0x0e, 0xe8, 0x82, 0x4c, 0x8e, 0xea,
+    0x2b, 0xde, 0x62, 0x12, 0x65, 0xce, 0xf7, 0xe5, 0x87, 0x8e, 0x17, 0x6f, 0x7c, 0x0b, 0xbc, 0xce,
+    0x0b, 0xd0, 0x99, 0x86, 0x0b, 0x3f, 0xb4, 0xdf, 0x37, 0xaa, 0x46, 0xeb, 0x0c, 0x71, 0x62, 0x25,
+    0x69, 0xdc, 0x24, 0xb7, 0x6b, 0xe2, 0x7f, 0x1a, 0xe9, 0x26, 0xd3, 0x16, 0xc9, 0x26, 0x1a, 0x47,
+    0xd2, 0x70, 0xd6, 0x66, 0x0e, 0x35, 0xce, 0x87, 0xa0, 0xf9, 0xb5, 0xc4, 0x7e, 0x67, 0xf5, 0xa0,
+    0xb7, 0xd5, 0x25, 0xe8, 0x64, 0x34, 0x7c, 0x72, 0xdf, 0x5a, 0x50, 0x5f, 0x15, 0x16, 0xaf, 0x44,
+    0x80, 0x5a, 0x84, 0xbe, 0x33, 0xeb, 0xe4, 0x84, 0x25, 0xe2, 0x5e, 0xb0, 0x49, 0x93, 0x21, 0x2e,
+    0xc0, 0xa6, 0x16, 0xa2, 0x3a, 0xad, 0xaa, 0x8a, 0xad, 0x5c, 0x29, 0xed, 0xc6, 0x72, 0x2c, 0x6b,
+    0x24, 0xe3, 0xf9, 0xe0, 0xe0, 0x60, 0xd6, 0x55, 0xd6, 0x82, 0x1b, 0x26, 0xce, 0xbb, 0xe4, 0x7a,
+    0x03, 0x09, 0x0d, 0xd7, 0xb6, 0xf7, 0x3d, 0xe4, 0x09, 0xea, 0x53, 0x3b, 0x91, 0x58, 0x14, 0xc1,
+    0x17, 0x63, 0xbe, 0xce, 0xdc, 0xf6, 0xd5, 0xe6, 0x06, 0xaa, 0x00, 0x37, 0x8b, 0x43, 0xdf, 0x73,
+    0xc8, 0x03, 0x6a, 0xe2, 0x7f, 0x8d, 0x56, 0x79, 0xdc, 0xb4, 0xe6, 0x35, 0x67, 0x4d, 0x22, 0xc8,
+    0x6a, 0x90, 0x61, 0xc3, 0x20, 0xcb, 0x8e, 0x04, 0xc2, 0x71, 0xdc, 0x4d, 0xd6, 0x13, 0x37, 0xb4,
+    0xd3, 0x38, 0x93, 0x98, 0x7f, 0x92, 0xe4, 0x0e, 0xd3, 0x04, 0xed, 0xf4, 0x84, 0x04, 0x61, 0xa0,
+    0x4e, 0x1d, 0x1d, 0x8c, 0xc6, 0x06, 0xc0, 0x10, 0x59, 0x43, 0x5d, 0x72, 0xdb, 0x84, 0x99, 0x04,
+    0x11, 0xf5, 0xad, 0xc4, 0xbb, 0x94, 0x26, 0x6a, 0xd3, 0x7d, 0x6e, 0x1c, 0x8f, 0xa6, 0x9f, 0xeb,
+    0x93, 0xdf, 0x03, 0xd3, 0x34, 0xb7, 0x0c, 0x07, 0xe1, 0x25, 0x8d, 0x5c, 0x1f, 0x33, 0xdf, 0xca,
+    0x73, 0x1c, 0x1a, 0xec, 0x14, 0xc6, 0x1e, 0xc4, 0x49, 0x44, 0xad, 0xb5, 0x56, 0x66, 0x6b, 0x01,
+    0xb6, 0x91, 0xca, 0x31, 0x3a, 0x09, 0x37, 0x88, 0x7e, 0x2a, 0xf7, 0x7c, 0xea, 0x26, 0xb5, 0x9b,
+    0x5a, 0xe5, 0x94, 0x70, 0x88, 0xf4, 0x24, 0x5c, 0xfc, 0x00, 0xcb, 0x3d, 0x74, 0x3d, 0x78, 0x2a,
+    0xd6, 0x44, 0xb9, 0x6c, 0x28, 0x3e, 0xb8, 0xe5, 0x2e, 0x9c, 0xd7, 0x75, 0xc9, 0x99, 0xaf, 0xdf,
+    0x2f, 0x2f, 0x51, 0x05, 0x53, 0x3c, 0x1a, 0xec, 0x96, 0xcf, 0xf6, 0x5b, 0xa2, 0xfe, 0xb4, 0x73,
+    0x3a, 0x93, 0x70, 0x59, 0x14, 0xfa, 0xb1, 0x2e, 0x70, 0x2d, 0x23, 0x4f, 0x8a, 0xa5, 0x78, 0x67,
+    0x08, 0xf1, 0x1f, 0x9e, 0x27, 0x14, 0x9d, 0x24, 0x5d, 0x07, 0x31, 0x5a, 0xf8, 0x86, 0x5a, 0x49,
+    0x1f, 0x71, 0x1a, 0x2e, 0xc0, 0x1e, 0x42, 0x46, 0x00, 0x77, 0xfd, 0xc9, 0x14, 0x34, 0xb3, 0x47,
+    0x26, 0x6e, 0x34, 0x90, 0xe4, 0x5e, 0x5a, 0x1b, 0x55, 0x2e, 0xeb, 0x68, 0x7d, 0x8b, 0x14, 0x9e,
+    0x07, 0xf2, 0x12, 0xb6, 0xa5, 0xc8, 0x06, 0x77, 0xdf, 0x2d, 0x4c, 0xb5, 0x25, 0x9e, 0x34, 0x8a,
+    0x71, 0x71, 0x37, 0xa1, 0x57, 0x87, 0x58, 0xe5, 0x10, 0x67, 0xf9, 0xbe, 0x14, 0xdf, 0xf4, 0xa6,
+    0x51, 0x5a, 0xbe, 0x45, 0x12, 0x0c, 0x37, 0x91, 0x07, 0x3a, 0xbb, 0x6e, 0x80, 0x13, 0xb7, 0x00,
+    0xff, 0xd2, 0x5c, 0x71, 0x6a, 0xdb, 0x34, 0x8e, 0x77, 0x99, 0x6b, 0x32, 0x79, 0xfc, 0xf8, 0x98,
+    0xf2, 0xb9, 0x0e, 0x8e, 0xa9, 0xfb, 0xc8, 0x69, 0x99, 0xeb, 0xca, 0x8a, 0x02, 0x58, 0xcc, 0x5d,
+    0xe6, 0x72, 0xcd, 0xc7, 0x07, 0xee, 0x82, 0xcf, 0xe5, 0x4e, 0xa7, 0x8f, 0x8e, 0xec, 0x96, 0xb9,
+    0xbc, 0xc0, 0x0d, 0x77, 0x99, 0xe8, 0xd0, 0xb5, 0x6c, 0x57, 0x08, 0x65, 0x9a, 0xee, 0x3e, 0x5c,
+    0x6b, 0x27, 0xe2, 0x16, 0x7b, 0xb2, 0xc2, 0xe8, 0x23, 0x83, 0x71, 0xb4, 0x04, 0x37, 0x8c, 0xc0,
+    0xde, 0xd9, 0x25, 0xba, 0xd6, 0x6f, 0xfb, 0x43, 0x70, 0xda, 0x41, 0x53, 0xd1, 0x32, 0xc5, 0xb0,
+    0x30, 0x6d, 0xaa, 0x59, 0x6a, 0xb3, 0x5b, 0x36, 0xa6, 0xa1, 0x4e, 0xd3, 0x9b, 0x4d, 0x74, 0x20,
+    0x40, 0x58, 0x0b, 0x9f, 0x3a, 0x72, 0x56, 0xdd, 0x58, 0xb6, 0x97, 0x40, 0xdc, 0x30, 0x47, 0x53,
+    0xb5, 0x27, 0x04, 0x21, 0xe2, 0x4c, 0xc8, 0x3d, 0xd4, 0x99, 0xe9, 0x98, 0xa8, 0xfa, 0x68, 0x69,
+    0xa9, 0x12, 0x6f, 0xd3, 0x0c, 0x9b, 0x5d, 0xf7, 0xc0, 0x76, 0x94, 0xee, 0xcd, 0xc3, 0xf4, 0x61,
+    0x81, 0x58, 0x5c, 0xd7, 0x9e, 0x98, 0x8f, 0x76, 0x85, 0xd8, 0xba, 0xb0, 0xc5, 0x92, 0x84, 0x16,
+    0xf8, 0x33, 0xfe, 0x57, 0x07, 0x9a, 0x12, 0xf1, 0x78, 0x7a, 0x74, 0x68, 0x1e, 0xee, 0x5e, 0x02,
+    0x56, 0xa3, 0x93, 0x3c, 0x6d, 0xea, 0xab, 0x71, 0x2d, 0x57, 0x4c, 0xbd, 0x22, 0xd0, 0x71, 0x25,
+    0xd3, 0xf5, 0xbd, 0x66, 0xbc, 0xbc, 0x13, 0xd4, 0x77, 0xe8, 0x22, 0x5d, 0x0e, 0x37, 0x56, 0x50,
+    0x83, 0xd4, 0x95, 0xf5, 0x9e, 0x58, 0x13, 0x6b, 0x9f, 0xaa, 0xf9, 0x6e, 0xa8, 0x9f, 0xcc, 0x96,
+    0xc5, 0x3d, 0x6e, 0x5a, 0x5c, 0x4d, 0xed, 0x92, 0xf5, 0x64, 0xd6, 0x61, 0x10, 0xc6, 0xe0, 0x05,
+    0x54, 0x2f, 0xf4, 0xa4, 0x4e, 0xfe, 0x43, 0xd1, 0x5d, 0x99, 0x6a, 0xd1, 0xda, 0x10, 0xc8, 0x57,
+    0xfb, 0x20, 0x1a, 0x8d, 0xad, 0x0e, 0x35, 0x16, 0xc6, 0xc3, 0x55, 0xf7, 0x3a, 0xa4, 0x46, 0xdf,
+    0x0f, 0x97, 0xca, 0xd5, 0xe6, 0xb5, 0x80, 0xd9, 0xfc, 0xe6, 0x88, 0x46, 0x51, 0x08, 0xa1, 0x2f,
+    0x67, 0x87, 0x87, 0xe6, 0x99, 0x7a, 0x70, 0x9e, 0x6a, 0x8a, 0x4a, 0x88, 0x65, 0x0d, 0xcd, 0x70,
+    0x1e, 0xc1, 0x65, 0x49, 0xcb, 0x63, 0x5d, 0xdf, 0x8a, 0x57, 0x10, 0xe9, 0x1d, 0xcf, 0xb6, 0x92,
+    0x50, 0x8f, 0xd5, 0x5d, 0xef, 0x43, 0x2d, 0x36, 0x7d, 0x42, 0xd0, 0xda, 0xd2, 0xc7, 0x2a, 0x22,
+    0xaa, 0x64, 0xcd, 0x1c, 0x51, 0x0c, 0xe9, 0x25, 0x24, 0xa4, 0x58, 0x85, 0x6b, 0xca, 0xf0, 0x42,
+    0x50, 0x81, 0xb0, 0x3c, 0x51, 0x96, 0x50, 0xb2, 0x72, 0x46, 0xca, 0x3c, 0x51, 0x8a, 0xee, 0xc7,
+    0x2a, 0x2a, 0xff, 0xb2, 0xa6, 0x8e, 0x67, 0x91, 0x7e, 0xa9, 0xa9, 0x77, 0x84, 0x4d, 0xbd, 0x81,
+    0x44, 0xa7, 0xdc, 0x0d, 0x94, 0x62, 0x6e, 0x89, 0x5a, 0xd6, 0x4e, 0xab, 0x74, 0xb9, 0x0e, 0xeb,
+    0x63, 0x4a, 0x18, 0x56, 0x07, 0x4e, 0x01, 0x7d, 0x96, 0xdf, 0xe2, 0x57, 0xa7, 0x63, 0xd1, 0xab,
+    0x3d, 0x1d, 0xf3, 0xae, 0xf1, 0x29, 0xf6, 0x5b, 0x45, 0x1b, 0xd7, 0xf1, 0x2e, 0x89, 0x0d, 0x3a,
+    0x89, 0xe7, 0x3d, 0x49, 0x35, 0x3d, 0xe2, 0x39, 0xe2, 0xe6, 0xab, 0xfc, 0xde, 0xd9, 0xe9, 0x18,
+    0xde, 0xa8, 0xbf, 0x9b, 0x0b, 0xda, 0x2b, 0x5a, 0xc2, 0xa7, 0xab, 0xc9, 0xd9, 0xcf, 0x3f, 0xfd,
+    0xf8, 0xf7, 0x7a, 0x43, 0x1a, 0x1e, 0x14, 0xa3, 0x36, 0x19, 0x8d, 0xac, 0x81, 0xd7, 0x3b, 0x13,
+    0x03, 0xa1, 0x68, 0x5b, 0xae, 0x86, 0x7f, 0x48, 0x2d, 0x1f, 0x97, 0x14, 0x96, 0xd9, 0x63, 0x38,
+    0x09, 0x50, 0xe0, 0x92, 0xc6, 0xa0, 0xad, 0x88, 0x80, 0xf1, 0x53, 0x40, 0xe4, 0x76, 0xb8, 0x0c,
+    0x98, 0x01, 0x9c, 0x8e, 0x37, 0x25, 0xca, 0xc8, 0x1f, 0x13, 0x9d, 0x97, 0xcb, 0x52, 0xdb, 0xa7,
+    0xc4, 0x29, 0x6f, 0x68, 0x43, 0x4c, 0xc9, 0x59, 0x29, 0xb5, 0xed, 0xb8, 0x1e, 0xf8, 0x9d, 0x67,
+    0xec, 0x46, 0xd1, 0x6b, 0x07, 0xd5, 0xc2, 0x5b, 0xa5, 0x29, 0x0b, 0xed, 0xe0, 0x4f, 0x95, 0x95,
+    0x8c, 0x36, 0xeb, 0xee, 0xc8, 0xb3, 0xd7, 0x06, 0xb0, 0xde, 0x93, 0x34, 0xaa, 0xce, 0x67, 0xa9,
+    0x53, 0xd4, 0x3b, 0xfb, 0x96, 0x02, 0xf4, 0x08, 0x4e, 0x64, 0xa6, 0xaa, 0x6f, 0xa2, 0x30, 0x80,
+    0x51, 0x22, 0x50, 0x02, 0x1f, 0xdf, 0x3b, 0xfb, 0x3a, 0x4c, 0x08, 0xac, 0x8f, 0xea, 0x3d, 0x49,
+    0xa0, 0x3b, 0x63, 0xf5, 0x15, 0x5b, 0xc3, 0x0e, 0xac, 0xb2, 0xc5, 0x3e, 0x87, 0xa8, 0x91, 0xf4,
+    0xce, 0xcc, 0x5f, 0x92, 0xc3, 0x8b, 0xe7, 0x60, 0xaf, 0x91, 0xd3, 0x81, 0xc5, 0xd8, 0xb9, 0x10,
+    0x4b, 0x7a, 0xbe, 0xa2, 0xf6, 0x7b, 0x30, 0xd1, 0xd1, 0x68, 0xf4, 0x8b, 0xb2, 0xca, 0xfa, 0x13,
+    0x5d, 0x38, 0x65, 0x03, 0xbf, 0xa4, 0x96, 0x9f, 0xac, 0x7a, 0x67, 0x5f, 0xac, 0x1d, 0xf0, 0xed,
+    0x59, 0x07, 0x4e, 0xc5, 0x47, 0xa5, 0x39, 0x97, 0xfa, 0x89, 0xb2, 0x4d, 0xf3, 0x4e, 0x21, 0xf8,
+    0xe9, 0xbc, 0xb7, 0x61, 0xa6, 0xf6, 0xb5, 0xb5, 0xa6, 0x99, 0x99, 0x12, 0xfc, 0x00, 0x3c, 0xb3,
+    0x41, 0xd2, 0x8b, 0x8c, 0x26, 0x29, 0x35, 0xba, 0x18, 0xf7, 0x25, 0x1a, 0x04, 0xe2, 0x9e, 0x4d,
+    0x57, 0x50, 0x86, 0x52, 0x20, 0xfe, 0x02, 0xfd, 0x99, 0x6d, 0x6a, 0x91, 0x3e, 0x1d, 0x2d, 0x47,
+    0x7b, 0xe4, 0x87, 0x70, 0x15, 0xfc, 0xce, 0x09, 0xe9, 0xa0, 0x47, 0x6a, 0xea, 0x60, 0x08, 0x29,
+    0x81, 0x37, 0x82, 0x79, 0xef, 0x9d, 0x35, 0xfc, 0xe3, 0xd3, 0xe1, 0x7f, 0x98, 0xc3, 0xc7, 0xbf,
+    0xfb, 0xfe, 0x61, 0x8f, 0xb0, 0xf0, 0x33, 0xef, 0xbd, 0x8d, 0x29, 0x09, 0x03, 0xff, 0x1a, 0x52,
+    0x1f, 0x8e, 0x8b, 0xf7, 0x48, 0x90, 0xae, 0x17, 0xec, 0xc2, 0x0a, 0x1c, 0x02, 0x19, 0x0c, 0xae,
+    0xed, 0x30, 0xa2, 0x65, 0x2f, 0xbe, 0xbd, 0x8e, 0x80, 0x1e, 0x76, 0x63, 0x20, 0x8c, 0x71, 0x79,
+    0x8b, 0xcf, 0xaf, 0xf9, 0x3a, 0x7f, 0x97, 0xdf, 0xd0, 0xe8, 0x4d, 0x34, 0x3e, 0xab, 0x2f, 0xf7,
+    0x40, 0x16, 0x7b, 0x65, 0x05, 0x4b, 0x90, 0x8c, 0xff, 0x2e, 0xe8, 0xf4, 0x07, 0xbd, 0x12, 0xcb,
+    0x22, 0x59, 0x30, 0x22, 0x77, 0x29, 0x98, 0xcd, 0xc3, 0xf9, 0x57, 0xa1, 0x53, 0x8a, 0xed, 0xf8,
+    0xa9, 0x5d, 0x8c, 0xca, 0xab, 0x75, 0xcb, 0x0e, 0x37, 0x28, 0x05, 0xb9, 0xb4, 0xfc, 0x14, 0xa4,
+    0x8b, 0xc1, 0xf5, 0x30, 0x7d, 0x5c, 0xb0, 0xdf, 0xe4, 0x62, 0x15, 0x42, 0x4c, 0xe3, 0x43, 0x5a,
+    0xdf, 0x5d, 0x40, 0xd9, 0x06, 0x21, 0xe6, 0x19, 0xfe, 0x22, 0xfd, 0xa9, 0x48, 0x32, 0x83, 0xce,
+    0xef, 0x23, 0x5e, 0xed, 0x9d, 0x3d, 0x85, 0x7f, 0x49, 0x7f, 0x42, 0xc0, 0x54, 0xc9, 0x3e, 0xc4,
+    0x54, 0x48, 0x8b, 0xce, 0x16, 0x44, 0xb8, 0x7f, 0x82, 0x8e, 0x20, 0x9b, 0x7a, 0x41, 0x1a, 0xa6,
+    0x31, 0xe1, 0xbe, 0xad, 0xa6, 0xb0, 0xfb, 0x5a, 0x65, 0x69, 0x31, 0x6f, 0x7f, 0xb9, 0x3e, 0x05,
+    0xbc, 0xc1, 0x12, 0x24, 0x0b, 0x40, 0x71, 0x9e, 0x26, 0x45, 0xfb, 0x0a, 0xc1, 0x7a, 0xaf, 0xc1,
+    0x4d, 0x6d, 0x0c, 0x7d, 0x50, 0xb5, 0x73, 0xd3, 0x85, 0x82, 0xf9, 0x25, 0x02, 0x87, 0xb2, 0xed,
+    0x25, 0xe1, 0x12, 0x56, 0xe5, 0xf5, 0x8b, 0xe7, 0x60, 0x74, 0xd9, 0xfc, 0x02, 0x3c, 0x31, 0xb0,
+    0x5f, 0xeb, 0x21, 0x35, 0x58, 0x54, 0x41, 0x5f, 0x10, 0x2a, 0x6d, 0x3d, 0xd7, 0xc9, 0xfc, 0xfc,
+    0xd3, 0x5f, 0xfe, 0x87, 0xc0, 0xc4, 0x84, 0xbd, 0x53, 0xb3, 0xb9, 0x26, 0xa5, 0xc9, 0x8d, 0xef,
+    0x9a, 0x0a, 0xd6, 0xcb, 0x52, 0x64, 0x05, 0x76, 0x22, 0x7b, 0xde, 0x6b, 0xc8, 0xed, 0xa2, 0x23,
+    0xcb, 0xb5, 0x94, 0x7d, 0x00, 0xc7, 0xb6, 0x9c, 0xeb, 0x2d, 0x62, 0x6e, 0x06, 0x04, 0xe5, 0x89,
+    0x44, 0xaf, 0x50, 0x8c, 0x2a, 0xf5, 0xcc, 0xd8, 0x3a, 0xf8, 0x9e, 0xfd, 0x1e, 0x81, 0x8c, 0xc8,
+    0xfb, 0x18, 0x48, 0xd1, 0xff, 0x2f, 0x00, 0x99, 0xe1, 0xf5, 0xe9, 0x98, 0xbf, 0xde, 0x4a, 0x53,
+    0x14, 0x2c, 0x25, 0x9a, 0xc2, 0x4b, 0x59, 0x52, 0xc7, 0xd5, 0x2d, 0x79, 0xee, 0xb3, 0x24, 0xc8,
+    0x7d, 0xbe, 0xf3, 0x0c, 0xa2, 0x23, 0x56, 0x9a, 0x81, 0x1b, 0x0f, 0xba, 0x57, 0x46, 0x1f, 0x6d,
+    0x86, 0x11, 0x87, 0xe4, 0x1b, 0x25, 0x04, 0x1f, 0xdd, 0x9a, 0x3e, 0x77, 0xb6, 0x6c, 0x06, 0xbe,
+    0xa6, 0x38, 0x87, 0xec, 0x2e, 0xac, 0x06, 0xc9, 0x66, 0xce, 0x3c, 0xb4, 0xe3, 0xdc, 0x58, 0xbf,
+    0x95, 0x26, 0x86, 0x38, 0x4d, 0x13, 0x86, 0x6f, 0x68, 0x84, 0xab, 0xf1, 0x1d, 0x65, 0x48, 0x19,
+    0x6f, 0xd4, 0x49, 0x36, 0xd9, 0x44, 0xa9, 0x2e, 0xe6, 0xec, 0xb3, 0x1b, 0xdf, 0xb2, 0xcf, 0x12,
+    0x53, 0xab, 0xc3, 0xb3, 0xe7, 0xf8, 0x90, 0xbc, 0x0e, 0x97, 0x10, 0x82, 0xe1, 0x63, 0xdd, 0x5e,
+    0x73, 0x0a, 0x30, 0xa6, 0x82, 0xfa, 0xdb, 0xf8, 0xc0, 0x5e, 0x49, 0x6d, 0xc2, 0x03, 0xee, 0x83,
+    0x6f, 0xb0, 0x8f, 0x82, 0xb8, 0xfd, 0x19, 0x85, 0x28, 0x0b, 0xa2, 0xa6, 0x7e, 0x82, 0x20, 0x10,
+    0x9e, 0x57, 0x5f, 0x48, 0xfd, 0x12, 0xe8, 0x7e, 0xc3, 0x29, 0xd6, 0x83, 0xa7, 0xef, 0xe5, 0xd9,
+    0x64, 0x7f, 0x3a, 0x3c, 0x30, 0xb3, 0xca, 0x00, 0xa3, 0x2f, 0x07, 0x0b, 0xd8, 0x9c, 0xf7, 0xd6,
+    0x29, 0xac, 0x0e, 0x8c, 0x55, 0x12, 0xf8, 0x0d, 0x76, 0x94, 0xb1, 0x2c, 0x82, 0xd4, 0x0e, 0x16,
+    0x10, 0xb3, 0x0c, 0x4f, 0x3f, 0x6c, 0x60, 0x5d, 0x62, 0x08, 0xb8, 0xb1, 0xfe, 0xcd, 0xe7, 0x9e,
+    0xeb, 0x52, 0x84, 0xd1, 0xc4, 0xc7, 0x92, 0x17, 0x2b, 0x13, 0x0c, 0xf7, 0xac, 0x0e, 0x69, 0x78,
+    0xed, 0x15, 0xac, 0x7c, 0xea, 0x50, 0xb2, 0x44, 0x75, 0xd1, 0x78, 0xbc, 0xb2, 0x92, 0x98, 0x78,
+    0x2e, 0xd4, 0xb5, 0xd1, 0xda, 0xf2, 0x01, 0x74, 0x5c, 0x85, 0x51, 0xa0, 0x7f, 0xfd, 0x14, 0xac,
+    0x32, 0x0c, 0x96, 0x67, 0x88, 0x51, 0x14, 0x69, 0x42, 0x3c, 0x25, 0x6b, 0x48, 0x98, 0x50, 0xcd,
+    0x93, 0xc8, 0xda, 0x78, 0x0e, 0x10, 0xb5, 0xb3, 0x8a, 0x0a, 0xc0, 0x4b, 0x44, 0x9d, 0x98, 0x84,
+    0xae, 0xd0, 0x56, 0x7d, 0xaa, 0xd3, 0x71, 0xea, 0x2b, 0x4b, 0x9a, 0xf2, 0xb2, 0x9f, 0xc6, 0x76,
+    0xe4, 0x6d, 0x4a, 0xa9, 0x07, 0xb0, 0x12, 0x8b, 0xe3, 0xd9, 0x8a, 0xcc, 0xa1, 0x38, 0xf3, 0xe3,
+    0x52, 0xa9, 0x9e, 0x0d, 0x78, 0x85, 0xa6, 0x0e, 0x09, 0x0f, 0x46, 0x04, 0xa9, 0xef, 0x57, 0x07,
+    0x70, 0x9f, 0x6b, 0xa4, 0xc1, 0x87, 0x74, 0xa0, 0xf2, 0x36, 0xc2, 0xa7, 0x57, 0x50, 0xd0, 0x86,
+    0x57, 0x23, 0x3f, 0x84, 0x02, 0x16, 0x56, 0x66, 0xb4, 0x89, 0xc2, 0x24, 0x84, 0x82, 0x99, 0x3c,
+    0x24, 0xc6, 0x78, 0x6c, 0xc0, 0x2f, 0x79, 0xc4, 0x2a, 0x8c, 0x13, 0x06, 0x26, 0x61, 0xc4, 0xc9,
+    0xf1, 0x64, 0xcc, 0xa9, 0x19, 0xb3, 0xc2, 0x02, 0xdd, 0x34, 0xb0, 0x59, 0xde, 0x66, 0x1e, 0xd2,
+    0x5f, 0xc7, 0xcb, 0x3d, 0x96, 0x06, 0x61, 0x3a, 0x03, 0xfd, 0xdb, 0x18, 0xd4, 0xfa, 0x52, 0x01,
+    0x18, 0x3c, 0x36, 0x95, 0xe6, 0xc4, 0x09, 0xed, 0x74, 0x0d, 0x66, 0x33, 0x5a, 0xd2, 0xe4, 0x85,
+    0x4f, 0xf1, 0xf2, 0xd9, 0xf5, 0x2b, 0xa7, 0x6f, 0x64, 0xee, 0x66, 0xd4, 0xf6, 0xcd, 0xf0, 0xe5,
+    0xc4, 0x5b, 0x23, 0xfd, 0x80, 0x5e, 0x61, 0x3d, 0x0d, 0x61, 0x76, 0x94, 0x84, 0xaf, 0x43, 0x3c,
+    0x93, 0xf5, 0x06, 0x9e, 0xc0, 0xfa, 0x83, 0x01, 0xf6, 0x95, 0x6f, 0xa2, 0x73, 0x96, 0xa6, 0xb5,
+    0x41, 0x9a, 0x84, 0x8a, 0x99, 0x61, 0x56, 0xef, 0x52, 0x9e, 0x10, 0x6e, 0x8d, 0x98, 0x37, 0x63,
+    0x5a, 0x40, 0x99, 0x8a, 0x9e, 0x18, 0xea, 0x0b, 0x25, 0xad, 0xbf, 0x80, 0x38, 0xfd, 0x9c, 0x9f,
+    0x23, 0xc3, 0x57, 0xde, 0xb1, 0x91, 0x1e, 0xd7, 0xe2, 0xf7, 0xec, 0x3d, 0x50, 0x93, 0xd4, 0x59,
+    0x62, 0xed, 0xac, 0x98, 0x46, 0xc9, 0x33, 0x0a, 0x51, 0x81, 0xf6, 0x81, 0xce, 0x1e, 0xbb, 0xeb,
+    0x7a, 0x00, 0xc3, 0xce, 0x57, 0x9e, 0xef, 0x48, 0xac, 0x5d, 0xc1, 0x3d, 0xda, 0xc7, 0x21, 0x36,
+    0x3e, 0x05, 0xf7, 0x1b, 0xf9, 0x34, 0x58, 0x26, 0x2b, 0x72, 0x46, 0xf6, 0x4d, 0x59, 0xed, 0xd9,
+    0x24, 0x11, 0x5d, 0x43, 0xae, 0x65, 0xf4, 0xd8, 0xbb, 0x20, 0x9b, 0x92, 0xfa, 0x4d, 0x4d, 0x7b,
+    0xa1, 0x4f, 0xc1, 0x30, 0x96, 0x7d, 0xe3, 0xdd, 0xf3, 0x17, 0xcf, 0xde, 0xfe, 0x3a, 0x97, 0x9f,
+    0x49, 0x65, 0xec, 0xa1, 0x4c, 0x95, 0xdd, 0x83, 0xba, 0x89, 0xa4, 0x1b, 0x07, 0xd4, 0x7d, 0x51,
+    0xaa, 0xbc, 0xfa, 0x70, 0xc3, 0x92, 0x59, 0xf5, 0x5c, 0x76, 0x7b, 0xc4, 0x8d, 0xed, 0x82, 0x69,
+    0x71, 0x3e, 0x67, 0xb5, 0x86, 0x0b, 0xc0, 0xc3, 0x19, 0x90, 0x88, 0x82, 0x4f, 0x04, 0x4a, 0xd3,
+    0x08, 0x13, 0xe6, 0x08, 0x32, 0x81, 0x87, 0xe5, 0x3b, 0xcf, 0xa3, 0x70, 0xb3, 0x91, 0xfb, 0x7d,
+    0x5a, 0x5b, 0x2c, 0x57, 0x8a, 0xc6, 0x40, 0x5a, 0x5c, 0x36, 0x5f, 0x4d, 0xd1, 0x4f, 0x14, 0xb3,
+    0x31, 0x27, 0x63, 0x3a, 0x63, 0x2c, 0xc2, 0x27, 0xe2, 0x88, 0x27, 0x7d, 0xb8, 0xad, 0xa8, 0xcd,
+    0xfa, 0x13, 0xd3, 0x24, 0xbf, 0x52, 0x91, 0x1a, 0x73, 0x22, 0x68, 0xf7, 0x2f, 0xb1, 0x73, 0xd9,
+    0x87, 0xe5, 0x06, 0x82, 0x9f, 0x0f, 0x8c, 0x1a, 0x99, 0x13, 0x62, 0xfc, 0x67, 0xba, 0x6f, 0x4e,
+    0x0e, 0x0d, 0xe5, 0xda, 0x8c, 0xc7, 0x04, 0x89, 0x0e, 0x23, 0x58, 0x18, 0x50, 0xab, 0x0b, 0xb1,
+    0x7e, 0xc5, 0xd2, 0x52, 0xb2, 0xa2, 0x10, 0xcc, 0x2f, 0x29, 0x81, 0xf0, 0x8f, 0xa7, 0x23, 0xc9,
+    0x90, 0xdd, 0x12, 0xfb, 0xff, 0x60, 0xa8, 0x00, 0xd8, 0xca, 0x54, 0x50, 0x96, 0x18, 0xc3, 0x2c,
+    0x8e, 0x62, 0x64, 0x30, 0xaf, 0xb9, 0x11, 0xba, 0xcd, 0xd5, 0x8a, 0x06, 0xec, 0x3e, 0x24, 0x7a,
+    0x54, 0x1b, 0x44, 0x32, 0x3f, 0x26, 0x0b, 0xba, 0x82, 0x68, 0xc3, 0xea, 0xc8, 0x32, 0xa1, 0x64,
+    0xe5, 0xc5, 0x24, 0x5e, 0x85, 0x57, 0x31, 0x81, 0x7f, 0x20, 0x38, 0x27, 0xec, 0x65, 0x0b, 0x8a,
+    0x20, 0xb8, 0x63, 0x81, 0xfc, 0x88, 0x57, 0xf2, 0x37, 0x00, 0x22, 0x64, 0xf1, 0xaf, 0xdf, 0x1f,
+    0x90, 0xf9, 0x99, 0x7c, 0x4a, 0x88, 0x26, 0xf6, 0xaa, 0x6f, 0x8c, 0x79, 0x9b, 0xc0, 0x18, 0xd4,
+    0x14, 0x34, 0x02, 0xc6, 0x82, 0x7e, 0x84, 0x6f, 0x46, 0xa3, 0x1f, 0x62, 0x2c, 0x04, 0x75, 0x83,
+    0xea, 0xf6, 0xab, 0x18, 0x09, 0x91, 0x13, 0x26, 0x14, 0xac, 0xdc, 0x94, 0x3d, 0x62, 0x8f, 0x4c,
+    0x4d, 0x13, 0x77, 0xd8, 0x74, 0x9e, 0xf1, 0x0d, 0x07, 0xc1, 0x7d, 0x34, 0x31, 0xd9, 0x29, 0xb4,
+    0xe6, 0x29, 0x90, 0x73, 0xdd, 0x32, 0xe1, 0x53, 0xb3, 0x3b, 0xb2, 0x7e, 0x66, 0x5f, 0x1d, 0x9f,
+    0x8b, 0x96, 0x79, 0x43, 0x94, 0xae, 0x36, 0x44, 0xe5, 0xd0, 0x59, 0x34, 0x96, 0x59, 0x00, 0x7d,
+    0xed, 0xc5, 0xc9, 0xc8, 0x72, 0xe0, 0x35, 0xde, 0x67, 0x96, 0x87, 0xc3, 0x42, 0x62, 0xf4, 0x0e,
+    0xd3, 0x44, 0x28, 0x4f, 0xf5, 0x3e, 0x8f, 0x5e, 0x05, 0x89, 0x3d, 0x6c, 0xae, 0xb7, 0x44, 0x9d,
+    0x52, 0xb1, 0xa5, 0x14, 0x95, 0x06, 0x7c, 0x57, 0xb3, 0x41, 0xd0, 0xac, 0xc6, 0x02, 0x25, 0xb3,
+    0xe2, 0xae, 0x16, 0x3b, 0x58, 0xee, 0x33, 0xb0, 0xae, 0x62, 0x3a, 0x39, 0x61, 0xc1, 0xb1, 0x9f,
+    0x51, 0x7e, 0x42, 0x0c, 0x71, 0x69, 0xa0, 0x3f, 0x66, 0xfb, 0xa8, 0xc8, 0xbe, 0xc8, 0x91, 0x33,
+    0xa5, 0xcd, 0x72, 0xce, 0x87, 0x30, 0xf4, 0x89, 0x78, 0x7f, 0x2e, 0xd3, 0x9d, 0x30, 0x8a, 0xa6,
+    0x31, 0xb8, 0x95, 0x61, 0x63, 0x88, 0xa9, 0xbb, 0x8e, 0x42, 0x3a, 0xce, 0x11, 0x04, 0x8a, 0x78,
+    0x03, 0xba, 0xa3, 0x5c, 0xce, 0x7f, 0xbd, 0xf8, 0xe6, 0x6b, 0x0c, 0x50, 0xe0, 0x96, 0x9e, 0x7b,
+    0xcd, 0x43, 0x3a, 0x48, 0x26, 0x6a, 0x23, 0x59, 0xb8, 0xec, 0xa7, 0x6a, 0xf2, 0x25, 0x91, 0x18,
+    0x3c, 0x66, 0xea, 0x26, 0x65, 0xad, 0xfd, 0xfc, 0xd3, 0x7f, 0xff, 0x59, 0xdc, 0x2e, 0x14, 0xa8,
+    0x26, 0x5d, 0x33, 0xa5, 0xea, 0x5c, 0x06, 0xab, 0x31, 0x99, 0xf1, 0x4c, 0x2b, 0xd6, 0x93, 0x5b,
+    0x91, 0xd6, 0xad, 0x69, 0x14, 0x6d, 0xa3, 0x27, 0xb6, 0xf9, 0xc5, 0x95, 0x04, 0x97, 0xa0, 0x13,
+    0x76, 0xc3, 0x50, 0x4e, 0xa9, 0x34, 0xe2, 0x96, 0xa4, 0x04, 0xf6, 0x08, 0x55, 0x36, 0x58, 0x6e,
+    0x8e, 0xf2, 0x0a, 0x2a, 0x82, 0x1b, 0x1e, 0xad, 0xc8, 0xdb, 0xef, 0x5e, 0x73, 0x3e, 0xf2, 0x91,
+    0x25, 0xdb, 0xbb, 0x27, 0x1b, 0x5e, 0xea, 0x8d, 0x8b, 0xa6, 0x99, 0x1c, 0x34, 0x2b, 0x76, 0x85,
+    0x51, 0x46, 0xb6, 0x2b, 0x3e, 0x00, 0x42, 0xff, 0x92, 0xe9, 0x4a, 0x2f, 0x44, 0x31, 0x07, 0x08,
+    0xe2, 0x05, 0x01, 0x8d, 0xbe, 0x7c, 0xf3, 0xd5, 0x6b, 0x84, 0xba, 0xf0, 0xee, 0x8c, 0xe9, 0x44,
+    0xc5, 0x1a, 0x96, 0x55, 0x9f, 0x8c, 0xa7, 0xa2, 0xce, 0x62, 0x3c, 0x21, 0x22, 0x7b, 0xea, 0xfc,
+    0x60, 0x61, 0x07, 0x08, 0x99, 0x83, 0xd0, 0x03, 0x09, 0x29, 0x5a, 0xd0, 0xa5, 0x17, 0x00, 0xe6,
+    0x41, 0x82, 0x03, 0x0d, 0xa7, 0xca, 0x8c, 0x53, 0x62, 0xb4, 0x6e, 0x44, 0xf9, 0x92, 0xb1, 0xa3,
+    0xc2, 0x55, 0x27, 0x8b, 0xc4, 0x51, 0xd8, 0x3d, 0xb8, 0x0a, 0xdf, 0xa3, 0x9f, 0x64, 0xfe, 0x85,
+    0xce, 0xa1, 0xb5, 0x2b, 0x8e, 0x94, 0xf2, 0x00, 0x20, 0x61, 0x3c, 0x15, 0x6f, 0xfa, 0x58, 0x50,
+    0x65, 0x0f, 0xc7, 0xed, 0xea, 0xff, 0x19, 0x25, 0xa6, 0x6b, 0x4e, 0x84, 0xa3, 0x1c, 0x76, 0x43,
+    0x13, 0x15, 0x2b, 0xd0, 0x90, 0x0d, 0x1c, 0xe8, 0x1c, 0xb1, 0x79, 0x71, 0xd9, 0xce, 0x55, 0x2d,
+    0x5f, 0x96, 0xe8, 0xce, 0xb6, 0xa3, 0x2a, 0x35, 0xa7, 0x9b, 0x28, 0x33, 0xd8, 0x57, 0xea, 0x5d,
+    0x1b, 0x8a, 0x48, 0x70, 0xaf, 0xbb, 0x38, 0x62, 0xb7, 0xa5, 0x36, 0xa3, 0x9a, 0x7f, 0xc6, 0x86,
+    0x83, 0x3b, 0x39, 0x68, 0x3e, 0xff, 0xf8, 0xdb, 0x8f, 0x84, 0x07, 0x42, 0x34, 0xa0, 0x7f, 0xfc,
+    0xed, 0xaf, 0x04, 0xf7, 0xbe, 0x5e, 0xe2, 0xa6, 0xb4, 0x82, 0x2b, 0x2d, 0x0f, 0xc5, 0xa6, 0x94,
+    0x5a, 0xee, 0xe2, 0xb9, 0x7e, 0x35, 0x2b, 0x7b, 0x70, 0xe4, 0x8b, 0x2f, 0x88, 0xe2, 0xee, 0x7d,
+    0xa8, 0x00, 0x0c, 0x63, 0xeb, 0x15, 0xaf, 0x10, 0x51, 0x73, 0x58, 0x19, 0x32, 0x6b, 0x8a, 0xec,
+    0x82, 0x15, 0xcb, 0x8f, 0x50, 0x6f, 0x98, 0x66, 0x4a, 0xb6, 0x5b, 0x21, 0xd3, 0x6c, 0xfe, 0x37,
+    0x5a, 0x4d, 0x64, 0x40, 0x83, 0x89, 0x5b, 0x2a, 0x78, 0xb6, 0x94, 0xba, 0x8e, 0x57, 0x32, 0x61,
+    0xb3, 0x27, 0xb3, 0xb6, 0x0c, 0xc6, 0x70, 0x0c, 0xc1, 0x98, 0x23, 0x02, 0x90, 0xc4, 0xe0, 0xb6,
+    0x98, 0x46, 0x2d, 0xb7, 0xae, 0x22, 0x6c, 0x8e, 0x53, 0x2d, 0xb9, 0x78, 0x7b, 0x7f, 0x31, 0x9e,
+    0x90, 0x17, 0x2c, 0x82, 0xce, 0x5a, 0x82, 0x1e, 0x8b, 0xed, 0x1d, 0xd3, 0xfa, 0x8d, 0x12, 0xe9,
+    0x4b, 0x3d, 0x67, 0x25, 0x22, 0x0d, 0x78, 0xaf, 0x41, 0x2b, 0x47, 0xb1, 0xfb, 0x07, 0x92, 0xb0,
+    0xfd, 0x92, 0x11, 0x44, 0xdf, 0xb5, 0x1c, 0xde, 0xf3, 0x28, 0x9b, 0xb0, 0x8e, 0x9c, 0x68, 0x03,
+    0x22, 0xf1, 0x13, 0xd2, 0x43, 0xe6, 0xb3, 0xce, 0x4e, 0xcf, 0xd0, 0x2c, 0x1a, 0x98, 0xe5, 0x7d,
+    0x1c, 0x34, 0xd0, 0x67, 0x03, 0xd6, 0x17, 0x81, 0xca, 0x8c, 0xae, 0x37, 0xc9, 0xf5, 0x7d, 0xa3,
+    0x09, 0xe3, 0x58, 0x3e, 0x24, 0x53, 0xf0, 0x22, 0x9f, 0x5a, 0x31, 0x60, 0x23, 0xb6, 0x53, 0x69,
+    0x95, 0xd9, 0xd2, 0x27, 0xb0, 0xa6, 0xde, 0x04, 0x32, 0x39, 0xfe, 0xaf, 0xca, 0xf6, 0xe5, 0x67,
+    0x63, 0x58, 0xe0, 0x38, 0xe9, 0x33, 0xde, 0x1b, 0x98, 0x7f, 0x15, 0x80, 0xf6, 0x3c, 0x87, 0x2b,
+    0x02, 0xcf, 0x21, 0x5a, 0x49, 0x17, 0x09, 0xba, 0x6f, 0x8a, 0x76, 0x97, 0x48, 0x5d, 0xb4, 0xd2,
+    0x64, 0xc8, 0xf5, 0xf3, 0x84, 0x7d, 0x4f, 0x91, 0x59, 0x5c, 0x60, 0x87, 0x0e, 0x7d, 0xfb, 0xdd,
+    0xab, 0xf3, 0x70, 0x0d, 0xf8, 0x00, 0x1b, 0x57, 0x5c, 0xcc, 0xa6, 0x02, 0xa0, 0x11, 0xb0, 0x16,
+    0xb3, 0xdc, 0x0d, 0xe6, 0x68, 0xc5, 0x1d, 0x3a, 0x8c, 0xdd, 0xbd, 0x16, 0x29, 0xb1, 0xdc, 0x86,
+    0x43, 0x78, 0xda, 0x13, 0x07, 0xcb, 0xb6, 0x11, 0x21, 0xc7, 0x1a, 0xfc, 0x05, 0x5d, 0x10, 0xbe,
+    0x45, 0xfa, 0xc1, 0x75, 0x9b, 0x69, 0x89, 0xaa, 0x8a, 0x16, 0x6c, 0xb0, 0x64, 0xfd, 0x6b, 0xec,
+    0xd2, 0x64, 0x5e, 0x3c, 0xd0, 0x93, 0xa9, 0xe6, 0x2e, 0xdc, 0x51, 0x11, 0x02, 0xb9, 0xa9, 0x8f,
+    0x87, 0x17, 0x33, 0x12, 0xed, 0x15, 0xdb, 0x0d, 0xa1, 0x7e, 0x4c, 0x1b, 0xd4, 0x20, 0xdc, 0xe3,
+    0x45, 0x11, 0x1e, 0x99, 0x02, 0xd7, 0x40, 0x13, 0x40, 0x80, 0x8e, 0xea, 0x1d, 0x97, 0x5f, 0x25,
+    0xd3, 0xb8, 0x75, 0xf9, 0x35, 0x1e, 0xe3, 0xce, 0xf9, 0xd5, 0x78, 0xe5, 0x39, 0x94, 0xe4, 0x47,
+    0xce, 0x16, 0x10, 0xbe, 0x1c, 0x82, 0x5b, 0x59, 0x62, 0x25, 0x70, 0x87, 0xa1, 0xbd, 0x64, 0x2b,
+    0xed, 0xdf, 0x83, 0x25, 0x58, 0x8e, 0xf3, 0x02, 0x8f, 0xf1, 0x61, 0x5b, 0x83, 0x42, 0xe5, 0x03,
+    0xcf, 0xd9, 0xe6, 0x30, 0x16, 0x15, 0x22, 0x57, 0x68, 0xb2, 0x03, 0xdb, 0xcf, 0x98, 0xb3, 0x3e,
+    0x19, 0x0f, 0xfe, 0xaa, 0x3e, 0x68, 0xb1, 0xe5, 0xd8, 0x94, 0x48, 0x8a, 0x51, 0xea, 0x46, 0xbb,
+    0xd8, 0x58, 0x6c, 0x22, 0x21, 0x86, 0xa8, 0xdf, 0xcf, 0xb7, 0x0d, 0x9b, 0x28, 0xe4, 0x83, 0x64,
+    0x1a, 0x72, 0x94, 0xe7, 0x82, 0x23, 0x0e, 0xcc, 0xaa, 0x5f, 0x85, 0x25, 0x14, 0x22, 0x8d, 0xd8,
+    0x4e, 0xe5, 0x48, 0x6c, 0x54, 0x62, 0x96, 0xc7, 0xbd, 0x4a, 0x45, 0x8a, 0x17, 0x22, 0x74, 0x1e,
+    0x9f, 0x33, 0x5c, 0x7f, 0x83, 0x7d, 0xe7, 0x4f, 0x7a, 0x45, 0xb8, 0x4d, 0x45, 0x00, 0x9c, 0xf2,
+    0x93, 0xb3, 0xaf, 0x62, 0xa6, 0x85, 0x7f, 0xc5, 0x14, 0x5a, 0xaf, 0x6f, 0x62, 0x55, 0x37, 0xf5,
+    0x1d, 0xaa, 0x5a, 0xc5, 0xea, 0xbd, 0x66, 0xec, 0x55, 0xdd, 0x9b, 0x6f, 0x72, 0xae, 0x8e, 0x4e,
+    0xac, 0x75, 0x3f, 0x11, 0x80, 0xe6, 0x3b, 0x65, 0x06, 0x25, 0x8a, 0xcb, 0xf6, 0x01, 0xd9, 0x5e,
+    0x39, 0x84, 0x9f, 0x21, 0x3f, 0x35, 0xc4, 0x77, 0x93, 0x90, 0x69, 0xc0, 0x71, 0x7b, 0x44, 0x1c,
+    0x7b, 0x64, 0x77, 0x37, 0x59, 0x25, 0xa2, 0x41, 0x76, 0x19, 0x8f, 0x68, 0x8f, 0xe2, 0xd8, 0xa3,
+    0xd1, 0x04, 0xf4, 0xc2, 0x4c, 0x2a, 0x18, 0x78, 0x9f, 0x08, 0x14, 0x87, 0xf9, 0xc4, 0x12, 0xf8,
+    0x09, 0x37, 0xaa, 0x46, 0x5b, 0x20, 0x40, 0xfe, 0x6e, 0x09, 0xff, 0x71, 0x12, 0xf7, 0x77, 0x86,
+    0x81, 0x85, 0x7f, 0xb1, 0x23, 0x4c, 0x8d, 0x0e, 0x86, 0x03, 0x6a, 0xfd, 0x90, 0x16, 0x53, 0xe7,
+    0x87, 0xa9, 0xfa, 0xda, 0x9d, 0xb2, 0x1b, 0xbd, 0xcd, 0x65, 0xaf, 0xca, 0x5d, 0xfd, 0xf2, 0xe2,
+    0x22, 0x48, 0xe7, 0xe7, 0xb6, 0xf8, 0x7e, 0xf4, 0x68, 0x34, 0xd2, 0x01, 0x73, 0x09, 0x1b, 0xe4,
+    0xef, 0xe3, 0x2b, 0x72, 0x33, 0x99, 0x77, 0xf9, 0xd5, 0x1d, 0x66, 0xc1, 0x9d, 0xb1, 0x3b, 0x78,
+    0xcc, 0xec, 0xf2, 0xff, 0x0b, 0x72, 0x2c, 0xf1, 0x9b, 0xfa, 0xc9, 0xff, 0x59, 0xe0, 0x78, 0x9b,
+    0xb6, 0x8a, 0xc6, 0x48, 0xb0, 0xe1, 0x23, 0xa4, 0x77, 0xc8, 0x83, 0x1c, 0x9d, 0x15, 0x94, 0x76,
+    0x85, 0x7d, 0xb5, 0x79, 0xfe, 0x4a, 0xfe, 0x77, 0x21, 0x60, 0xb6, 0xc6, 0xdd, 0xf1, 0x9f, 0x46,
+    0x8c, 0x8c, 0x90, 0x6b, 0x79, 0x9a, 0xed, 0x86, 0x9b, 0x96, 0xcd, 0xa7, 0x6a, 0xb8, 0x91, 0xd8,
+    0xc6, 0xf3, 0x19, 0x36, 0x6a, 0x1e, 0x56, 0xd5, 0x6c, 0xda, 0xcd, 0x9e, 0xce, 0x94, 0x5b, 0x74,
+    0xf9, 0xb1, 0x8f, 0xb6, 0x4d, 0x50, 0x61, 0x95, 0x7c, 0xae, 0x33, 0xb1, 0x6b, 0xad, 0xb3, 0x4b,
+    0x1b, 0xa2, 0x73, 0x94, 0x93, 0xcb, 0x66, 0xe9, 0xaa, 0xb4, 0x1f, 0x09, 0x3f, 0x37, 0x6a, 0x43,
+    0x75, 0x0a, 0xf2, 0xd1, 0xfb, 0xcd, 0x7e, 0xde, 0xbd, 0x49, 0x94, 0xcd, 0xf1, 0x7b, 0x4e, 0xff,
+    0xb3, 0x8f, 0x5c, 0x9a, 0x87, 0x64, 0x72, 0x33, 0xfe, 0xec, 0x23, 0x93, 0xe8, 0x06, 0xc2, 0xdf,
+    0xef, 0x15, 0xd3, 0x29, 0x43, 0x60, 0xb7, 0x30, 0xd8, 0x79, 0x23, 0xad, 0x6b, 0x18, 0xda, 0x32,
+    0x40, 0x7c, 0xf2, 0x20, 0x71, 0xa3, 0xf6, 0x48, 0x85, 0xb2, 0x98, 0xbe, 0x1f, 0x3e, 0x94, 0x92,
+    0x1f, 0xdb, 0xd4, 0xee, 0xb4, 0x03, 0xcb, 0x4f, 0x2c, 0x2a, 0x51, 0xd7, 0xe2, 0x16, 0x35, 0xc6,
+    0x56, 0x88, 0xad, 0x06, 0x82, 0x4a, 0xc7, 0xb4, 0x94, 0x68, 0xa1, 0xe2, 0x0b, 0xe5, 0x23, 0x5b,
+    0x03, 0x35, 0xb8, 0xd5, 0x1e, 0xd7, 0xca, 0xbf, 0xfa, 0x05, 0x58, 0x56, 0x6a, 0x3e, 0x16, 0xa7,
+    0x36, 0x0d, 0xf5, 0xf8, 0xca, 0x01, 0xa4, 0xd2, 0xa1, 0x4d, 0xc5, 0x70, 0xd4, 0xc6, 0x28, 0xff,
+    0xa2, 0xae, 0x96, 0x0b, 0xc9, 0x6d, 0xd9, 0x59, 0xed, 0xac, 0x9a, 0x8d, 0x13, 0x76, 0xc8, 0xc4,
+    0xe8, 0x0a, 0x8e, 0xd8, 0x94, 0x0c, 0x09, 0x23, 0x7b, 0x1c, 0xc0, 0x74, 0xe0, 0x2c, 0x89, 0x52,
+    0xda, 0xa6, 0x43, 0xf5, 0x18, 0xa5, 0x0a, 0xc3, 0xcd, 0x1d, 0x69, 0x50, 0x3a, 0x97, 0xd7, 0x25,
+    0xb4, 0xb6, 0x42, 0x44, 0xe1, 0x29, 0xfb, 0x66, 0x6d, 0xbb, 0xf9, 0xa6, 0x83, 0xe3, 0x64, 0x47,
+    0x71, 0x77, 0x71, 0x1d, 0x6d, 0x71, 0x7d, 0x6b, 0xe7, 0xb9, 0xf3, 0x42, 0x47, 0x76, 0xcd, 0xca,
+    0xf9, 0xc7, 0x41, 0xd3, 0x7e, 0x24, 0xd8, 0xab, 0x38, 0x72, 0x9a, 0x9d, 0x01, 0xe5, 0xef, 0x36,
+    0x00, 0xe8, 0xea, 0x46, 0x6d, 0xb8, 0x19, 0x66, 0x2d, 0x85, 0x5f, 0x26, 0x03, 0x54, 0x37, 0xe7,
+    0x85, 0xc7, 0xdd, 0xe6, 0x34, 0x45, 0x51, 0x2c, 0xb7, 0x46, 0xa0, 0xd6, 0x48, 0x74, 0x91, 0x1d,
+    0xf2, 0x6c, 0x7a, 0x73, 0x0b, 0x8f, 0xda, 0x32, 0x36, 0xa9, 0x63, 0x6f, 0xf5, 0xa8, 0xeb, 0xa0,
+    0x33, 0xea, 0x15, 0x2a, 0x96, 0x82, 0x1b, 0x94, 0xcf, 0x39, 0x36, 0x65, 0xd0, 0x21, 0x07, 0xc6,
+    0xb8, 0x41, 0xcb, 0x4f, 0x03, 0x37, 0xa9, 0xfa, 0x93, 0xa5, 0xe4, 0x1b, 0x8d, 0x5d, 0x75, 0x00,
+    0xbf, 0x92, 0x4b, 0x64, 0x47, 0xf5, 0xb6, 0x03, 0xc1, 0x37, 0x5d, 0xa3, 0xfe, 0x16, 0x0d, 0x84,
+    0x3b, 0x6e, 0x22, 0xdc, 0xae, 0x91, 0xb0, 0x1d, 0xf4, 0x2c, 0x76, 0xff, 0xa2, 0x64, 0x97, 0x10,
+    0x23, 0xbb, 0xe4, 0x76, 0x09, 0x4d, 0xeb, 0x88, 0xea, 0x5c, 0x5a, 0x0f, 0x70, 0x52, 0x15, 0xf2,
+    0x3a, 0x0c, 0x37, 0x7d, 0xdd, 0x0a, 0xe1, 0x36, 0x9a, 0x14, 0x72, 0x75, 0x7a, 0xaa, 0x45, 0xeb,
+    0xed, 0xf0, 0xf4, 0x56, 0x11, 0x75, 0x9b, 0xa8, 0xba, 0x03, 0xb6, 0xfe, 0xe4, 0xf8, 0xba, 0x31,
+    0x2c, 0xf1, 0x8e, 0x0d, 0xe9, 0x5e, 0x8b, 0x37, 0xa3, 0x76, 0x7d, 0xf2, 0x2c, 0x9d, 0x88, 0x2b,
+    0xd9, 0x02, 0x43, 0x24, 0x83, 0x19, 0x6e, 0x73, 0xe0, 0xb7, 0xfc, 0x96, 0xf1, 0x38, 0xa6, 0xb6,
+    0xbe, 0x52, 0xe8, 0xb4, 0xa3, 0x5f, 0x31, 0xb5, 0x56, 0xe0, 0x59, 0x51, 0x83, 0x9d, 0x77, 0xc1,
+    0xc4, 0x97, 0x57, 0x0a, 0x6f, 0xf3, 0xaf, 0x8d, 0xad, 0x80, 0x53, 0xf5, 0xab, 0x44, 0xf5, 0xf3,
+    0xe5, 0x40, 0x19, 0x42, 0xc4, 0x1a, 0x77, 0xd5, 0x30, 0x78, 0xb0, 0xf9, 0x78, 0x81, 0x43, 0xa3,
+    0x27, 0xa4, 0xcf, 0xbf, 0x92, 0x4d, 0xae, 0x3c, 0xdf, 0x27, 0x5f, 0x7f, 0xf3, 0x86, 0x2c, 0x28,
+    0x44, 0x02, 0xac, 0x66, 0x9d, 0x81, 0xa1, 0xdc, 0x4f, 0xce, 0x0c, 0x9f, 0xcd, 0xfb, 0x8b, 0x81,
+    0x88, 0x1d, 0xec, 0xd6, 0x30, 0x8d, 0xce, 0xa9, 0x53, 0xe8, 0x8f, 0x08, 0xa1, 0x3a, 0x26, 0x8c,
+    0xe6, 0x76, 0x48, 0xed, 0x4b, 0xb7, 0x4a, 0x50, 0x0b, 0x33, 0x36, 0x41, 0xca, 0xca, 0xb9, 0x41,
+    0x6d, 0x0f, 0x1e, 0x46, 0x21, 0x3e, 0x41, 0x4a, 0x1f, 0x8d, 0x89, 0x69, 0x9c, 0x18, 0x6f, 0xff,
+    0xfd, 0xd7, 0x4f, 0x8d, 0x3d, 0xe3, 0x31, 0x5c, 0x5e, 0xf0, 0xcb, 0x63, 0xb8, 0xe4, 0x57, 0x8f,
+    0xf0, 0xe6, 0x6f, 0xd8, 0xe5, 0x11, 0x5c, 0xf2, 0xab, 0x29, 0x5c, 0x9d, 0xbf, 0x7a, 0x09, 0x57,
+    0x87, 0x70, 0xf5, 0x6f, 0xfc, 0xe6, 0x01, 0x5c, 0x7e, 0x29, 0xae, 0xf7, 0xf1, 0x36, 0x1f, 0x31,
+    0xc1, 0x4b, 0x71, 0x7b, 0x82, 0xd4, 0xf6, 0x0f, 0xcd, 0x0f, 0xf0, 0xbf, 0x71, 0xd3, 0xdc, 0xba,
+    0x45, 0x8d, 0xa0, 0xcd, 0x43, 0x05, 0xc6, 0x8e, 0xd9, 0x64, 0x6c, 0xbf, 0x83, 0x8b, 0xef, 0xc9,
+    0x9f, 0xfe, 0x44, 0x2a, 0xe2, 0x22, 0x3e, 0x51, 0x34, 0x79, 0xd5, 0xcd, 0x5d, 0xbe, 0x61, 0xf9,
+    0xe4, 0xd2, 0x8a, 0xe6, 0xec, 0x20, 0x3e, 0xfe, 0x3d, 0x8d, 0x2f, 0x40, 0x5f, 0xec, 0x1c, 0x01,
+    0x50, 0xdd, 0xa1, 0xeb, 0x8b, 0x59, 0x02, 0x5b, 0xba, 0x03, 0x92, 0xac, 0xa2, 0xf0, 0x8a, 0x7d,
+    0x07, 0x87, 0x35, 0xfb, 0xd0, 0x95, 0xfe, 0x90, 0xb2, 0x33, 0xff, 0xda, 0x66, 0xd9, 0xa7, 0x6c,
+    0xef, 0x6e, 0x11, 0xf7, 0x15, 0x3d, 0xab, 0xd2, 0x91, 0x3c, 0xcd, 0x2a, 0xa0, 0xba, 0x1a, 0x82,
+    0x72, 0x79, 0xbf, 0xb3, 0xbd, 0x1e, 0x6b, 0x47, 0xf1, 0xe2, 0x5c, 0xaf, 0xd1, 0xe0, 0xad, 0xb5,
+    0x53, 0xce, 0xcd, 0x99, 0xae, 0x42, 0xb7, 0xf8, 0x56, 0x18, 0xd8, 0xd3, 0x13, 0x94, 0x18, 0xbf,
+    0x48, 0x35, 0x0a, 0xc2, 0xab, 0x7e, 0x03, 0x6b, 0x37, 0x22, 0x61, 0xdc, 0x59, 0x9b, 0xf8, 0x25,
+    0x33, 0x15, 0x76, 0xa8, 0x81, 0x05, 0x06, 0x52, 0x36, 0xf5, 0x4f, 0xdc, 0x2b, 0xce, 0xbe, 0xd2,
+    0x44, 0x33, 0xeb, 0xcd, 0x66, 0xce, 0x78, 0xe1, 0xc0, 0x19, 0xd0, 0x1d, 0x5c, 0x74, 0x6f, 0x19,
+    0xd7, 0xe9, 0x6c, 0xdd, 0x3c, 0x6e, 0x3f, 0xf4, 0x1d, 0x06, 0xfc, 0xcf, 0x2a, 0xcd, 0xf5, 0x67,
+    0x05, 0xd4, 0x65, 0x10, 0x7f, 0x6d, 0x88, 0x5e, 0x18, 0x5d, 0xab, 0xf7, 0x8b, 0x3a, 0x98, 0xd5,
+    0xd6, 0xa7, 0xd2, 0x5b, 0xad, 0xec, 0x86, 0x7d, 0x91, 0xa3, 0xd2, 0x47, 0x9c, 0x65, 0x7f, 0xb0,
+    0x47, 0x7c, 0xb9, 0xf2, 0x74, 0xcc, 0xff, 0x54, 0xcf, 0xe9, 0x98, 0xff, 0xd9, 0xf7, 0x7f, 0x02,
+    0x54, 0x2a, 0x5a, 0xbf, 0x0e, 0x5e, 0x00, 0x00,
+};
+
+#endif // INDEX_HTML_GZ_H
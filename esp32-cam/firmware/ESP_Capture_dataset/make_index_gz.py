@@ -0,0 +1,53 @@
+#!/usr/bin/env python3
+"""Regenerate index_html_gz.h from index.html.
+
+The capture UI is served gzip-compressed from PROGMEM (see
+index_handler in web_server.h). After editing index.html, run:
+
+    python3 make_index_gz.py
+
+and recompile the sketch. The ETag is derived from the compressed
+bytes, so browser caches invalidate automatically on any change.
+"""
+import gzip
+import zlib
+
+with open('index.html', 'rb') as f:
+    html = f.read()
+
+gz = gzip.compress(html, 9, mtime=0)
+etag = '"%08x-%x"' % (zlib.crc32(gz) & 0xffffffff, len(gz))
+
+lines = []
+for i in range(0, len(gz), 16):
+    lines.append('    ' + ', '.join('0x%02x' % b for b in gz[i:i + 16]) + ',')
+array = '\n'.join(lines)
+
+header = f"""// index_html_gz.h - gzip-compressed web interface (generated file)
+//
+// Source: index.html in this directory. Regenerate after editing it:
+//     python3 make_index_gz.py
+//
+// The page is served straight from flash with Content-Encoding: gzip
+// and a strong ETag, so browsers get a 304 on reload instead of the
+// full ~{len(html) // 1024} KB page ({len(gz)} bytes compressed).
+#ifndef INDEX_HTML_GZ_H
+#define INDEX_HTML_GZ_H
+
+#include <pgmspace.h>
+
+#define INDEX_HTML_ETAG {etag}
+
+const size_t index_html_gz_len = {len(gz)};
+
+const uint8_t index_html_gz[] PROGMEM = {{
+{array}
+}};
+
+#endif // INDEX_HTML_GZ_H
+"""
+
+with open('index_html_gz.h', 'w') as f:
+    f.write(header)
+
+print(f'index_html_gz.h: {len(html)} bytes -> {len(gz)} bytes, ETag {etag}')
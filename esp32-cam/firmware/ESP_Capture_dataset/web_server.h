@@ -3,9 +3,11 @@
 #define WEB_SERVER_H
 
 #include <WiFi.h>
+#include <SD_MMC.h>
 #include "esp_http_server.h"
 #include "esp_camera.h"
 #include "cam_config.h"
+#include "index_html_gz.h"  // Generated: see make_index_gz.py
 
 // External variables (defined in main .ino file)
 extern String currentPerson;
@@ -17,651 +19,89 @@ extern bool ledFlashEnabled;
 extern bool createPersonDirectory(String personName);
 extern int getImageCount(String personName);
 extern bool saveImage(camera_fb_t* fb, String personName, int imageNum);
+extern bool burstAvailable;
+extern int burstCaptureFrames(int count);
+extern int burstPendingCount();
+extern bool dswActive;
+extern uint32_t dswFrames;
+extern uint32_t dswDropped;
+extern uint32_t dswStartMs;
+extern bool dswStart(String person);
+extern void dswStop();
 
 // Server handles
 httpd_handle_t camera_httpd = NULL;
 httpd_handle_t stream_httpd = NULL;
 
+// MJPEG stream frame-rate cap. The handler sends straight from the
+// camera frame buffer, so without a cap a fast sensor can saturate the
+// WiFi link and starve the capture endpoints on port 80.
+#define STREAM_MAX_FPS 15
+#define STREAM_MIN_FRAME_MS (1000 / STREAM_MAX_FPS)
+
+// Client-aware pacing: if sending a frame took longer than this, the
+// client (or the WiFi link) is not keeping up and every frame the
+// sensor produced meanwhile is already stale. The handler then skips
+// the backlog and resumes from the freshest frame, so preview latency
+// stays bounded at one frame regardless of network conditions.
+#define STREAM_LAG_THRESHOLD_MS (2 * STREAM_MIN_FRAME_MS)
+
+// Stream health counters, reset per client connection. Written by the
+// stream task (port 81) and read by status_handler (port 80), hence
+// volatile.
+static volatile uint32_t streamFramesSent = 0;
+static volatile uint32_t streamFramesDropped = 0;
+
+// Burst capture: frames buffered as PSRAM copies and drained to SD
+// from loop(). Ring implementation lives in the main sketch.
+#define BURST_RING_SLOTS    12   // Max frames buffered in PSRAM at once
+#define BURST_DEFAULT_COUNT 8    // Frames per burst when none requested
+
+// Dataset writer: double-buffered SD streaming into pre-allocated
+// segment files. Writer implementation lives in the main sketch.
+#define DSW_BUFFER_BYTES    (64 * 1024)       // Each of the two PSRAM buffers
+#define DSW_SEGMENT_BYTES   (4 * 1024 * 1024) // Pre-allocated segment file size
+#define DSW_EXPORT_CHUNK    (8 * 1024)        // /export chunked-send size
+
 // Debug helper
 static inline void dbg(const char* msg) {
     Serial.println(msg);
 }
 
-// ==================== HTML WEB INTERFACE ====================
-String getIndexHTML() {
-    String resolutionLabel = SENSOR_NAME;
-    resolutionLabel += " Resolution:";
-    
-    String html = R"rawliteral(
-<!DOCTYPE html>
-<html>
-<head>
-    <title>ESP32-CAM Dataset Capture</title>
-    <meta name="viewport" content="width=device-width, initial-scale=1">
-    <style>
-        * { margin: 0; padding: 0; box-sizing: border-box; }
-        body {
-            font-family: Arial, sans-serif;
-            background: linear-gradient(135deg, #667eea 0%, #764ba2 100%);
-            min-height: 100vh;
-            padding: 20px;
-        }
-        .container {
-            max-width: 800px;
-            margin: 0 auto;
-            background: white;
-            border-radius: 20px;
-            box-shadow: 0 20px 60px rgba(0,0,0,0.3);
-            padding: 30px;
-        }
-        h1 {
-            color: #667eea;
-            text-align: center;
-            margin-bottom: 10px;
-            font-size: 28px;
-        }
-        .subtitle {
-            text-align: center;
-            color: #666;
-            margin-bottom: 30px;
-            font-size: 14px;
-        }
-        .sensor-badge {
-            background: #667eea;
-            color: white;
-            padding: 8px 16px;
-            border-radius: 20px;
-            font-size: 12px;
-            display: inline-block;
-            margin-bottom: 20px;
-        }
-        .status {
-            background: #f0f0f0;
-            padding: 15px;
-            border-radius: 10px;
-            margin-bottom: 20px;
-            text-align: center;
-        }
-        .status-item {
-            display: inline-block;
-            margin: 0 15px;
-            font-size: 14px;
-        }
-        .status-label {
-            font-weight: bold;
-            color: #667eea;
-        }
-        .input-group {
-            margin-bottom: 20px;
-        }
-        label {
-            display: block;
-            margin-bottom: 8px;
-            color: #333;
-            font-weight: bold;
-        }
-        input[type="text"], select {
-            width: 100%;
-            padding: 12px;
-            border: 2px solid #e0e0e0;
-            border-radius: 8px;
-            font-size: 16px;
-            transition: border 0.3s;
-        }
-        input[type="text"]:focus, select:focus {
-            outline: none;
-            border-color: #667eea;
-        }
-        .camera-container {
-            position: relative;
-            width: 100%;
-            padding-bottom: 75%;
-            background: #000;
-            border-radius: 10px;
-            overflow: hidden;
-            margin-bottom: 20px;
-        }
-        #stream {
-            position: absolute;
-            top: 0;
-            left: 0;
-            width: 100%;
-            height: 100%;
-            object-fit: contain;
-        }
-        .overlay {
-            position: absolute;
-            top: 10px;
-            left: 10px;
-            background: rgba(0,0,0,0.7);
-            color: white;
-            padding: 8px 12px;
-            border-radius: 5px;
-            font-size: 12px;
-        }
-        .controls {
-            display: grid;
-            grid-template-columns: repeat(auto-fit, minmax(150px, 1fr));
-            gap: 15px;
-            margin-bottom: 20px;
-        }
-        button {
-            padding: 15px;
-            border: none;
-            border-radius: 8px;
-            font-size: 16px;
-            font-weight: bold;
-            cursor: pointer;
-            transition: all 0.3s;
-            color: white;
-        }
-        .btn-primary {
-            background: linear-gradient(135deg, #667eea 0%, #764ba2 100%);
-        }
-        .btn-success {
-            background: linear-gradient(135deg, #11998e 0%, #38ef7d 100%);
-        }
-        .btn-warning {
-            background: linear-gradient(135deg, #f093fb 0%, #f5576c 100%);
-        }
-        .btn-info {
-            background: linear-gradient(135deg, #4facfe 0%, #00f2fe 100%);
-        }
-        button:hover {
-            transform: translateY(-2px);
-            box-shadow: 0 5px 15px rgba(0,0,0,0.3);
-        }
-        button:active {
-            transform: translateY(0);
-        }
-        button:disabled {
-            opacity: 0.5;
-            cursor: not-allowed;
-            transform: none;
-        }
-        .tips {
-            background: #fff3cd;
-            border-left: 4px solid #ffc107;
-            padding: 15px;
-            border-radius: 5px;
-            margin-top: 20px;
-        }
-        .tips h3 {
-            color: #856404;
-            margin-bottom: 10px;
-            font-size: 16px;
-        }
-        .tips ul {
-            margin-left: 20px;
-            color: #856404;
-        }
-        .tips li {
-            margin-bottom: 5px;
-            font-size: 14px;
-        }
-        .debug-panel {
-            background: #1a1a2e;
-            color: #0f0;
-            padding: 10px;
-            border-radius: 8px;
-            margin-top: 15px;
-            font-family: monospace;
-            font-size: 11px;
-            max-height: 150px;
-            overflow-y: auto;
-        }
-        .debug-panel h4 {
-            color: #4facfe;
-            margin-bottom: 8px;
-        }
-        .debug-log {
-            margin: 2px 0;
-        }
-        .debug-log.error { color: #f5576c; }
-        .debug-log.success { color: #38ef7d; }
-        .debug-log.info { color: #4facfe; }
-        .flash-indicator {
-            position: fixed;
-            top: 0;
-            left: 0;
-            width: 100%;
-            height: 100%;
-            background: white;
-            opacity: 0;
-            pointer-events: none;
-            transition: opacity 0.1s;
-        }
-        .flash-indicator.active {
-            opacity: 0.8;
-        }
-        @media (max-width: 600px) {
-            .container { padding: 15px; }
-            h1 { font-size: 24px; }
-            .controls { grid-template-columns: 1fr; }
-        }
-    </style>
-</head>
-<body>
-    <div class="flash-indicator" id="flashIndicator"></div>
-    <div class="container">
-        <h1>📸 Dataset Capture</h1>
-        <p class="subtitle">Capture high-quality training images for face recognition</p>
-        <div style="text-align: center;">
-            <span class="sensor-badge">)rawliteral";
-    
-    html += SENSOR_NAME;
-    html += R"rawliteral(</span>
-        </div>
-        
-        <div class="status">
-            <div class="status-item">
-                <span class="status-label">Person:</span>
-                <span id="currentPerson">Not set</span>
-            </div>
-            <div class="status-item">
-                <span class="status-label">Images:</span>
-                <span id="imageCount">0</span>
-            </div>
-            <div class="status-item">
-                <span class="status-label">SD Card:</span>
-                <span id="sdStatus">Checking...</span>
-            </div>
-        </div>
-
-        <div class="input-group">
-            <label for="personName">Person Name:</label>
-            <input type="text" id="personName" placeholder="Enter name (e.g., john_doe)" 
-                   pattern="[a-zA-Z0-9_]+" title="Use only letters, numbers, and underscores">
-        </div>
-
-        <div class="input-group">
-            <label for="resolution">)rawliteral";
-    
-    html += resolutionLabel;
-    html += R"rawliteral(</label>
-            <select id="resolution" onchange="changeResolution()">
-)rawliteral";
-    
-    html += getSupportedResolutionsHTML();
-    html += R"rawliteral(
-            </select>
-        </div>
-
-        <div class="input-group">
-            <label for="captureMode">Capture Mode:</label>
-            <select id="captureMode">
-                <option value="single">Single Shot</option>
-                <option value="burst">Burst (5 images)</option>
-                <option value="auto">Auto (1 per 2 seconds)</option>
-                <option value="stream">Continuous Stream</option>
-            </select>
-        </div>
-
-        <div class="input-group" style="display: flex; align-items: center; gap: 10px;">
-            <input type="checkbox" id="ledFlash" onchange="toggleLED()" style="width: auto; cursor: pointer;">
-            <label for="ledFlash" style="margin: 0; cursor: pointer;">💡 LED Flash</label>
-        </div>
-
-        <div class="camera-container">
-            <img id="stream" src="">
-            <div class="overlay" id="overlay">Ready</div>
-        </div>
-
-        <div class="controls">
-            <button class="btn-primary" onclick="setPersonName()">Set Name</button>
-            <button class="btn-success" onclick="captureImage()" id="captureBtn">Capture</button>
-            <button class="btn-warning" onclick="toggleAuto()" id="autoBtn">Start Auto</button>
-            <button class="btn-warning" onclick="toggleStream()" id="streamBtn" style="display:none;">Start Stream</button>
-            <button class="btn-info" onclick="resetCounter()">Reset Count</button>
-        </div>
-
-        <div class="debug-panel" id="debugPanel">
-            <h4>Debug Log:</h4>
-            <div id="debugLog"></div>
-        </div>
-
-        <div class="tips">
-            <h3>💡 Tips for Best Results:</h3>
-            <ul>
-)rawliteral";
-    
-    html += getSensorTipsHTML();
-    html += R"rawliteral(
-                <li>Capture 25-30 images per person minimum</li>
-                <li>Vary head angles and expressions</li>
-                <li>Different lighting conditions</li>
-                <li>Include glasses/hats if normally worn</li>
-                <li><strong>Use Continuous Stream</strong> mode to rapidly capture hundreds of images</li>
-            </ul>
-        </div>
-    </div>
-
-    <script>
-        let autoCapture = false;
-        let autoInterval = null;
-        let streamCapture = false;
-        let streamInterval = null;
-        let streamUrl = window.location.protocol + '//' + window.location.hostname + ':81/stream';
-
-        function debug(msg, type = 'info') {
-            const log = document.getElementById('debugLog');
-            const time = new Date().toLocaleTimeString();
-            const div = document.createElement('div');
-            div.className = 'debug-log ' + type;
-            div.textContent = '[' + time + '] ' + msg;
-            log.insertBefore(div, log.firstChild);
-            while(log.children.length > 20) {
-                log.removeChild(log.lastChild);
-            }
-            console.log('[DEBUG ' + type + ']', msg);
-        }
-
-        function updateOverlay(text) {
-            document.getElementById('overlay').textContent = text;
-        }
-
-        function flash() {
-            const indicator = document.getElementById('flashIndicator');
-            indicator.classList.add('active');
-            setTimeout(() => indicator.classList.remove('active'), 100);
-        }
-
-        function toggleLED() {
-            const enabled = document.getElementById('ledFlash').checked;
-            debug('LED flash: ' + (enabled ? 'enabled' : 'disabled'), 'info');
-            fetch('/toggle-led?enabled=' + (enabled ? '1' : '0'))
-                .then(r => r.json())
-                .then(data => {
-                    debug('LED toggle response: ' + JSON.stringify(data), 'success');
-                    updateOverlay(enabled ? '💡 Flash enabled' : '🌑 Flash disabled');
-                    setTimeout(() => updateOverlay('Ready'), 1500);
-                })
-                .catch(err => {
-                    debug('LED toggle error: ' + err, 'error');
-                });
-        }
-
-        document.getElementById('stream').src = streamUrl;
-        debug('Stream URL: ' + streamUrl, 'info');
-        debug('Sensor: )rawliteral";
-    
-    html += SENSOR_NAME;
-    html += R"rawliteral(', 'info');
-
-        fetch('/status')
-            .then(r => {
-                debug('Status response: ' + r.status, r.ok ? 'success' : 'error');
-                return r.json();
-            })
-            .then(data => {
-                debug('Status data: ' + JSON.stringify(data), 'success');
-                document.getElementById('sdStatus').textContent = 
-                    data.sdCard ? '✓ Ready' : '✗ Not Found';
-                document.getElementById('imageCount').textContent = data.imageCount;
-                if(data.currentPerson && data.currentPerson !== '') {
-                    document.getElementById('currentPerson').textContent = data.currentPerson;
-                    debug('Person already set: ' + data.currentPerson, 'success');
-                }
-                if(data.ledFlash !== undefined) {
-                    document.getElementById('ledFlash').checked = data.ledFlash;
-                    debug('LED flash state: ' + (data.ledFlash ? 'enabled' : 'disabled'), 'info');
-                }
-            })
-            .catch(err => {
-                document.getElementById('sdStatus').textContent = '? Error';
-                debug('Status fetch error: ' + err, 'error');
-            });
-
-        function setPersonName() {
-            const name = document.getElementById('personName').value.trim();
-            debug('Setting person name: "' + name + '"', 'info');
-            if(!name) {
-                debug('Name is empty!', 'error');
-                alert('Please enter a person name');
-                return;
-            }
-            if(!/^[a-zA-Z0-9_]+$/.test(name)) {
-                debug('Invalid name format', 'error');
-                alert('Use only letters, numbers, and underscores');
-                return;
-            }
-
-            fetch('/set-person?name=' + encodeURIComponent(name))
-                .then(r => {
-                    debug('set-person response: ' + r.status, r.ok ? 'success' : 'error');
-                    return r.json();
-                })
-                .then(data => {
-                    debug('set-person data: ' + JSON.stringify(data), data.success ? 'success' : 'error');
-                    if(data.success) {
-                        document.getElementById('currentPerson').textContent = name;
-                        updateOverlay('Ready to capture for ' + name);
-                        debug('Person set successfully: ' + name, 'success');
-                    } else {
-                        alert('Error: ' + data.message);
-                    }
-                })
-                .catch(err => {
-                    debug('set-person error: ' + err, 'error');
-                });
-        }
-
-        // Show/hide controls based on capture mode
-        document.getElementById('captureMode').addEventListener('change', function() {
-            const mode = this.value;
-            const captureBtn = document.getElementById('captureBtn');
-            const autoBtn = document.getElementById('autoBtn');
-            const streamBtn = document.getElementById('streamBtn');
-            
-            if(mode === 'stream') {
-                captureBtn.style.display = 'none';
-                autoBtn.style.display = 'none';
-                streamBtn.style.display = 'block';
-            } else if(mode === 'auto') {
-                captureBtn.style.display = 'none';
-                autoBtn.style.display = 'block';
-                streamBtn.style.display = 'none';
-            } else {
-                captureBtn.style.display = 'block';
-                autoBtn.style.display = 'none';
-                streamBtn.style.display = 'none';
-            }
-        });
-
-        function captureImage() {
-            const mode = document.getElementById('captureMode').value;
-            const person = document.getElementById('currentPerson').textContent;
-            debug('Capture clicked - Mode: ' + mode + ', Person: ' + person, 'info');
-            if(person === 'Not set') {
-                debug('No person set! Please set a name first.', 'error');
-                alert('Please set a person name first!');
-                return;
-            }
-            if(mode === 'burst') {
-                captureBurst();
-            } else {
-                captureSingle();
-            }
-        }
-
-        function captureSingle() {
-            debug('Capturing single image...', 'info');
-            updateOverlay('Capturing...');
-            flash();
-            fetch('/capture')
-                .then(r => {
-                    debug('Capture response: ' + r.status, r.ok ? 'success' : 'error');
-                    return r.json();
-                })
-                .then(data => {
-                    debug('Capture result: ' + JSON.stringify(data), data.success ? 'success' : 'error');
-                    if(data.success) {
-                        document.getElementById('imageCount').textContent = data.imageCount;
-                        updateOverlay('✓ Captured #' + data.imageCount);
-                    } else {
-                        updateOverlay('✗ Error: ' + data.message);
-                    }
-                })
-                .catch(err => {
-                    debug('Capture error: ' + err, 'error');
-                    updateOverlay('✗ Capture failed');
-                });
-        }
-
-        function captureBurst() {
-            let count = 0;
-            const total = 5;
-            const interval = setInterval(() => {
-                if(count >= total) {
-                    clearInterval(interval);
-                    updateOverlay('✓ Burst complete!');
-                    return;
-                }
-                updateOverlay(`Burst ${count + 1}/${total}...`);
-                flash();
-                fetch('/capture')
-                    .then(r => r.json())
-                    .then(data => {
-                        if(data.success) {
-                            document.getElementById('imageCount').textContent = data.imageCount;
-                        }
-                    });
-                count++;
-            }, 500);
-        }
-
-        function toggleAuto() {
-            const btn = document.getElementById('autoBtn');
-            const mode = document.getElementById('captureMode');
-            if(autoCapture) {
-                clearInterval(autoInterval);
-                autoCapture = false;
-                btn.textContent = 'Start Auto';
-                btn.className = 'btn-warning';
-                mode.disabled = false;
-                updateOverlay('Auto capture stopped');
-            } else {
-                mode.value = 'single';
-                mode.disabled = true;
-                autoCapture = true;
-                btn.textContent = 'Stop Auto';
-                btn.className = 'btn-warning';
-                autoInterval = setInterval(() => {
-                    captureSingle();
-                }, 2000);
-            }
-        }
-
-        function toggleStream() {
-            const btn = document.getElementById('streamBtn');
-            const mode = document.getElementById('captureMode');
-            const person = document.getElementById('currentPerson').textContent;
-            
-            if(streamCapture) {
-                debug('Stopping continuous stream...', 'info');
-                fetch('/stop-stream')
-                    .then(r => r.json())
-                    .then(data => {
-                        debug('Stream stopped: ' + JSON.stringify(data), 'success');
-                        streamCapture = false;
-                        btn.textContent = 'Start Stream';
-                        btn.className = 'btn-warning';
-                        mode.disabled = false;
-                        clearInterval(streamInterval);
-                        updateOverlay('Stream capture stopped - ' + data.totalCaptured + ' images');
-                        document.getElementById('imageCount').textContent = data.imageCount;
-                    })
-                    .catch(err => {
-                        debug('Stop stream error: ' + err, 'error');
-                    });
-            } else {
-                if(person === 'Not set') {
-                    debug('No person set! Please set a name first.', 'error');
-                    alert('Please set a person name first!');
-                    return;
-                }
-                debug('Starting continuous stream...', 'info');
-                streamCapture = true;
-                btn.textContent = 'Stop Stream';
-                mode.disabled = true;
-
-                function captureLoop() {
-                    if(!streamCapture) return;
-                    
-                    fetch('/capture')
-                        .then(r => r.json())
-                        .then(data => {
-                            if(data.success) {
-                                document.getElementById('imageCount').textContent = data.imageCount;
-                                updateOverlay('Streaming... ' + data.imageCount);
-                            }
-                            if(streamCapture) setTimeout(captureLoop, 200); // 5 imgs/sec
-                        });
-                }
-                captureLoop();
-                updateOverlay('Streaming... capturing images continuously');
-            }
-        }
-
-        function resetCounter() {
-            if(confirm('Reset image counter? (Images will NOT be deleted)')) {
-                fetch('/reset')
-                    .then r => r.json())
-                    .then(data => {
-                        document.getElementById('imageCount').textContent = '0';
-                        updateOverlay('Counter reset');
-                    });
-            }
-        }
+// ==================== HTTP HANDLERS ====================
 
-        function changeResolution() {
-            const res = document.getElementById('resolution').value;
-            const resNames = {'10':'UXGA','9':'SXGA','8':'XGA','7':'SVGA','6':'VGA','5':'CIF','4':'QVGA','3':'HQVGA','2':'QCIF','1':'QQVGA','17':'240x240'};
-            updateOverlay('Changing to ' + (resNames[res] || 'resolution') + '...');
-            
-            fetch('/control?var=framesize&val=' + res)
-                .then(r => {
-                    if(!r.ok) throw new Error('Request failed');
-                    return r.json();
-                })
-                .then(data => {
-                    if(data.success) {
-                        updateOverlay('✓ Resolution: ' + (resNames[res] || res));
-                        const stream = document.getElementById('stream');
-                        stream.src = '';
-                        setTimeout(() => {
-                            stream.src = streamUrl + '?' + Date.now();
-                        }, 200);
-                    } else {
-                        updateOverlay('✗ Failed to change resolution');
-                    }
-                })
-                .catch(err => {
-                    console.error('Resolution change error:', err);
-                    updateOverlay('✗ Resolution change failed');
-                });
-        }
+// The UI page is pre-compressed into PROGMEM (index_html_gz.h) and
+// served with a strong ETag: a reload costs a 304 instead of ~23 KB of
+// HTML re-rendered through String concatenation on every request.
+static esp_err_t index_handler(httpd_req_t *req) {
+    char etag[24];
+    if (httpd_req_get_hdr_value_str(req, "If-None-Match", etag, sizeof(etag)) == ESP_OK &&
+        strcmp(etag, INDEX_HTML_ETAG) == 0) {
+        httpd_resp_set_status(req, "304 Not Modified");
+        httpd_resp_set_hdr(req, "ETag", INDEX_HTML_ETAG);
+        return httpd_resp_send(req, NULL, 0);
+    }
 
-        document.getElementById('stream').onerror = function() {
-            updateOverlay('Stream error - retrying...');
-            setTimeout(() => {
-                document.getElementById('stream').src = streamUrl + '?' + Date.now();
-            }, 1000);
-        };
-    </script>
-</body>
-</html>
-)rawliteral";
-    
-    return html;
+    httpd_resp_set_type(req, "text/html");
+    httpd_resp_set_hdr(req, "Content-Encoding", "gzip");
+    httpd_resp_set_hdr(req, "ETag", INDEX_HTML_ETAG);
+    httpd_resp_set_hdr(req, "Cache-Control", "no-cache");
+    return httpd_resp_send(req, (const char*)index_html_gz, index_html_gz_len);
 }
 
-// ==================== HTTP HANDLERS ====================
+// Sensor-specific HTML fragments, fetched by the static page at load
+// time (the fragments depend on the sensor selected in cam_config.h,
+// which the pre-compressed page cannot bake in).
+static esp_err_t ui_resolutions_handler(httpd_req_t *req) {
+    String frag = getSupportedResolutionsHTML();
+    httpd_resp_set_type(req, "text/html");
+    return httpd_resp_send(req, frag.c_str(), frag.length());
+}
 
-static esp_err_t index_handler(httpd_req_t *req) {
-    String html = getIndexHTML();
+static esp_err_t ui_tips_handler(httpd_req_t *req) {
+    String frag = getSensorTipsHTML();
     httpd_resp_set_type(req, "text/html");
-    return httpd_resp_send(req, html.c_str(), html.length());
+    return httpd_resp_send(req, frag.c_str(), frag.length());
 }
 
 static esp_err_t stream_handler(httpd_req_t *req) {
@@ -669,7 +109,8 @@ static esp_err_t stream_handler(httpd_req_t *req) {
     esp_err_t res = ESP_OK;
     size_t _jpg_buf_len = 0;
     uint8_t * _jpg_buf = NULL;
-    char * part_buf[64];
+    char part_buf[64];
+    unsigned long last_frame_ms = 0;
 
     res = httpd_resp_set_type(req, "multipart/x-mixed-replace;boundary=frame");
     if(res != ESP_OK){
@@ -678,14 +119,30 @@ static esp_err_t stream_handler(httpd_req_t *req) {
 
     httpd_resp_set_hdr(req, "Access-Control-Allow-Origin", "*");
 
+    streamFramesSent = 0;
+    streamFramesDropped = 0;
+
     while(true){
+        // Frame-rate cap: pace before grabbing so the frame we send is
+        // fresh and a fast sensor cannot saturate the WiFi link
+        unsigned long now = millis();
+        if(last_frame_ms != 0 && (now - last_frame_ms) < STREAM_MIN_FRAME_MS){
+            vTaskDelay(pdMS_TO_TICKS(STREAM_MIN_FRAME_MS - (now - last_frame_ms)));
+        }
+        last_frame_ms = millis();
+
         fb = esp_camera_fb_get();
         if (!fb) {
             Serial.println("Camera capture failed");
             res = ESP_FAIL;
         } else {
-            // Always convert to JPEG if not already in JPEG format
-            if(fb->format != PIXFORMAT_JPEG){
+            if(fb->format == PIXFORMAT_JPEG){
+                // Zero-copy path: send straight from the driver's frame
+                // buffer; fb is held until the chunked send completes
+                _jpg_buf_len = fb->len;
+                _jpg_buf = fb->buf;
+            } else {
+                // Non-JPEG sensor mode - conversion is the only option
                 bool jpeg_converted = frame2jpg(fb, 80, &_jpg_buf, &_jpg_buf_len);
                 esp_camera_fb_return(fb);
                 fb = NULL;
@@ -693,14 +150,12 @@ static esp_err_t stream_handler(httpd_req_t *req) {
                     Serial.println("JPEG compression failed");
                     res = ESP_FAIL;
                 }
-            } else {
-                _jpg_buf_len = fb->len;
-                _jpg_buf = fb->buf;
             }
         }
+        unsigned long send_start_ms = millis();
         if(res == ESP_OK){
-            size_t hlen = snprintf((char *)part_buf, 64, "Content-Type: image/jpeg\r\nContent-Length: %u\r\n\r\n", _jpg_buf_len);
-            res = httpd_resp_send_chunk(req, (const char *)part_buf, hlen);
+            size_t hlen = snprintf(part_buf, sizeof(part_buf), "Content-Type: image/jpeg\r\nContent-Length: %u\r\n\r\n", _jpg_buf_len);
+            res = httpd_resp_send_chunk(req, part_buf, hlen);
         }
         if(res == ESP_OK){
             res = httpd_resp_send_chunk(req, (const char *)_jpg_buf, _jpg_buf_len);
@@ -719,6 +174,24 @@ static esp_err_t stream_handler(httpd_req_t *req) {
         if(res != ESP_OK){
             break;
         }
+        streamFramesSent = streamFramesSent + 1;
+
+        // Client fell behind: the blocked send is the send-queue depth
+        // signal. Count the frames the sensor produced meanwhile as
+        // dropped and resume from the freshest one - never replay the
+        // backlog.
+        unsigned long send_ms = millis() - send_start_ms;
+        if(send_ms > STREAM_LAG_THRESHOLD_MS){
+            streamFramesDropped = streamFramesDropped + (send_ms / STREAM_MIN_FRAME_MS);
+            if(INITIAL_GRAB_MODE == CAMERA_GRAB_WHEN_EMPTY){
+                // GRAB_LATEST already overwrites stale frames in the
+                // driver; the WHEN_EMPTY FIFO replays them, so return
+                // the queued frame unsent and recapture fresh
+                camera_fb_t* stale = esp_camera_fb_get();
+                if(stale) esp_camera_fb_return(stale);
+            }
+            last_frame_ms = 0;  // Already behind - skip the pacing delay
+        }
     }
     return res;
 }
@@ -767,6 +240,158 @@ static esp_err_t capture_handler(httpd_req_t *req) {
     return ESP_OK;
 }
 
+static esp_err_t burst_handler(httpd_req_t *req) {
+    dbg("[HTTP] /burst");
+    String response;
+
+    if(currentPerson == "") {
+        response = "{\"success\":false,\"message\":\"No person set\"}";
+    } else if(!sdCardAvailable) {
+        response = "{\"success\":false,\"message\":\"SD card not available\"}";
+    } else if(!burstAvailable) {
+        response = "{\"success\":false,\"message\":\"No PSRAM - burst unavailable\"}";
+    } else {
+        int count = 0;
+        char buf[50];
+        size_t buf_len = httpd_req_get_url_query_len(req) + 1;
+        if (buf_len > 1 && buf_len <= sizeof(buf)) {
+            if (httpd_req_get_url_query_str(req, buf, buf_len) == ESP_OK) {
+                char param[10];
+                if (httpd_query_key_value(buf, "count", param, sizeof(param)) == ESP_OK) {
+                    count = atoi(param);
+                }
+            }
+        }
+        if(count <= 0) count = BURST_DEFAULT_COUNT;
+
+#if defined(LED_GPIO_NUM)
+        if(ledFlashEnabled) digitalWrite(LED_GPIO_NUM, HIGH);
+#endif
+        uint32_t start = millis();
+        int captured = burstCaptureFrames(count);
+        uint32_t elapsed = millis() - start;
+#if defined(LED_GPIO_NUM)
+        if(ledFlashEnabled) digitalWrite(LED_GPIO_NUM, LOW);
+#endif
+
+        // Frames are saved to SD from loop(); respond as soon as the
+        // burst itself is in PSRAM so the next burst can be requested.
+        response = "{\"success\":true,\"captured\":" + String(captured) +
+                   ",\"burstMs\":" + String(elapsed) +
+                   ",\"pendingSave\":" + String(burstPendingCount()) + "}";
+        Serial.printf("[BURST] %d frames in %u ms (%d queued for SD)\n",
+                      captured, elapsed, burstPendingCount());
+    }
+
+    httpd_resp_set_type(req, "application/json");
+    httpd_resp_send(req, response.c_str(), response.length());
+    return ESP_OK;
+}
+
+static esp_err_t dataset_start_handler(httpd_req_t *req) {
+    dbg("[HTTP] /dataset-start");
+    String response;
+
+    char buf[100];
+    char param[32] = {0};
+    size_t buf_len = httpd_req_get_url_query_len(req) + 1;
+    if (buf_len > 1 && buf_len <= sizeof(buf)) {
+        if (httpd_req_get_url_query_str(req, buf, buf_len) == ESP_OK) {
+            httpd_query_key_value(buf, "name", param, sizeof(param));
+        }
+    }
+
+    if(param[0] == '\0') {
+        response = "{\"success\":false,\"message\":\"No name provided\"}";
+    } else if(dswActive) {
+        response = "{\"success\":false,\"message\":\"Writer already running\"}";
+    } else if(dswStart(String(param))) {
+        response = "{\"success\":true}";
+    } else {
+        response = "{\"success\":false,\"message\":\"Writer start failed\"}";
+    }
+
+    httpd_resp_set_type(req, "application/json");
+    httpd_resp_send(req, response.c_str(), response.length());
+    return ESP_OK;
+}
+
+static esp_err_t dataset_stop_handler(httpd_req_t *req) {
+    dbg("[HTTP] /dataset-stop");
+    uint32_t elapsed = millis() - dswStartMs;
+    dswStop();
+
+    float fps = elapsed ? (dswFrames * 1000.0f / elapsed) : 0.0f;
+    String response = "{\"success\":true,\"frames\":" + String(dswFrames) +
+                      ",\"dropped\":" + String(dswDropped) +
+                      ",\"elapsedMs\":" + String(elapsed) +
+                      ",\"fps\":" + String(fps, 1) + "}";
+
+    httpd_resp_set_type(req, "application/json");
+    httpd_resp_send(req, response.c_str(), response.length());
+    return ESP_OK;
+}
+
+// Bulk export: all of a person's segment files concatenated into one
+// chunked octet stream. The records are self-framing, so the desktop
+// splitter does not care where one segment ends and the next begins.
+static esp_err_t export_handler(httpd_req_t *req) {
+    dbg("[HTTP] /export");
+
+    char buf[100];
+    char param[32] = {0};
+    size_t buf_len = httpd_req_get_url_query_len(req) + 1;
+    if (buf_len > 1 && buf_len <= sizeof(buf)) {
+        if (httpd_req_get_url_query_str(req, buf, buf_len) == ESP_OK) {
+            httpd_query_key_value(buf, "name", param, sizeof(param));
+        }
+    }
+
+    if(param[0] == '\0' || !sdCardAvailable || dswActive) {
+        httpd_resp_set_type(req, "application/json");
+        httpd_resp_send(req, "{\"success\":false,\"message\":\"Bad request or writer busy\"}", -1);
+        return ESP_OK;
+    }
+
+    File dir = SD_MMC.open("/dataset/" + String(param));
+    if(!dir || !dir.isDirectory()) {
+        httpd_resp_set_type(req, "application/json");
+        httpd_resp_send(req, "{\"success\":false,\"message\":\"No such person\"}", -1);
+        return ESP_OK;
+    }
+
+    uint8_t* chunk = (uint8_t*)ps_malloc(DSW_EXPORT_CHUNK);
+    if(!chunk) {
+        httpd_resp_set_type(req, "application/json");
+        httpd_resp_send(req, "{\"success\":false,\"message\":\"Out of memory\"}", -1);
+        return ESP_OK;
+    }
+
+    httpd_resp_set_type(req, "application/octet-stream");
+    httpd_resp_set_hdr(req, "Content-Disposition", "attachment; filename=dataset.bin");
+
+    esp_err_t res = ESP_OK;
+    File file = dir.openNextFile();
+    while(file && res == ESP_OK) {
+        String name = String(file.name());
+        if(!file.isDirectory() && name.endsWith(".bin")) {
+            Serial.println("[DSW] Exporting " + name);
+            while(res == ESP_OK) {
+                size_t n = file.read(chunk, DSW_EXPORT_CHUNK);
+                if(n == 0) break;
+                res = httpd_resp_send_chunk(req, (const char*)chunk, n);
+            }
+        }
+        file = dir.openNextFile();
+    }
+
+    free(chunk);
+    if(res == ESP_OK) {
+        httpd_resp_send_chunk(req, NULL, 0);
+    }
+    return res;
+}
+
 static esp_err_t set_person_handler(httpd_req_t *req) {
     dbg("[HTTP] /set-person");
     char buf[100];
@@ -810,7 +435,11 @@ static esp_err_t status_handler(httpd_req_t *req) {
     String json = "{\"sdCard\":" + String(sdCardAvailable ? "true" : "false") +
                  ",\"imageCount\":" + String(imageCounter) +
                  ",\"currentPerson\":\"" + currentPerson + "\"" +
-                 ",\"ledFlash\":" + String(ledFlashEnabled ? "true" : "false") + "}";
+                 ",\"sensor\":\"" + SENSOR_NAME + "\"" +
+                 ",\"ledFlash\":" + String(ledFlashEnabled ? "true" : "false") +
+                 ",\"streamSent\":" + String(streamFramesSent) +
+                 ",\"streamDropped\":" + String(streamFramesDropped) +
+                 ",\"datasetWriter\":" + String(dswActive ? "true" : "false") + "}";
     
     httpd_resp_set_type(req, "application/json");
     httpd_resp_send(req, json.c_str(), json.length());
@@ -935,6 +564,7 @@ void startCameraServer() {
     httpd_config_t config = HTTPD_DEFAULT_CONFIG();
     config.server_port = 80;
     config.max_open_sockets = 7;
+    config.max_uri_handlers = 16;  // Default of 8 is exceeded by our endpoints
 
     httpd_uri_t index_uri = {
         .uri       = "/",
@@ -950,6 +580,48 @@ void startCameraServer() {
         .user_ctx  = NULL
     };
 
+    httpd_uri_t ui_resolutions_uri = {
+        .uri       = "/ui/resolutions",
+        .method    = HTTP_GET,
+        .handler   = ui_resolutions_handler,
+        .user_ctx  = NULL
+    };
+
+    httpd_uri_t ui_tips_uri = {
+        .uri       = "/ui/tips",
+        .method    = HTTP_GET,
+        .handler   = ui_tips_handler,
+        .user_ctx  = NULL
+    };
+
+    httpd_uri_t burst_uri = {
+        .uri       = "/burst",
+        .method    = HTTP_GET,
+        .handler   = burst_handler,
+        .user_ctx  = NULL
+    };
+
+    httpd_uri_t dataset_start_uri = {
+        .uri       = "/dataset-start",
+        .method    = HTTP_GET,
+        .handler   = dataset_start_handler,
+        .user_ctx  = NULL
+    };
+
+    httpd_uri_t dataset_stop_uri = {
+        .uri       = "/dataset-stop",
+        .method    = HTTP_GET,
+        .handler   = dataset_stop_handler,
+        .user_ctx  = NULL
+    };
+
+    httpd_uri_t export_uri = {
+        .uri       = "/export",
+        .method    = HTTP_GET,
+        .handler   = export_handler,
+        .user_ctx  = NULL
+    };
+
     httpd_uri_t set_person_uri = {
         .uri       = "/set-person",
         .method    = HTTP_GET,
@@ -1003,7 +675,13 @@ void startCameraServer() {
     dbg("[HTTP] Starting server on port 80...");
     if (httpd_start(&camera_httpd, &config) == ESP_OK) {
         httpd_register_uri_handler(camera_httpd, &index_uri);
+        httpd_register_uri_handler(camera_httpd, &ui_resolutions_uri);
+        httpd_register_uri_handler(camera_httpd, &ui_tips_uri);
         httpd_register_uri_handler(camera_httpd, &capture_uri);
+        httpd_register_uri_handler(camera_httpd, &burst_uri);
+        httpd_register_uri_handler(camera_httpd, &dataset_start_uri);
+        httpd_register_uri_handler(camera_httpd, &dataset_stop_uri);
+        httpd_register_uri_handler(camera_httpd, &export_uri);
         httpd_register_uri_handler(camera_httpd, &set_person_uri);
         httpd_register_uri_handler(camera_httpd, &status_uri);
         httpd_register_uri_handler(camera_httpd, &reset_uri);
@@ -22,11 +22,19 @@
 #include "../app/app_image_processor/app_image_processor.h"
 #include "../app/app_graphics/app_graphics.h"
 #include "../app/app_face_recognizer/app_face_recognizer.h"
+#if FACE_INDEX_ENABLED == STD_ON
+#include "../app/app_face_index/app_face_index.h"
+#endif
 #include "../app/app_mqtt_manager/app_mqtt_manager.h"
+#if BENCHMARK_MODE == STD_ON
+#include "../app/app_benchmark/app_benchmark.h"
+#endif
 
 // Model Data
 #include "../model/model_data.h"
 
+#include "../../../libraries/FaceRecognitionCommon/src/instrument.h"
+
 #include <Arduino.h>
 #include <WiFi.h>
 #include "soc/soc.h"
@@ -39,7 +47,289 @@ static State s_state = State::UNINITIALIZED;
 static app::FaceResult s_lastResult = {"Waiting...", -1, 0.0f, false, 0};
 static int s_framesProcessed = 0;
 static int s_facesRecognized = 0;
-static bool s_wifiConnected = false;
+static volatile bool s_wifiConnected = false;
+static volatile bool s_mqttInitialized = false;
+
+#if CAPTURE_PIPELINE_ENABLED == STD_ON
+// Capture pipeline: a dedicated task keeps the camera busy grabbing
+// frame N+1 while frame N is inside tfliteInvoke. The two-slot queue
+// carries owned camera_fb_t* pointers; whoever pops a frame releases it.
+static QueueHandle_t s_frameQueue = nullptr;
+static TaskHandle_t s_captureTaskHandle = nullptr;
+
+static void captureTask(void* parameter) {
+    camera_fb_t* fb = nullptr;
+
+    while (true) {
+        fb = hal::cameraCapture();
+        if (fb) {
+            // Block until the inference side frees a slot - with
+            // fb_count=2 the driver is already filling the next frame
+            if (xQueueSend(s_frameQueue, &fb, portMAX_DELAY) != pdTRUE) {
+                hal::cameraRelease(fb);
+            }
+        } else {
+            vTaskDelay(pdMS_TO_TICKS(10));
+        }
+    }
+}
+
+/**
+ * @brief Pop the next pipelined frame (released by the caller)
+ */
+static camera_fb_t* acquireFrame() {
+    camera_fb_t* fb = nullptr;
+    xQueueReceive(s_frameQueue, &fb, pdMS_TO_TICKS(CAPTURE_FRAME_TIMEOUT_MS));
+    return fb;
+}
+#else
+static camera_fb_t* acquireFrame() {
+    return hal::cameraCapture();
+}
+#endif
+
+#if MOTION_GATE_ENABLED == STD_ON
+// Motion gate: a coarse luma signature (one sample per grid cell) is
+// compared against the previous frame's. Static scenes skip the whole
+// preprocess+invoke path, so an empty kiosk queue costs almost nothing.
+static uint8_t s_motionSig[MOTION_GRID_ROWS * MOTION_GRID_COLS];
+static bool s_motionSigValid = false;
+static uint32_t s_lastMeanDiff = 0;  // Latest signature delta (result cache reads it)
+
+static bool sceneChanged(camera_fb_t* fb) {
+    INSTR_SCOPE("motion.gate");
+    const uint16_t* rgb565 = (const uint16_t*)fb->buf;
+    uint8_t sig[MOTION_GRID_ROWS * MOTION_GRID_COLS];
+    uint8_t diff[MOTION_GRID_ROWS * MOTION_GRID_COLS];
+    uint32_t totalDiff = 0;
+
+    for (int gy = 0; gy < MOTION_GRID_ROWS; gy++) {
+        int srcY = (gy * fb->height) / MOTION_GRID_ROWS + fb->height / (2 * MOTION_GRID_ROWS);
+        const uint16_t* row = rgb565 + srcY * fb->width;
+        for (int gx = 0; gx < MOTION_GRID_COLS; gx++) {
+            int srcX = (gx * fb->width) / MOTION_GRID_COLS + fb->width / (2 * MOTION_GRID_COLS);
+            uint16_t pixel = row[srcX];
+            // Cheap luma: (R + 2G + B) / 4 on the expanded channels
+            uint8_t r = ((pixel >> 11) & 0x1F) << 3;
+            uint8_t g = ((pixel >> 5) & 0x3F) << 2;
+            uint8_t b = (pixel & 0x1F) << 3;
+            uint8_t luma = (uint8_t)((r + 2 * g + b) >> 2);
+
+            int idx = gy * MOTION_GRID_COLS + gx;
+            sig[idx] = luma;
+            diff[idx] = (uint8_t)abs((int)luma - (int)s_motionSig[idx]);
+            totalDiff += diff[idx];
+        }
+    }
+
+    uint32_t meanDiff = totalDiff / (MOTION_GRID_ROWS * MOTION_GRID_COLS);
+    s_lastMeanDiff = meanDiff;
+    bool changed = !s_motionSigValid || meanDiff >= MOTION_DIFF_THRESHOLD;
+
+    // The per-cell diffs double as the crop tracker's activity map
+    if (s_motionSigValid) {
+        app::updateCropTracker(diff, MOTION_GRID_COLS, MOTION_GRID_ROWS);
+    }
+
+    memcpy(s_motionSig, sig, sizeof(s_motionSig));
+    s_motionSigValid = true;
+    return changed;
+}
+#endif
+
+#if RESULT_CACHE_ENABLED == STD_ON
+// Result cache: while the tracked guest holds still and the last fused
+// result was confident, re-running the model answers a question nobody
+// asked. Steady state at the kiosk costs one motion signature per frame
+// instead of a full preprocess+invoke, with a real inference at the
+// revalidation rate to catch the guest leaving or a face swap.
+static bool s_cacheArmed = false;
+static unsigned long s_cacheInferMs = 0;
+#endif
+
+#if FRAME_GOVERNOR_ENABLED == STD_ON
+/**
+ * @brief Milliseconds to sleep after a frame to hold the target rate
+ * @param frameMs Total latency of the frame just processed
+ * @param idle true when the motion gate skipped the frame
+ */
+static unsigned long governorSleepMs(unsigned long frameMs, bool idle) {
+    unsigned long period = idle ? (1000UL / GOVERNOR_IDLE_FPS)
+                                : (1000UL / GOVERNOR_TARGET_FPS);
+    return (frameMs >= period) ? 0 : (period - frameMs);
+}
+#endif
+
+#if INFERENCE_TASK_ENABLED == STD_ON
+// Inference runs in its own task pinned to core 1 so tfliteInvoke never
+// shares a core with the WiFi/MQTT stack (core 0). Finished FaceResults
+// travel back to run() through a small queue; labels are static strings
+// so the struct is safe to copy by value.
+static QueueHandle_t s_resultQueue = nullptr;
+static TaskHandle_t s_inferenceTaskHandle = nullptr;
+
+static void inferenceTask(void* parameter) {
+    while (true) {
+        if (!isReady()) {
+            vTaskDelay(pdMS_TO_TICKS(INFERENCE_DELAY_MS));
+            continue;
+        }
+
+        unsigned long frameStart = millis();
+        app::FaceResult result = processFrame();
+        // Drop the oldest result if the consumer is behind
+        if (xQueueSend(s_resultQueue, &result, 0) != pdTRUE) {
+            app::FaceResult stale;
+            xQueueReceive(s_resultQueue, &stale, 0);
+            xQueueSend(s_resultQueue, &result, 0);
+        }
+
+#if FRAME_GOVERNOR_ENABLED == STD_ON
+        unsigned long sleepMs = governorSleepMs(millis() - frameStart,
+                                                strcmp(result.label, "Idle") == 0);
+        if (sleepMs > 0) {
+            vTaskDelay(pdMS_TO_TICKS(sleepMs));
+        }
+#else
+        vTaskDelay(pdMS_TO_TICKS(INFERENCE_DELAY_MS));
+#endif
+    }
+}
+#endif
+
+#if WATCHDOG_ENABLED == STD_ON
+// Stage watchdog: the pipeline marks which stage it is in and when it
+// entered; a monitor task compares the elapsed time against the
+// stage's latency budget and rebuilds the stack when one blows, so a
+// post-brownout hang in cameraCapture or tfliteInvoke recovers in
+// seconds instead of waiting for a power cycle.
+enum class WdStage : uint8_t { IDLE = 0, CAPTURE, PREPROCESS, INFERENCE };
+
+static const char* const kWdStageNames[] = {
+    "idle", "capture", "preprocess", "inference"
+};
+static const uint32_t kWdBudgetMs[] = {
+    0, WATCHDOG_CAPTURE_BUDGET_MS, WATCHDOG_PREPROCESS_BUDGET_MS,
+    WATCHDOG_INFERENCE_BUDGET_MS
+};
+
+// Black-box trace of recent stage transitions, carried in the alert
+struct WdTraceEntry {
+    uint8_t stage;
+    uint32_t durMs;
+};
+
+static volatile WdStage s_wdStage = WdStage::IDLE;
+static volatile unsigned long s_wdEnterMs = 0;
+static volatile int s_wdCaptureFails = 0;
+static WdTraceEntry s_wdTrace[WATCHDOG_TRACE_DEPTH] = {};
+static int s_wdTraceNext = 0;
+static uint32_t s_wdRecoveries = 0;
+static volatile bool s_wdAlertPending = false;
+static char s_wdAlert[384];
+static TaskHandle_t s_wdTaskHandle = nullptr;
+
+static void wdEnterStage(WdStage stage) {
+    s_wdEnterMs = millis();
+    s_wdStage = stage;
+}
+
+static void wdExitStage() {
+    WdTraceEntry& e = s_wdTrace[s_wdTraceNext];
+    e.stage = (uint8_t)s_wdStage;
+    e.durMs = (uint32_t)(millis() - s_wdEnterMs);
+    s_wdTraceNext = (s_wdTraceNext + 1) % WATCHDOG_TRACE_DEPTH;
+    s_wdStage = WdStage::IDLE;
+}
+
+/**
+ * @brief Format the alert JSON (published later from run() on core 0)
+ */
+static void wdFormatAlert(WdStage stage, unsigned long heldMs) {
+    int len = snprintf(s_wdAlert, sizeof(s_wdAlert),
+                       "{\"stage\":\"%s\",\"held_ms\":%lu,\"recoveries\":%lu,"
+                       "\"uptime_ms\":%lu,\"trace\":[",
+                       kWdStageNames[(int)stage], heldMs,
+                       (unsigned long)(s_wdRecoveries + 1),
+                       (unsigned long)millis());
+
+    // Oldest to newest
+    for (int i = 0; i < WATCHDOG_TRACE_DEPTH && len < (int)sizeof(s_wdAlert); i++) {
+        const WdTraceEntry& e = s_wdTrace[(s_wdTraceNext + i) % WATCHDOG_TRACE_DEPTH];
+        len += snprintf(s_wdAlert + len, sizeof(s_wdAlert) - len,
+                        "%s{\"s\":\"%s\",\"ms\":%lu}",
+                        (i > 0) ? "," : "",
+                        kWdStageNames[e.stage], (unsigned long)e.durMs);
+    }
+    if (len > 0 && len < (int)sizeof(s_wdAlert) - 2) {
+        snprintf(s_wdAlert + len, sizeof(s_wdAlert) - len, "]}");
+    }
+}
+
+/**
+ * @brief Stage-level recovery: drop the stuck tasks, rebuild the stack
+ *
+ * init() only creates tasks whose handles are null, so clearing the
+ * handles here makes reset() recreate them fresh. Without the
+ * inference task the stages run inside the Arduino loop task, which
+ * cannot be deleted from here - a clean reboot is the only safe
+ * recovery in that configuration.
+ */
+static void wdRecover() {
+#if INFERENCE_TASK_ENABLED == STD_ON
+    if (s_inferenceTaskHandle) {
+        vTaskDelete(s_inferenceTaskHandle);
+        s_inferenceTaskHandle = nullptr;
+    }
+#if CAPTURE_PIPELINE_ENABLED == STD_ON
+    if (s_captureTaskHandle) {
+        vTaskDelete(s_captureTaskHandle);
+        s_captureTaskHandle = nullptr;
+    }
+    if (s_frameQueue) {
+        // Queued frames die with the camera driver - just empty the queue
+        camera_fb_t* fb = nullptr;
+        while (xQueueReceive(s_frameQueue, &fb, 0) == pdTRUE) {
+        }
+    }
+#endif
+    hal::cameraDeinit();
+    s_wdStage = WdStage::IDLE;
+    s_wdCaptureFails = 0;
+    s_wdRecoveries++;
+    reset();
+#else
+    Serial.println("[Watchdog] Inline pipeline stuck - rebooting");
+    delay(100);  // Let the message drain
+    esp_restart();
+#endif
+}
+
+static void watchdogTask(void* parameter) {
+    while (true) {
+        vTaskDelay(pdMS_TO_TICKS(WATCHDOG_CHECK_MS));
+
+        WdStage stage = s_wdStage;
+        unsigned long heldMs = millis() - s_wdEnterMs;
+        if (stage != s_wdStage) {
+            continue;  // Stage flipped mid-read - check again next tick
+        }
+
+        bool cameraDead = s_wdCaptureFails >= WATCHDOG_MAX_CAPTURE_FAILS;
+        if (cameraDead) {
+            stage = WdStage::CAPTURE;
+        } else if (stage == WdStage::IDLE || heldMs <= kWdBudgetMs[(int)stage]) {
+            continue;
+        }
+
+        Serial.printf("[Watchdog] Stage '%s' blew its budget (%lu ms held) - recovering\n",
+                      kWdStageNames[(int)stage], heldMs);
+        wdFormatAlert(stage, heldMs);
+        s_wdAlertPending = true;
+        wdRecover();
+    }
+}
+#endif  // WATCHDOG_ENABLED
 
 /**
  * @brief Initialize WiFi connection
@@ -49,18 +339,17 @@ static bool initWifi() {
     Serial.printf("[WiFi] Connecting to %s...\n", WIFI_SSID);
     WiFi.mode(WIFI_STA);
     WiFi.begin(WIFI_SSID, WIFI_PASSWORD);
-    
+
     unsigned long startTime = millis();
     while (WiFi.status() != WL_CONNECTED) {
         delay(500);
-        Serial.print(".");
         if (millis() - startTime > WIFI_CONNECT_TIMEOUT_MS) {
-            Serial.println("\n[WiFi] Connection timeout!");
+            Serial.println("[WiFi] Connection timeout!");
             return false;
         }
     }
-    
-    Serial.printf("\n[WiFi] Connected! IP: %s\n", WiFi.localIP().toString().c_str());
+
+    Serial.printf("[WiFi] Connected! IP: %s\n", WiFi.localIP().toString().c_str());
     s_wifiConnected = true;
     return true;
 #else
@@ -68,6 +357,36 @@ static bool initWifi() {
 #endif
 }
 
+#if ASYNC_BOOT_ENABLED == STD_ON
+/**
+ * @brief Bring up WiFi, NTP and MQTT without blocking boot
+ *
+ * Runs once alongside camera/TFLite init so recognition starts as soon
+ * as the local pipeline is ready; publishing is gated on the
+ * s_wifiConnected/s_mqttInitialized flags this task sets, so results
+ * simply start flowing out once the network arrives.
+ */
+static void networkTask(void* parameter) {
+    // Retry forever - a lobby power blip should not strand the kiosk
+    while (!s_wifiConnected) {
+        if (!initWifi()) {
+            vTaskDelay(pdMS_TO_TICKS(WIFI_RECONNECT_MS));
+        }
+    }
+
+#if MQTT_ENABLED == STD_ON
+    if (app::mqttManagerInit()) {
+        Serial.println("[OK] MQTT initialized");
+        s_mqttInitialized = true;
+    } else {
+        Serial.println("[WARN] MQTT initialization failed, continuing without MQTT");
+    }
+#endif
+
+    vTaskDelete(nullptr);
+}
+#endif
+
 bool init() {
     s_state = State::INITIALIZING;
     
@@ -85,6 +404,16 @@ bool init() {
         return false;
     }
 
+#if PSRAM_ARENA_ENABLED == STD_ON
+    // Carve the named PSRAM arenas before anything else touches PSRAM,
+    // while the heap is one contiguous free block
+    if (!hal::memoryArenaInit()) {
+        Serial.println("[ERROR] PSRAM arena init failed!");
+        s_state = State::ERROR;
+        return false;
+    }
+#endif
+
     // 2. Initialize HAL - LED
     hal::ledInit();
     Serial.println("[OK] LED initialized");
@@ -120,23 +449,95 @@ bool init() {
     }
     Serial.println("[OK] TFLite model loaded");
 
-    // 6. Initialize WiFi (required for MQTT)
+#if FACE_INDEX_ENABLED == STD_ON
+    // Load enrolled face vectors from NVS before the first frame
+    app::faceIndexInit();
+    Serial.printf("[OK] Face index loaded (%d vectors)\n", app::faceIndexCount());
+#endif
+
+#if BOOT_BENCH_ENABLED == STD_ON
+    // 5b. Per-boot self-calibration: time the hot path on a synthetic
+    // frame before any task starts; the report publishes once the
+    // broker is up (see run())
+    app::runBootBench();
+#endif
+
+    // 6/7. Bring up WiFi + NTP + MQTT. With async boot these run in
+    // their own task while the rest of init proceeds; recognition does
+    // not wait for the network.
+#if ASYNC_BOOT_ENABLED == STD_ON
+#if WIFI_ENABLED == STD_ON
+    if (!s_wifiConnected) {
+        xTaskCreatePinnedToCore(networkTask, "NetworkTask", NETWORK_TASK_STACK_SIZE,
+                                nullptr, NETWORK_TASK_PRIORITY, nullptr,
+                                NETWORK_TASK_CORE);
+        Serial.println("[OK] Network bring-up started in background");
+    }
+#endif
+#else
 #if WIFI_ENABLED == STD_ON
     if (!initWifi()) {
         Serial.println("[WARN] WiFi failed, continuing without network features");
     }
 #endif
-
-    // 7. Initialize MQTT (optional, don't fail if MQTT unavailable)
 #if MQTT_ENABLED == STD_ON
     if (s_wifiConnected) {
         if (app::mqttManagerInit()) {
             Serial.println("[OK] MQTT initialized");
+            s_mqttInitialized = true;
         } else {
             Serial.println("[WARN] MQTT initialization failed, continuing without MQTT");
         }
     }
 #endif
+#endif
+
+#if CAPTURE_PIPELINE_ENABLED == STD_ON
+    // 8. Start the capture pipeline task (survives reset() - create once)
+    if (!s_frameQueue) {
+        s_frameQueue = xQueueCreate(CAPTURE_QUEUE_DEPTH, sizeof(camera_fb_t*));
+        if (!s_frameQueue) {
+            Serial.println("[ERROR] Frame queue creation failed!");
+            s_state = State::ERROR;
+            return false;
+        }
+    }
+    if (!s_captureTaskHandle) {
+        xTaskCreatePinnedToCore(captureTask, "CaptureTask", CAPTURE_TASK_STACK_SIZE,
+                                nullptr, CAPTURE_TASK_PRIORITY, &s_captureTaskHandle,
+                                CAPTURE_TASK_CORE);
+    }
+    Serial.println("[OK] Capture pipeline started");
+#endif
+
+#if INFERENCE_TASK_ENABLED == STD_ON
+    // 9. Start the inference task on core 1 (survives reset() - create once)
+    if (!s_resultQueue) {
+        s_resultQueue = xQueueCreate(RESULT_QUEUE_DEPTH, sizeof(app::FaceResult));
+        if (!s_resultQueue) {
+            Serial.println("[ERROR] Result queue creation failed!");
+            s_state = State::ERROR;
+            return false;
+        }
+    }
+    s_state = State::READY;
+    if (!s_inferenceTaskHandle) {
+        xTaskCreatePinnedToCore(inferenceTask, "InferenceTask", INFERENCE_TASK_STACK_SIZE,
+                                nullptr, INFERENCE_TASK_PRIORITY, &s_inferenceTaskHandle,
+                                INFERENCE_TASK_CORE);
+    }
+    Serial.printf("[OK] Inference task pinned to core %d\n", INFERENCE_TASK_CORE);
+#endif
+
+#if WATCHDOG_ENABLED == STD_ON
+    // 10. Arm the stage watchdog (survives reset() - create once)
+    if (!s_wdTaskHandle) {
+        xTaskCreatePinnedToCore(watchdogTask, "WatchdogTask", WATCHDOG_TASK_STACK_SIZE,
+                                nullptr, WATCHDOG_TASK_PRIORITY, &s_wdTaskHandle,
+                                WATCHDOG_TASK_CORE);
+    }
+    Serial.println("[OK] Stage watchdog armed");
+#endif
 
     // Success
     s_state = State::READY;
@@ -154,30 +555,113 @@ app::FaceResult processFrame() {
     s_state = State::RUNNING;
     s_framesProcessed++;
 
-    // 1. Capture frame
-    camera_fb_t* fb = hal::cameraCapture();
+    // 1. Take the next frame from the capture pipeline
+#if WATCHDOG_ENABLED == STD_ON
+    wdEnterStage(WdStage::CAPTURE);
+#endif
+    camera_fb_t* fb = acquireFrame();
+#if WATCHDOG_ENABLED == STD_ON
+    wdExitStage();
+    // Repeated null frames mean the camera died without hanging the
+    // stage - the watchdog treats the streak like a blown budget
+    s_wdCaptureFails = fb ? 0 : s_wdCaptureFails + 1;
+#endif
     if (!fb) {
         Serial.println("[ERROR] Camera capture failed");
         result.label = "Capture Error";
         return result;
     }
 
+    // A thumbnail capture may briefly switch the sensor to JPEG; any
+    // frame the pipeline grabbed in that window is not inference input
+    if (fb->format != PIXFORMAT_RGB565) {
+        hal::cameraRelease(fb);
+        result.label = "Idle";
+        result.recognized = false;
+        s_state = State::READY;
+        return result;
+    }
+
+#if MOTION_GATE_ENABLED == STD_ON
+    bool sceneIsChanged = sceneChanged(fb);
+
+#if RESULT_CACHE_ENABLED == STD_ON
+    // 1b. Same guest, still standing there: the answer has not changed
+    // either - serve it from cache until the next revalidation slot
+    if (s_cacheArmed) {
+        if (s_lastMeanDiff > RESULT_CACHE_MOTION_MAX) {
+            // Too much motion for "same guest, same pose" - whoever is
+            // in frame now earns a fresh inference
+            s_cacheArmed = false;
+        } else if (millis() - s_cacheInferMs < RESULT_CACHE_REVALIDATE_MS) {
+            hal::cameraRelease(fb);
+            INSTR_COUNT("cache.result_hit");
+            result = s_lastResult;
+            result.inferenceTimeMs = 0;  // No invoke this frame
+            s_state = State::READY;
+            return result;
+        } else {
+            // Revalidation due - run the full pipeline even if the
+            // motion gate would have called the scene static
+            sceneIsChanged = true;
+        }
+    }
+#endif
+
+    // 1c. Skip inference entirely when the scene has not changed
+    if (!sceneIsChanged) {
+        hal::cameraRelease(fb);
+        // Stale scores must not vote on whoever walks up next
+        app::resetFusionWindow();
+        result.label = "Idle";
+        result.recognized = false;
+        s_state = State::READY;
+        return result;
+    }
+#endif
+
     // 2. Draw crop region (visual feedback)
+#if WATCHDOG_ENABLED == STD_ON
+    wdEnterStage(WdStage::PREPROCESS);
+#endif
     app::drawCropRegion(fb, COLOR_GREEN);
 
-    // 3. Preprocess image
+    // 3. Preprocess image. The interpreter lock is held from input-
+    //    tensor access through output decode so a /model/apply on
+    //    core 0 cannot rebuild the interpreter under this frame.
+    driver::tfliteLock();
+    if (!driver::tfliteIsReady()) {
+        // A failed model swap left no interpreter - skip this frame
+        driver::tfliteUnlock();
+        hal::cameraRelease(fb);
+#if WATCHDOG_ENABLED == STD_ON
+        wdExitStage();
+#endif
+        result.label = "Inference Error";
+        return result;
+    }
     TfLiteTensor* input = driver::tfliteGetInput();
     app::processImage(fb, input);
 
     // 4. Release frame buffer
     hal::cameraRelease(fb);
+#if WATCHDOG_ENABLED == STD_ON
+    wdExitStage();
+#endif
 
     // 5. Run inference
+#if WATCHDOG_ENABLED == STD_ON
+    wdEnterStage(WdStage::INFERENCE);
+#endif
     unsigned long startTime = millis();
     bool invokeOk = driver::tfliteInvoke();
     unsigned long inferenceTime = millis() - startTime;
+#if WATCHDOG_ENABLED == STD_ON
+    wdExitStage();
+#endif
 
     if (!invokeOk) {
+        driver::tfliteUnlock();
         Serial.println("[ERROR] Inference failed");
         result.label = "Inference Error";
         return result;
@@ -185,22 +669,26 @@ app::FaceResult processFrame() {
 
     // 6. Process output
     result = app::processOutput();
+    driver::tfliteUnlock();
     result.inferenceTimeMs = inferenceTime;
 
-    // 7. Visual feedback on recognition
+    // 7. Visual feedback on recognition (MQTT publish happens in run()
+    //    on core 0 so this path never touches the network stack)
     if (result.recognized) {
         hal::ledFlash(LED_FLASH_MS);
         s_facesRecognized++;
-        
-        // 8. Publish to MQTT if recognized
-#if MQTT_ENABLED == STD_ON
-        if (s_wifiConnected && app::isMqttReady()) {
-            app::publishFaceDetection(result);
-        }
-#endif
     }
 
     s_lastResult = result;
+
+#if RESULT_CACHE_ENABLED == STD_ON
+    // Arm (or refresh) the cache only on a confident match; anything
+    // weaker keeps the model in the loop every frame
+    s_cacheArmed = result.recognized &&
+                   result.confidence >= RESULT_CACHE_MIN_CONFIDENCE;
+    s_cacheInferMs = millis();
+#endif
+
     s_state = State::READY;
     return result;
 }
@@ -218,15 +706,105 @@ void run() {
         return;
     }
 
+#if BENCHMARK_MODE == STD_ON
+    // Benchmark build: one measured run, then sit and keep MQTT alive
+    // so the report can be pulled off the /bench topic
+    static bool s_benchDone = false;
+    if (!s_benchDone) {
+        app::runBenchmark(BENCHMARK_FRAMES);
+        s_benchDone = true;
+    }
+#if MQTT_ENABLED == STD_ON
+    if (s_wifiConnected && s_mqttInitialized) {
+        app::mqttManagerProcess();
+    }
+#endif
+    delay(1000);
+    return;
+#endif
+
+#if INSTRUMENT_ENABLED
+    // Periodic instrumentation report over Serial
+    static unsigned long s_lastInstrMs = 0;
+    if (millis() - s_lastInstrMs >= INSTR_REPORT_MS) {
+        s_lastInstrMs = millis();
+        INSTR_REPORT();
+    }
+#endif
+
     // Process MQTT events
 #if MQTT_ENABLED == STD_ON
-    if (s_wifiConnected) {
+    if (s_wifiConnected && s_mqttInitialized) {
         app::mqttManagerProcess();
+
+        // One-shot: report the tensor arena placement once the broker is up
+        static bool s_arenaReported = false;
+        if (!s_arenaReported && app::isMqttReady()) {
+            static char arenaTopic[256];
+            snprintf(arenaTopic, sizeof(arenaTopic),
+                     "%s/%s/arena", MQTT_TOPIC_BASE, MQTT_LOCATION);
+            hal::mqttPublish(arenaTopic, driver::tfliteGetArenaReport());
+            s_arenaReported = true;
+        }
+
+#if BOOT_BENCH_ENABLED == STD_ON
+        // One-shot: hot-path timings from this boot, tagged with the
+        // firmware version for per-rollout regression alerting
+        static bool s_bootBenchReported = false;
+        if (!s_bootBenchReported && app::isMqttReady()) {
+            static char bootBenchTopic[256];
+            snprintf(bootBenchTopic, sizeof(bootBenchTopic),
+                     "%s/%s/bench/boot", MQTT_TOPIC_BASE, MQTT_LOCATION);
+            hal::mqttPublish(bootBenchTopic, app::bootBenchReport());
+            s_bootBenchReported = true;
+        }
+#endif
+
+#if WATCHDOG_ENABLED == STD_ON
+        // Deferred watchdog alert - the network stack stays on core 0
+        if (s_wdAlertPending && app::isMqttReady()) {
+            static char wdTopic[256];
+            snprintf(wdTopic, sizeof(wdTopic),
+                     "%s/%s/watchdog", MQTT_TOPIC_BASE, MQTT_LOCATION);
+            hal::mqttPublish(wdTopic, s_wdAlert);
+            s_wdAlertPending = false;
+        }
+#endif
     }
 #endif
 
+#if INFERENCE_TASK_ENABLED == STD_ON
+    // Inference runs on core 1 - just wait for the next result here
+    app::FaceResult result;
+    if (xQueueReceive(s_resultQueue, &result, pdMS_TO_TICKS(INFERENCE_DELAY_MS)) != pdTRUE) {
+        return;
+    }
+#else
     // Process frame and get result
+    unsigned long frameStart = millis();
     app::FaceResult result = processFrame();
+#endif
+
+#if MOTION_GATE_ENABLED == STD_ON
+    // Static scene: no per-frame output, just a periodic heartbeat
+    if (strcmp(result.label, "Idle") == 0) {
+        static unsigned long s_lastHeartbeatMs = 0;
+        if (millis() - s_lastHeartbeatMs >= IDLE_HEARTBEAT_MS) {
+            s_lastHeartbeatMs = millis();
+            Serial.println("[Idle] Scene static, inference skipped");
+#if MQTT_ENABLED == STD_ON
+            if (s_wifiConnected && s_mqttInitialized && app::isMqttReady()) {
+                app::publishIdleHeartbeat();
+            }
+#endif
+        }
+#if INFERENCE_TASK_ENABLED != STD_ON && FRAME_GOVERNOR_ENABLED == STD_ON
+        // Idle pacing when inference runs inline in run()
+        delay(governorSleepMs(millis() - frameStart, true));
+#endif
+        return;
+    }
+#endif
 
     // Print result
     Serial.printf("[%lu ms] %s (%.1f%%)\n",
@@ -234,8 +812,32 @@ void run() {
                   result.label,
                   result.confidence * 100);
 
+    // Publish to MQTT if recognized (network stays on core 0)
+#if MQTT_ENABLED == STD_ON
+    if (result.recognized && s_wifiConnected && s_mqttInitialized && app::isMqttReady()) {
+        app::publishFaceDetection(result);
+
+#if THUMBNAIL_ENABLED == STD_ON
+        // Let the front desk audit the match - rate limited so a person
+        // standing at the kiosk does not flood the broker
+        static unsigned long s_lastThumbnailMs = 0;
+        if (millis() - s_lastThumbnailMs >= THUMBNAIL_MIN_INTERVAL_MS) {
+            s_lastThumbnailMs = millis();
+            app::publishFaceThumbnail();
+        }
+#endif
+    }
+#endif
+
+#if INFERENCE_TASK_ENABLED != STD_ON
+#if FRAME_GOVERNOR_ENABLED == STD_ON
+    // Sleep only the remainder of the target period
+    delay(governorSleepMs(millis() - frameStart, false));
+#else
     // Delay for target FPS
     delay(INFERENCE_DELAY_MS);
+#endif
+#endif
 }
 
 State getState() {
@@ -0,0 +1,191 @@
+/**
+ * @file app_benchmark.cpp
+ * @brief On-Device Inference Benchmark Implementation
+ */
+
+#include "app_benchmark.h"
+#include "../../app_cfg.h"
+
+#include "../../hal/hal_camera/hal_camera.h"
+#include "../../hal/hal_mqtt/hal_mqtt.h"
+#include "../app_face_recognizer/app_face_recognizer.h"
+#include "../app_image_processor/app_image_processor.h"
+#include "../../drivers/driver_tflite/driver_tflite.h"
+
+#include <Arduino.h>
+
+namespace app {
+
+// Per-stage sample buffers (microseconds)
+static uint32_t s_captureUs[BENCHMARK_FRAMES];
+static uint32_t s_preprocessUs[BENCHMARK_FRAMES];
+static uint32_t s_invokeUs[BENCHMARK_FRAMES];
+static uint32_t s_postprocessUs[BENCHMARK_FRAMES];
+
+/**
+ * @brief Sort samples in place and report min/median/p99
+ */
+static void stageStats(uint32_t* samples, int n,
+                       uint32_t* minOut, uint32_t* medOut, uint32_t* p99Out) {
+    // Insertion sort - n is small and this runs once
+    for (int i = 1; i < n; i++) {
+        uint32_t v = samples[i];
+        int j = i - 1;
+        while (j >= 0 && samples[j] > v) {
+            samples[j + 1] = samples[j];
+            j--;
+        }
+        samples[j + 1] = v;
+    }
+    *minOut = samples[0];
+    *medOut = samples[n / 2];
+    *p99Out = samples[(n * 99) / 100];
+}
+
+void runBenchmark(int frames) {
+    if (frames > BENCHMARK_FRAMES) {
+        frames = BENCHMARK_FRAMES;
+    }
+
+    Serial.printf("[Bench] Measuring %d frames...\n", frames);
+
+    size_t heapMin = ESP.getFreeHeap();
+    size_t psramMin = ESP.getFreePsram();
+    int measured = 0;
+    unsigned long runStart = millis();
+
+    while (measured < frames) {
+        unsigned long t0 = micros();
+        camera_fb_t* fb = hal::cameraCapture();
+        unsigned long t1 = micros();
+        if (!fb) {
+            continue;
+        }
+
+        TfLiteTensor* input = driver::tfliteGetInput();
+        processImage(fb, input);
+        unsigned long t2 = micros();
+        hal::cameraRelease(fb);
+
+        driver::tfliteInvoke();
+        unsigned long t3 = micros();
+
+        processOutput();
+        unsigned long t4 = micros();
+
+        s_captureUs[measured] = t1 - t0;
+        s_preprocessUs[measured] = t2 - t1;
+        s_invokeUs[measured] = t3 - t2;
+        s_postprocessUs[measured] = t4 - t3;
+        measured++;
+
+        size_t heap = ESP.getFreeHeap();
+        size_t psram = ESP.getFreePsram();
+        if (heap < heapMin) heapMin = heap;
+        if (psram < psramMin) psramMin = psram;
+    }
+
+    unsigned long runMs = millis() - runStart;
+    float fps = (runMs > 0) ? (measured * 1000.0f / runMs) : 0.0f;
+
+    uint32_t capMin, capMed, capP99;
+    uint32_t preMin, preMed, preP99;
+    uint32_t invMin, invMed, invP99;
+    uint32_t postMin, postMed, postP99;
+    stageStats(s_captureUs, measured, &capMin, &capMed, &capP99);
+    stageStats(s_preprocessUs, measured, &preMin, &preMed, &preP99);
+    stageStats(s_invokeUs, measured, &invMin, &invMed, &invP99);
+    stageStats(s_postprocessUs, measured, &postMin, &postMed, &postP99);
+
+    static char report[512];
+    snprintf(report, sizeof(report),
+             "{\"frames\":%d,\"fps\":%.2f,"
+             "\"capture_us\":{\"min\":%u,\"med\":%u,\"p99\":%u},"
+             "\"preprocess_us\":{\"min\":%u,\"med\":%u,\"p99\":%u},"
+             "\"invoke_us\":{\"min\":%u,\"med\":%u,\"p99\":%u},"
+             "\"postprocess_us\":{\"min\":%u,\"med\":%u,\"p99\":%u},"
+             "\"heap_min\":%u,\"psram_min\":%u,"
+             "\"arena_used\":%u}",
+             measured, fps,
+             capMin, capMed, capP99,
+             preMin, preMed, preP99,
+             invMin, invMed, invP99,
+             postMin, postMed, postP99,
+             (unsigned)heapMin, (unsigned)psramMin,
+             (unsigned)driver::tfliteGetArenaUsed());
+
+    // "BENCH:" prefix lets host-side tooling grep one line off the log
+    Serial.printf("BENCH:%s\n", report);
+
+    if (hal::mqttIsConnected()) {
+        static char benchTopic[256];
+        snprintf(benchTopic, sizeof(benchTopic),
+                 "%s/%s/bench", MQTT_TOPIC_BASE, MQTT_LOCATION);
+        hal::mqttPublishBinary(benchTopic, (const uint8_t*)report, strlen(report));
+    }
+}
+
+#if BOOT_BENCH_ENABLED == STD_ON
+
+static char s_bootReport[256] = "{}";
+
+void runBootBench() {
+    // Synthetic RGB565 frame - a deterministic gradient, so every boot
+    // and every unit measures exactly the same work
+    size_t len = (size_t)FRAME_WIDTH * FRAME_HEIGHT * 2;
+    uint8_t* buf = (uint8_t*)ps_malloc(len);
+    if (!buf) {
+        Serial.println("[Bench] Boot bench skipped - PSRAM allocation failed");
+        return;
+    }
+    for (size_t i = 0; i < len; i++) {
+        buf[i] = (uint8_t)(i * 31);
+    }
+
+    camera_fb_t fb = {};
+    fb.buf = buf;
+    fb.len = len;
+    fb.width = FRAME_WIDTH;
+    fb.height = FRAME_HEIGHT;
+    fb.format = PIXFORMAT_RGB565;
+
+    uint32_t preUs[BOOT_BENCH_ITERS];
+    uint32_t invUs[BOOT_BENCH_ITERS];
+    for (int i = 0; i < BOOT_BENCH_ITERS; i++) {
+        TfLiteTensor* input = driver::tfliteGetInput();
+        unsigned long t0 = micros();
+        processImage(&fb, input);
+        unsigned long t1 = micros();
+        driver::tfliteInvoke();
+        unsigned long t2 = micros();
+        preUs[i] = t1 - t0;
+        invUs[i] = t2 - t1;
+    }
+    free(buf);
+
+    // Too few samples for a p99 - min/median is what the per-version
+    // regression alert keys on
+    uint32_t preMin, preMed, preP99;
+    uint32_t invMin, invMed, invP99;
+    stageStats(preUs, BOOT_BENCH_ITERS, &preMin, &preMed, &preP99);
+    stageStats(invUs, BOOT_BENCH_ITERS, &invMin, &invMed, &invP99);
+
+    snprintf(s_bootReport, sizeof(s_bootReport),
+             "{\"version\":\"" FW_VERSION "\","
+             "\"build\":\"" __DATE__ " " __TIME__ "\","
+             "\"preprocess_us\":{\"min\":%u,\"med\":%u},"
+             "\"invoke_us\":{\"min\":%u,\"med\":%u},"
+             "\"arena_used\":%u}",
+             preMin, preMed, invMin, invMed,
+             (unsigned)driver::tfliteGetArenaUsed());
+
+    Serial.printf("BENCH-BOOT:%s\n", s_bootReport);
+}
+
+const char* bootBenchReport() {
+    return s_bootReport;
+}
+
+#endif  // BOOT_BENCH_ENABLED
+
+}  // namespace app
@@ -0,0 +1,43 @@
+/**
+ * @file app_benchmark.h
+ * @brief On-Device Inference Benchmark
+ *
+ * Runs N frames through capture -> preprocess -> invoke -> postprocess,
+ * records per-stage latency distributions and memory high-water marks,
+ * then emits a machine-readable report over Serial and MQTT.
+ */
+
+#ifndef APP_BENCHMARK_H
+#define APP_BENCHMARK_H
+
+namespace app {
+
+/**
+ * @brief Run the benchmark and emit the report
+ *
+ * Per-stage min/median/p99 latencies (microseconds), heap/PSRAM
+ * minimum-free marks and end-to-end FPS are printed as one JSON line
+ * prefixed with "BENCH:" and published on the /bench subtopic when the
+ * broker is reachable.
+ *
+ * @param frames Number of frames to measure
+ */
+void runBenchmark(int frames);
+
+/**
+ * @brief Per-boot self-calibration benchmark
+ *
+ * Times BOOT_BENCH_ITERS preprocess + invoke passes over a synthetic
+ * frame and stages a one-line JSON report tagged with FW_VERSION. Call
+ * before the pipeline tasks start so nothing contends the measurement.
+ */
+void runBootBench();
+
+/**
+ * @brief The staged boot-bench report (JSON, "{}" until runBootBench ran)
+ */
+const char* bootBenchReport();
+
+}  // namespace app
+
+#endif // APP_BENCHMARK_H
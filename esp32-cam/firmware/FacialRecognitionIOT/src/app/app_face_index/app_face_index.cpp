@@ -0,0 +1,358 @@
+/**
+ * @file app_face_index.cpp
+ * @brief On-Device Face Vector Index Implementation
+ */
+
+#include "app_face_index.h"
+#include "../../app_cfg.h"
+#include <Arduino.h>
+#include <Preferences.h>
+#include <cmath>
+#include <cstring>
+
+#if FACE_INDEX_ENABLED == STD_ON
+
+namespace app {
+
+namespace {
+
+constexpr uint8_t kIndexVersion = 1;
+
+struct IndexEntry {
+    char label[FACE_INDEX_LABEL_MAX];
+    float invNorm;  // 1/||v||, precomputed so matching is one dot product
+};
+
+// Vectors in one contiguous row-major block: matching N guests is a
+// sequential scan over N*FACE_INDEX_DIM bytes, which the cache
+// prefetcher handles, instead of pointer-chasing per entry
+int8_t s_vectors[FACE_INDEX_MAX_ENTRIES][FACE_INDEX_DIM] __attribute__((aligned(16)));
+IndexEntry s_entries[FACE_INDEX_MAX_ENTRIES];
+int s_count = 0;
+
+// Persisted blob layout: version, count, then count * (label + vector).
+// Norms are recomputed on load - they are derived data.
+struct PersistedEntry {
+    char label[FACE_INDEX_LABEL_MAX];
+    int8_t vector[FACE_INDEX_DIM];
+};
+
+struct PersistedIndex {
+    uint8_t version;
+    uint8_t count;
+    PersistedEntry entries[FACE_INDEX_MAX_ENTRIES];
+};
+
+/**
+ * @brief Integer dot product of two int8 vectors
+ *
+ * Unrolled by four to keep the accumulator chain busy; with int8 rows
+ * this is the densest matching loop the core can run without DSP
+ * extensions.
+ */
+int32_t dotInt8(const int8_t* a, const int8_t* b) {
+    int32_t acc = 0;
+    int i = 0;
+    for (; i + 4 <= FACE_INDEX_DIM; i += 4) {
+        acc += (int32_t)a[i]     * b[i];
+        acc += (int32_t)a[i + 1] * b[i + 1];
+        acc += (int32_t)a[i + 2] * b[i + 2];
+        acc += (int32_t)a[i + 3] * b[i + 3];
+    }
+    for (; i < FACE_INDEX_DIM; i++) {
+        acc += (int32_t)a[i] * b[i];
+    }
+    return acc;
+}
+
+float invNormOf(const int8_t* v) {
+    int32_t selfDot = dotInt8(v, v);
+    if (selfDot <= 0) {
+        return 0.0f;  // Degenerate (all-zero) vector - never matches
+    }
+    return 1.0f / sqrtf((float)selfDot);
+}
+
+int findLabel(const char* label) {
+    for (int i = 0; i < s_count; i++) {
+        if (strcmp(s_entries[i].label, label) == 0) {
+            return i;
+        }
+    }
+    return -1;
+}
+
+bool persist() {
+    static PersistedIndex blob;  // ~4.6 KB - keep off the stack
+
+    blob.version = kIndexVersion;
+    blob.count = (uint8_t)s_count;
+    for (int i = 0; i < s_count; i++) {
+        memcpy(blob.entries[i].label, s_entries[i].label, FACE_INDEX_LABEL_MAX);
+        memcpy(blob.entries[i].vector, s_vectors[i], FACE_INDEX_DIM);
+    }
+
+    Preferences prefs;
+    if (!prefs.begin("faceidx", false)) {
+        Serial.println("[FaceIndex] NVS open failed");
+        return false;
+    }
+    size_t written = prefs.putBytes("blob", &blob, sizeof(blob));
+    prefs.end();
+
+    if (written != sizeof(blob)) {
+        Serial.println("[FaceIndex] NVS write failed");
+        return false;
+    }
+    return true;
+}
+
+}  // namespace
+
+bool faceIndexInit() {
+    static PersistedIndex blob;
+
+    s_count = 0;
+
+    Preferences prefs;
+    if (!prefs.begin("faceidx", true)) {
+        // Namespace does not exist yet - empty index
+        Serial.println("[FaceIndex] No enrolled vectors");
+        return true;
+    }
+    size_t len = prefs.getBytes("blob", &blob, sizeof(blob));
+    prefs.end();
+
+    if (len == 0) {
+        Serial.println("[FaceIndex] No enrolled vectors");
+        return true;
+    }
+    if (len != sizeof(blob) || blob.version != kIndexVersion ||
+        blob.count > FACE_INDEX_MAX_ENTRIES) {
+        Serial.println("[FaceIndex] Stored index invalid - starting empty");
+        return true;
+    }
+
+    for (int i = 0; i < blob.count; i++) {
+        memcpy(s_entries[i].label, blob.entries[i].label, FACE_INDEX_LABEL_MAX);
+        s_entries[i].label[FACE_INDEX_LABEL_MAX - 1] = '\0';
+        memcpy(s_vectors[i], blob.entries[i].vector, FACE_INDEX_DIM);
+        s_entries[i].invNorm = invNormOf(s_vectors[i]);
+    }
+    s_count = blob.count;
+
+    Serial.printf("[FaceIndex] Loaded %d enrolled vectors\n", s_count);
+    return true;
+}
+
+int faceIndexCount() {
+    return s_count;
+}
+
+int faceIndexMatch(const int8_t* embedding, size_t dim, float* similarity) {
+    if (similarity) {
+        *similarity = 0.0f;
+    }
+    if (!embedding || s_count == 0) {
+        return -1;
+    }
+
+    // Queries shorter than the index dimension are zero-padded
+    int8_t query[FACE_INDEX_DIM] = {0};
+    if (dim > FACE_INDEX_DIM) {
+        dim = FACE_INDEX_DIM;
+    }
+    memcpy(query, embedding, dim);
+
+    float queryInvNorm = invNormOf(query);
+    if (queryInvNorm == 0.0f) {
+        return -1;
+    }
+
+    int best = -1;
+    float bestSim = -2.0f;
+    for (int i = 0; i < s_count; i++) {
+        float sim = (float)dotInt8(query, s_vectors[i])
+                    * queryInvNorm * s_entries[i].invNorm;
+        if (sim > bestSim) {
+            bestSim = sim;
+            best = i;
+        }
+    }
+
+    if (similarity) {
+        *similarity = bestSim;
+    }
+    return best;
+}
+
+const char* faceIndexLabel(int entry) {
+    if (entry < 0 || entry >= s_count) {
+        return "Unknown";
+    }
+    return s_entries[entry].label;
+}
+
+bool faceIndexEnroll(const char* label, const int8_t* embedding, size_t dim) {
+    if (!label || label[0] == '\0' || !embedding || dim == 0) {
+        return false;
+    }
+
+    char clean[FACE_INDEX_LABEL_MAX];
+    strncpy(clean, label, sizeof(clean) - 1);
+    clean[sizeof(clean) - 1] = '\0';
+
+    // Re-enrolling a known label updates its vector in place
+    int idx = findLabel(clean);
+    if (idx < 0) {
+        if (s_count >= FACE_INDEX_MAX_ENTRIES) {
+            Serial.println("[FaceIndex] Index full");
+            return false;
+        }
+        idx = s_count;
+    }
+
+    if (dim > FACE_INDEX_DIM) {
+        dim = FACE_INDEX_DIM;
+    }
+    memset(s_vectors[idx], 0, FACE_INDEX_DIM);
+    memcpy(s_vectors[idx], embedding, dim);
+
+    float invNorm = invNormOf(s_vectors[idx]);
+    if (invNorm == 0.0f) {
+        Serial.println("[FaceIndex] Rejecting zero vector");
+        return false;
+    }
+
+    strcpy(s_entries[idx].label, clean);
+    s_entries[idx].invNorm = invNorm;
+    if (idx == s_count) {
+        s_count++;
+    }
+
+    Serial.printf("[FaceIndex] Enrolled '%s' (%d/%d entries)\n",
+                  clean, s_count, FACE_INDEX_MAX_ENTRIES);
+    return persist();
+}
+
+bool faceIndexRemove(const char* label) {
+    if (!label) {
+        return false;
+    }
+
+    int idx = findLabel(label);
+    if (idx < 0) {
+        Serial.printf("[FaceIndex] '%s' not enrolled\n", label);
+        return false;
+    }
+
+    // Swap-remove keeps the scan range dense
+    s_count--;
+    if (idx != s_count) {
+        memcpy(s_vectors[idx], s_vectors[s_count], FACE_INDEX_DIM);
+        s_entries[idx] = s_entries[s_count];
+    }
+
+    Serial.printf("[FaceIndex] Removed '%s' (%d entries left)\n", label, s_count);
+    return persist();
+}
+
+// ==================== ENROLLMENT SESSION ====================
+// One session at a time: per-dimension int32 sums of live embeddings,
+// averaged into the enrolled vector when the frame target is reached.
+
+namespace {
+
+struct EnrollSession {
+    bool active;
+    char label[FACE_INDEX_LABEL_MAX];
+    int target;
+    int collected;
+    int32_t sums[FACE_INDEX_DIM];
+};
+
+EnrollSession s_session = {};
+
+// Completed-session result, consumed once by faceIndexSessionResult
+bool s_resultPending = false;
+bool s_resultEnrolled = false;
+char s_resultLabel[FACE_INDEX_LABEL_MAX] = {0};
+
+constexpr int kSessionMinFrames = 3;
+constexpr int kSessionMaxFrames = 100;
+
+}  // namespace
+
+bool faceIndexSessionStart(const char* label, int frames) {
+    if (s_session.active || !label || label[0] == '\0') {
+        return false;
+    }
+
+    if (frames < kSessionMinFrames) frames = kSessionMinFrames;
+    if (frames > kSessionMaxFrames) frames = kSessionMaxFrames;
+
+    memset(&s_session, 0, sizeof(s_session));
+    strncpy(s_session.label, label, sizeof(s_session.label) - 1);
+    s_session.target = frames;
+    s_session.active = true;
+
+    Serial.printf("[FaceIndex] Enrollment session for '%s': %d frames\n",
+                  s_session.label, frames);
+    return true;
+}
+
+bool faceIndexSessionActive() {
+    return s_session.active;
+}
+
+int faceIndexSessionFeed(const int8_t* embedding, size_t dim) {
+    if (!s_session.active || !embedding) {
+        return -1;
+    }
+
+    if (dim > FACE_INDEX_DIM) {
+        dim = FACE_INDEX_DIM;
+    }
+    for (size_t i = 0; i < dim; i++) {
+        s_session.sums[i] += embedding[i];
+    }
+    s_session.collected++;
+
+    int remaining = s_session.target - s_session.collected;
+    if (remaining > 0) {
+        return remaining;
+    }
+
+    // Session complete: enroll the mean vector
+    int8_t mean[FACE_INDEX_DIM];
+    for (int i = 0; i < FACE_INDEX_DIM; i++) {
+        int32_t avg = s_session.sums[i] / s_session.target;
+        if (avg > 127) avg = 127;
+        if (avg < -128) avg = -128;
+        mean[i] = (int8_t)avg;
+    }
+
+    s_resultEnrolled = faceIndexEnroll(s_session.label, mean, FACE_INDEX_DIM);
+    strcpy(s_resultLabel, s_session.label);
+    s_resultPending = true;
+    s_session.active = false;
+    return 0;
+}
+
+bool faceIndexSessionResult(char* labelOut, bool* enrolled) {
+    if (!s_resultPending) {
+        return false;
+    }
+    if (labelOut) {
+        strcpy(labelOut, s_resultLabel);
+    }
+    if (enrolled) {
+        *enrolled = s_resultEnrolled;
+    }
+    s_resultPending = false;
+    return true;
+}
+
+}  // namespace app
+
+#endif  // FACE_INDEX_ENABLED
@@ -0,0 +1,101 @@
+/**
+ * @file app_face_index.h
+ * @brief On-Device Face Vector Index
+ *
+ * Flat index of enrolled int8 face embeddings matched by cosine
+ * similarity. Enrollment is a data push (MQTT/NVS), not a model
+ * rebuild: vectors persist in NVS and survive reflashes.
+ */
+
+#ifndef APP_FACE_INDEX_H
+#define APP_FACE_INDEX_H
+
+#include <cstddef>
+#include <cstdint>
+
+namespace app {
+
+/**
+ * @brief Load enrolled vectors from NVS
+ * @return true on success (an empty index is success)
+ */
+bool faceIndexInit();
+
+/**
+ * @brief Number of enrolled vectors
+ * @return Entry count
+ */
+int faceIndexCount();
+
+/**
+ * @brief Match an embedding against the index - one linear scan
+ * @param embedding Query vector (int8, model output)
+ * @param dim Query dimensions (truncated to FACE_INDEX_DIM)
+ * @param similarity Best cosine similarity found (out, may be null)
+ * @return Best entry index, or -1 if the index is empty
+ */
+int faceIndexMatch(const int8_t* embedding, size_t dim, float* similarity);
+
+/**
+ * @brief Label of an enrolled entry
+ * @param entry Entry index from faceIndexMatch
+ * @return Label string (static storage), or "Unknown" if out of range
+ */
+const char* faceIndexLabel(int entry);
+
+/**
+ * @brief Enroll or update a vector and persist the index to NVS
+ * @param label Person label (truncated to FACE_INDEX_LABEL_MAX-1)
+ * @param embedding Enrollment vector
+ * @param dim Vector dimensions
+ * @return false if the index is full or the vector is degenerate
+ */
+bool faceIndexEnroll(const char* label, const int8_t* embedding, size_t dim);
+
+/**
+ * @brief Remove an enrolled label and persist the index to NVS
+ * @param label Label to remove
+ * @return false if the label was not enrolled
+ */
+bool faceIndexRemove(const char* label);
+
+/**
+ * @brief Start a batch enrollment session
+ *
+ * While a session is active the recognizer feeds each live embedding
+ * here instead of matching it; after the requested number of frames
+ * the accumulated mean vector is enrolled under the session label.
+ * Frames skipped by the motion gate never reach the session, so only
+ * frames with a subject in view contribute.
+ *
+ * @param label Label to enroll under
+ * @param frames Frames to accumulate (clamped to a sane range)
+ * @return false if a session is already running or the label is empty
+ */
+bool faceIndexSessionStart(const char* label, int frames);
+
+/**
+ * @brief Whether an enrollment session is collecting frames
+ * @return true while a session is active
+ */
+bool faceIndexSessionActive();
+
+/**
+ * @brief Feed one live embedding to the active session
+ * @param embedding Frame embedding (model output)
+ * @param dim Embedding dimensions
+ * @return Frames still needed, or 0 if the session just completed
+ */
+int faceIndexSessionFeed(const int8_t* embedding, size_t dim);
+
+/**
+ * @brief Consume the result of the last completed session
+ * @param labelOut Session label (out, FACE_INDEX_LABEL_MAX bytes)
+ * @param enrolled true if the mean vector was enrolled (out)
+ * @return true once per completed session, then false until the next
+ */
+bool faceIndexSessionResult(char* labelOut, bool* enrolled);
+
+}  // namespace app
+
+#endif // APP_FACE_INDEX_H
@@ -7,41 +7,150 @@
 #include "../../app_cfg.h"
 #include "../../model/class_labels.h"
 #include "../../drivers/driver_tflite/driver_tflite.h"
+#if FACE_INDEX_ENABLED == STD_ON
+#include "../app_face_index/app_face_index.h"
+#endif
 
 namespace app {
 
 static FaceResult s_lastResult = {"Unknown", -1, 0.0f, false, 0};
 static float s_confidenceThreshold = CONFIDENCE_THRESHOLD;
 
+// Temporal fusion operates on per-class score vectors; in embedding
+// mode the output tensor is a face vector, so the window does not apply
+#if TEMPORAL_FUSION_ENABLED == STD_ON && FACE_INDEX_ENABLED == STD_OFF
+// Sliding window of per-class score vectors. Each frame's vector is
+// fused with an exponentially decaying weight (newest frame weight 1,
+// one frame older FUSION_DECAY, and so on), which suppresses the
+// single-frame identity flicker the raw threshold produced.
+static float s_scoreWindow[FUSION_WINDOW_SIZE][NUM_CLASSES];
+static int s_windowNext = 0;    // Ring write position
+static int s_windowCount = 0;   // Frames currently in the window
+
+/**
+ * @brief Push the current score vector and compute the fused vector
+ * @param scores Current per-class scores (overwritten with fused values)
+ */
+static void fuseScores(float* scores) {
+    for (int i = 0; i < NUM_CLASSES; i++) {
+        s_scoreWindow[s_windowNext][i] = scores[i];
+    }
+    s_windowNext = (s_windowNext + 1) % FUSION_WINDOW_SIZE;
+    if (s_windowCount < FUSION_WINDOW_SIZE) {
+        s_windowCount++;
+    }
+
+    float fused[NUM_CLASSES] = {0};
+    float weight = 1.0f;
+    float weightSum = 0.0f;
+
+    // Walk from newest to oldest
+    for (int age = 0; age < s_windowCount; age++) {
+        int idx = (s_windowNext - 1 - age + FUSION_WINDOW_SIZE * 2) % FUSION_WINDOW_SIZE;
+        for (int i = 0; i < NUM_CLASSES; i++) {
+            fused[i] += s_scoreWindow[idx][i] * weight;
+        }
+        weightSum += weight;
+        weight *= FUSION_DECAY;
+    }
+
+    for (int i = 0; i < NUM_CLASSES; i++) {
+        scores[i] = fused[i] / weightSum;
+    }
+}
+#endif
+
+#if FACE_INDEX_ENABLED == STD_ON
 FaceResult processOutput() {
     FaceResult result = {"Unknown", -1, 0.0f, false, 0};
-    
+
     TfLiteTensor* output = driver::tfliteGetOutput();
     if (!output) {
         return result;
     }
 
-    float maxScore = 0.0f;
-    int maxIdx = 0;
+    // The backbone's output tensor is the embedding. int8 passes
+    // through untouched; uint8 is re-centered around its zero point so
+    // the dot products see a signed vector.
+    size_t dim = (size_t)output->dims->data[output->dims->size - 1];
+    if (dim > FACE_INDEX_DIM) {
+        dim = FACE_INDEX_DIM;
+    }
+
+    static int8_t embedding[FACE_INDEX_DIM];
+    if (output->type == kTfLiteInt8) {
+        for (size_t i = 0; i < dim; i++) {
+            embedding[i] = output->data.int8[i];
+        }
+    } else if (output->type == kTfLiteUInt8) {
+        int zp = output->params.zero_point;
+        for (size_t i = 0; i < dim; i++) {
+            int v = (int)output->data.uint8[i] - zp;
+            if (v > 127) v = 127;
+            if (v < -128) v = -128;
+            embedding[i] = (int8_t)v;
+        }
+    } else {
+        return result;  // Float backbones are not supported on-device
+    }
+
+    // An active enrollment session consumes the embedding instead of
+    // matching it - the same preprocess/invoke path produces both
+    if (faceIndexSessionActive()) {
+        faceIndexSessionFeed(embedding, dim);
+        result.label = "Enrolling";
+        s_lastResult = result;
+        return result;
+    }
+
+    float similarity = 0.0f;
+    int entry = faceIndexMatch(embedding, dim, &similarity);
+
+    result.confidence = similarity;
+    result.classIndex = entry;
+
+    if (entry >= 0 && similarity >= FACE_INDEX_THRESHOLD) {
+        result.label = faceIndexLabel(entry);
+        result.recognized = true;
+    }
+
+    s_lastResult = result;
+    return result;
+}
+#else
+FaceResult processOutput() {
+    FaceResult result = {"Unknown", -1, 0.0f, false, 0};
+
+    TfLiteTensor* output = driver::tfliteGetOutput();
+    if (!output) {
+        return result;
+    }
+
+    float scores[NUM_CLASSES] = {0};
 
     if (output->type == kTfLiteUInt8) {
         // Quantized output - dequantize
         for (int i = 0; i < NUM_CLASSES; i++) {
-            float score = (output->data.uint8[i] - output->params.zero_point)
-                          * output->params.scale;
-            if (score > maxScore) {
-                maxScore = score;
-                maxIdx = i;
-            }
+            scores[i] = (output->data.uint8[i] - output->params.zero_point)
+                        * output->params.scale;
         }
     } else if (output->type == kTfLiteFloat32) {
         // Float output
         for (int i = 0; i < NUM_CLASSES; i++) {
-            float score = output->data.f[i];
-            if (score > maxScore) {
-                maxScore = score;
-                maxIdx = i;
-            }
+            scores[i] = output->data.f[i];
+        }
+    }
+
+#if TEMPORAL_FUSION_ENABLED == STD_ON
+    fuseScores(scores);
+#endif
+
+    float maxScore = 0.0f;
+    int maxIdx = 0;
+    for (int i = 0; i < NUM_CLASSES; i++) {
+        if (scores[i] > maxScore) {
+            maxScore = scores[i];
+            maxIdx = i;
         }
     }
 
@@ -59,6 +168,14 @@ FaceResult processOutput() {
     s_lastResult = result;
     return result;
 }
+#endif  // FACE_INDEX_ENABLED
+
+void resetFusionWindow() {
+#if TEMPORAL_FUSION_ENABLED == STD_ON && FACE_INDEX_ENABLED == STD_OFF
+    s_windowNext = 0;
+    s_windowCount = 0;
+#endif
+}
 
 FaceResult getLastResult() {
     return s_lastResult;
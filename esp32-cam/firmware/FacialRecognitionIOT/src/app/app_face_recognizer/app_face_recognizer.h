@@ -47,6 +47,13 @@ void setConfidenceThreshold(float threshold);
  */
 float getConfidenceThreshold();
 
+/**
+ * @brief Clear the temporal fusion window
+ * @note Call when the scene changes discontinuously (e.g. after a long
+ *       idle period) so stale scores do not vote on the new subject.
+ */
+void resetFusionWindow();
+
 }  // namespace app
 
 #endif // APP_FACE_RECOGNIZER_H
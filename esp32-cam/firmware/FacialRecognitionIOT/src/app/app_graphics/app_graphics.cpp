@@ -5,6 +5,7 @@
 
 #include "app_graphics.h"
 #include "../../app_cfg.h"
+#include "../app_image_processor/app_image_processor.h"
 
 namespace app {
 
@@ -43,7 +44,10 @@ void drawBox(camera_fb_t* fb, int x, int y, int w, int h,
 }
 
 void drawCropRegion(camera_fb_t* fb, uint16_t color) {
-    drawBox(fb, CROP_X_OFFSET, CROP_Y_OFFSET, CROP_SIZE, CROP_SIZE, color);
+    // Draw the window actually being sampled (tracked or fixed)
+    int x, y, size;
+    getCropWindow(&x, &y, &size);
+    drawBox(fb, x, y, size, size, color);
 }
 
 }  // namespace app
@@ -1,10 +1,18 @@
 /**
  * @file app_image_processor.cpp
  * @brief Image Processing Implementation
+ *
+ * Thin wrapper over the shared preprocessing kernel in
+ * libraries/FaceRecognitionCommon, parameterized with this firmware's
+ * crop geometry from app_cfg.h. Kernel optimizations (coordinate maps,
+ * channel/normalization LUTs, row-wise writes) live in the library so
+ * both camera firmwares pick them up at once.
  */
 
 #include "app_image_processor.h"
 #include "../../app_cfg.h"
+#include "../../../../libraries/FaceRecognitionCommon/src/face_preprocess.h"
+#include "../../../../libraries/FaceRecognitionCommon/src/instrument.h"
 
 namespace app {
 
@@ -14,70 +22,123 @@ void rgb565ToRgb888(uint16_t pixel, uint8_t* r, uint8_t* g, uint8_t* b) {
     *b = (pixel & 0x1F) << 3;
 }
 
-void processImage(camera_fb_t* fb, TfLiteTensor* input) {
-    if (!fb || !input) return;
-
-    // Crop settings from app_cfg.h
-    int minSide = CROP_SIZE;
-    int cropXStart = CROP_X_OFFSET;
-    int cropYStart = CROP_Y_OFFSET;
-
-    uint16_t* rgb565 = (uint16_t*)fb->buf;
-
-    if (input->type == kTfLiteUInt8) {
-        // Quantized model - uint8 input [0-255]
-        uint8_t* inputData = input->data.uint8;
-
-        for (int y = 0; y < MODEL_INPUT_HEIGHT; y++) {
-            for (int x = 0; x < MODEL_INPUT_WIDTH; x++) {
-                // Map output coords to cropped input coords
-                int srcX = cropXStart + (x * minSide) / MODEL_INPUT_WIDTH;
-                int srcY = cropYStart + (y * minSide) / MODEL_INPUT_HEIGHT;
+#if CROP_TRACK_ENABLED == STD_ON && MOTION_GATE_ENABLED == STD_ON
+// Tracked crop window, eased toward the active region each frame.
+// Starts at (and decays back to) the fixed geometry from app_cfg.h.
+static int s_cropX = CROP_X_OFFSET;
+static int s_cropY = CROP_Y_OFFSET;
+static int s_cropSize = CROP_SIZE;
+static int s_quietFrames = 0;
+
+static int clampInt(int v, int lo, int hi) {
+    if (v < lo) return lo;
+    if (v > hi) return hi;
+    return v;
+}
 
-                // Clamp to valid range
-                if (srcX >= (int)fb->width) srcX = fb->width - 1;
-                if (srcY >= (int)fb->height) srcY = fb->height - 1;
+void updateCropTracker(const uint8_t* diffMap, int cols, int rows) {
+    // Weighted centroid and bounding box of the cells with activity
+    uint32_t weightSum = 0;
+    uint32_t cxSum = 0, cySum = 0;
+    int minGx = cols, maxGx = -1, minGy = rows, maxGy = -1;
+
+    for (int gy = 0; gy < rows; gy++) {
+        for (int gx = 0; gx < cols; gx++) {
+            uint8_t diff = diffMap[gy * cols + gx];
+            if (diff < MOTION_DIFF_THRESHOLD) {
+                continue;
+            }
+            weightSum += diff;
+            cxSum += (uint32_t)diff * gx;
+            cySum += (uint32_t)diff * gy;
+            if (gx < minGx) minGx = gx;
+            if (gx > maxGx) maxGx = gx;
+            if (gy < minGy) minGy = gy;
+            if (gy > maxGy) maxGy = gy;
+        }
+    }
 
-                int srcIdx = srcY * fb->width + srcX;
-                uint16_t pixel = rgb565[srcIdx];
+    int targetX, targetY, targetSize;
+    if (weightSum == 0) {
+        // Quiet frame - after enough of them, drift home so a guest
+        // approaching off-center is not missed by a stale window
+        if (++s_quietFrames < CROP_TRACK_DECAY_FRAMES) {
+            return;
+        }
+        targetX = CROP_X_OFFSET;
+        targetY = CROP_Y_OFFSET;
+        targetSize = CROP_SIZE;
+    } else {
+        s_quietFrames = 0;
+
+        const int cellW = FRAME_WIDTH / cols;
+        const int cellH = FRAME_HEIGHT / rows;
+
+        // One cell of margin around the active bounding box
+        int extentW = (maxGx - minGx + 3) * cellW;
+        int extentH = (maxGy - minGy + 3) * cellH;
+        targetSize = (extentW > extentH) ? extentW : extentH;
+        targetSize = clampInt(targetSize, CROP_TRACK_MIN_SIZE, CROP_SIZE);
+
+        // Center the window on the diff-weighted centroid
+        int centerX = (int)((cxSum / weightSum) * cellW + cellW / 2);
+        int centerY = (int)((cySum / weightSum) * cellH + cellH / 2);
+        targetX = clampInt(centerX - targetSize / 2, 0, FRAME_WIDTH - targetSize);
+        targetY = clampInt(centerY - targetSize / 2, 0, FRAME_HEIGHT - targetSize);
+    }
 
-                // Extract RGB
-                uint8_t r, g, b;
-                rgb565ToRgb888(pixel, &r, &g, &b);
+    // Ease toward the target so sensor noise cannot make the window
+    // jump (every jump rebuilds the preprocess coordinate maps)
+    s_cropX += ((targetX - s_cropX) * CROP_TRACK_SMOOTH_NUM) / CROP_TRACK_SMOOTH_DEN;
+    s_cropY += ((targetY - s_cropY) * CROP_TRACK_SMOOTH_NUM) / CROP_TRACK_SMOOTH_DEN;
+    s_cropSize += ((targetSize - s_cropSize) * CROP_TRACK_SMOOTH_NUM) / CROP_TRACK_SMOOTH_DEN;
+    s_cropX = clampInt(s_cropX, 0, FRAME_WIDTH - s_cropSize);
+    s_cropY = clampInt(s_cropY, 0, FRAME_HEIGHT - s_cropSize);
+}
 
-                // Store as uint8 (0-255)
-                int outIdx = (y * MODEL_INPUT_WIDTH + x) * 3;
-                inputData[outIdx + 0] = r;
-                inputData[outIdx + 1] = g;
-                inputData[outIdx + 2] = b;
-            }
-        }
-    } else if (input->type == kTfLiteFloat32) {
-        // Float model - normalize to [-1, 1]
-        float* inputData = input->data.f;
+void resetCropTracker() {
+    s_cropX = CROP_X_OFFSET;
+    s_cropY = CROP_Y_OFFSET;
+    s_cropSize = CROP_SIZE;
+    s_quietFrames = 0;
+}
 
-        for (int y = 0; y < MODEL_INPUT_HEIGHT; y++) {
-            for (int x = 0; x < MODEL_INPUT_WIDTH; x++) {
-                int srcX = cropXStart + (x * minSide) / MODEL_INPUT_WIDTH;
-                int srcY = cropYStart + (y * minSide) / MODEL_INPUT_HEIGHT;
+void getCropWindow(int* x, int* y, int* size) {
+    if (x) *x = s_cropX;
+    if (y) *y = s_cropY;
+    if (size) *size = s_cropSize;
+}
 
-                if (srcX >= (int)fb->width) srcX = fb->width - 1;
-                if (srcY >= (int)fb->height) srcY = fb->height - 1;
+void processImage(camera_fb_t* fb, TfLiteTensor* input) {
+    INSTR_SCOPE("preprocess");
+    facerec::CropGeometry geo = {
+        FRAME_WIDTH, FRAME_HEIGHT,
+        s_cropSize, s_cropX, s_cropY
+    };
+    facerec::preprocessRgb565(fb, input, geo);
+}
+#else
+void updateCropTracker(const uint8_t* diffMap, int cols, int rows) {
+    (void)diffMap; (void)cols; (void)rows;
+}
 
-                int srcIdx = srcY * fb->width + srcX;
-                uint16_t pixel = rgb565[srcIdx];
+void resetCropTracker() {
+}
 
-                uint8_t r, g, b;
-                rgb565ToRgb888(pixel, &r, &g, &b);
+void getCropWindow(int* x, int* y, int* size) {
+    if (x) *x = CROP_X_OFFSET;
+    if (y) *y = CROP_Y_OFFSET;
+    if (size) *size = CROP_SIZE;
+}
 
-                // Normalize to [-1, 1] for MobileNetV2
-                int outIdx = (y * MODEL_INPUT_WIDTH + x) * 3;
-                inputData[outIdx + 0] = (r / 127.5f) - 1.0f;
-                inputData[outIdx + 1] = (g / 127.5f) - 1.0f;
-                inputData[outIdx + 2] = (b / 127.5f) - 1.0f;
-            }
-        }
-    }
+void processImage(camera_fb_t* fb, TfLiteTensor* input) {
+    INSTR_SCOPE("preprocess");
+    facerec::CropGeometry geo = {
+        FRAME_WIDTH, FRAME_HEIGHT,
+        CROP_SIZE, CROP_X_OFFSET, CROP_Y_OFFSET
+    };
+    facerec::preprocessRgb565(fb, input, geo);
 }
+#endif
 
 }  // namespace app
@@ -32,6 +32,34 @@ void processImage(camera_fb_t* fb, TfLiteTensor* input);
  */
 void rgb565ToRgb888(uint16_t pixel, uint8_t* r, uint8_t* g, uint8_t* b);
 
+/**
+ * @brief Feed the motion gate's per-cell luma diffs to the crop tracker
+ *
+ * Estimates the active region from cells above MOTION_DIFF_THRESHOLD
+ * and eases the crop window toward it; processImage then samples the
+ * tracked window instead of the fixed one. No-op unless CROP_TRACK is
+ * enabled.
+ *
+ * @param diffMap Per-cell absolute luma deltas, row-major
+ * @param cols Grid columns (MOTION_GRID_COLS)
+ * @param rows Grid rows (MOTION_GRID_ROWS)
+ */
+void updateCropTracker(const uint8_t* diffMap, int cols, int rows);
+
+/**
+ * @brief Snap the crop window back to the fixed default
+ * @note Call on scene resets (e.g. after a long idle period).
+ */
+void resetCropTracker();
+
+/**
+ * @brief Current crop window (tracked, or the fixed default)
+ * @param x Crop X offset (out)
+ * @param y Crop Y offset (out)
+ * @param size Crop side length (out)
+ */
+void getCropWindow(int* x, int* y, int* size);
+
 }  // namespace app
 
 #endif // APP_IMAGE_PROCESSOR_H
@@ -5,8 +5,17 @@
 
 #include "app_mqtt_manager.h"
 #include "../../app_cfg.h"
+#include "../../hal/hal_camera/hal_camera.h"
 #include "../../hal/hal_mqtt/hal_mqtt.h"
+#if FACE_INDEX_ENABLED == STD_ON
+#include "../app_face_index/app_face_index.h"
+#endif
+#if MODEL_AB_ENABLED == STD_ON
+#include "../../drivers/driver_tflite/driver_tflite.h"
+#endif
 #include <Arduino.h>
+#include <stdlib.h>
+#include <string.h>
 #include <time.h>
 
 namespace app {
@@ -16,6 +25,184 @@ static int s_totalFrames = 0;
 static int s_totalRecognized = 0;
 static bool s_timeIsSynced = false;
 
+static const char* getTimestampISO8601();
+
+#if FACE_INDEX_ENABLED == STD_ON
+static char s_enrollTopic[256] = {0};
+static char s_removeTopic[256] = {0};
+static char s_sessionTopic[256] = {0};
+static char s_indexStatusTopic[256] = {0};
+
+/**
+ * @brief Handle index-maintenance messages
+ *
+ * Enroll payload: "<label>:" followed by the raw int8 embedding bytes.
+ * Remove payload: the label as plain text.
+ * Session payload: "<label>:<frames>" - starts a live enrollment
+ * session; the recognizer accumulates that many embeddings on-device.
+ */
+static void handleIndexMessage(const char* topic, const uint8_t* payload,
+                               unsigned int length) {
+    if (strcmp(topic, s_sessionTopic) == 0) {
+        char header[FACE_INDEX_LABEL_MAX + 12];
+        size_t headerLen = length < sizeof(header) - 1 ? length : sizeof(header) - 1;
+        memcpy(header, payload, headerLen);
+        header[headerLen] = '\0';
+
+        char* sep = strchr(header, ':');
+        if (!sep || sep == header) {
+            Serial.println("[App MQTT] Malformed session payload");
+            return;
+        }
+        *sep = '\0';
+        int frames = (int)strtol(sep + 1, nullptr, 10);
+        faceIndexSessionStart(header, frames);
+    } else if (strcmp(topic, s_enrollTopic) == 0) {
+        // Split "<label>:<vector>" without assuming a terminated payload
+        const uint8_t* sep = (const uint8_t*)memchr(payload, ':', length);
+        if (!sep || sep == payload) {
+            Serial.println("[App MQTT] Malformed enroll payload");
+            return;
+        }
+
+        char label[FACE_INDEX_LABEL_MAX];
+        size_t labelLen = (size_t)(sep - payload);
+        if (labelLen >= sizeof(label)) {
+            labelLen = sizeof(label) - 1;
+        }
+        memcpy(label, payload, labelLen);
+        label[labelLen] = '\0';
+
+        const int8_t* vector = (const int8_t*)(sep + 1);
+        size_t vectorLen = length - (size_t)(sep + 1 - payload);
+        faceIndexEnroll(label, vector, vectorLen);
+    } else if (strcmp(topic, s_removeTopic) == 0) {
+        char label[FACE_INDEX_LABEL_MAX];
+        size_t labelLen = length;
+        if (labelLen >= sizeof(label)) {
+            labelLen = sizeof(label) - 1;
+        }
+        memcpy(label, payload, labelLen);
+        label[labelLen] = '\0';
+        faceIndexRemove(label);
+    }
+}
+
+/**
+ * @brief Report a completed enrollment session on the index status topic
+ */
+static void publishSessionResult() {
+    char label[FACE_INDEX_LABEL_MAX];
+    bool enrolled;
+    if (!faceIndexSessionResult(label, &enrolled)) {
+        return;
+    }
+
+    static char payload[192];
+    snprintf(payload, sizeof(payload),
+             "{\"label\":\"%s\",\"enrolled\":%s,\"count\":%d,\"timestamp\":\"%s\"}",
+             label, enrolled ? "true" : "false",
+             faceIndexCount(),
+             getTimestampISO8601());
+    hal::mqttPublish(s_indexStatusTopic, payload);
+}
+#endif
+
+#if MODEL_AB_ENABLED == STD_ON
+static char s_modelBeginTopic[256] = {0};
+static char s_modelChunkTopic[256] = {0};
+static char s_modelApplyTopic[256] = {0};
+static char s_modelStatusTopic[256] = {0};
+
+/**
+ * @brief Publish a model-update status report
+ */
+static void publishModelStatus(const char* phase, bool ok) {
+    static char payload[192];
+    snprintf(payload, sizeof(payload),
+             "{\"phase\":\"%s\",\"ok\":%s,\"active\":\"%s\",\"timestamp\":\"%s\"}",
+             phase, ok ? "true" : "false",
+             driver::tfliteActiveModelLabel(),
+             getTimestampISO8601());
+    hal::mqttPublish(s_modelStatusTopic, payload);
+}
+
+/**
+ * @brief Handle the model download-verify-swap flow
+ *
+ * Begin payload: "<size>:<crc32 hex>". Chunk payload: raw sequential
+ * model bytes. Apply payload: ignored. Chunks are not individually
+ * acknowledged; failures surface on the status topic at apply time.
+ */
+static void handleModelMessage(const char* topic, const uint8_t* payload,
+                               unsigned int length) {
+    if (strcmp(topic, s_modelBeginTopic) == 0) {
+        char header[40];
+        size_t headerLen = length < sizeof(header) - 1 ? length : sizeof(header) - 1;
+        memcpy(header, payload, headerLen);
+        header[headerLen] = '\0';
+
+        char* sep = strchr(header, ':');
+        if (!sep) {
+            Serial.println("[App MQTT] Malformed model begin payload");
+            publishModelStatus("begin", false);
+            return;
+        }
+        *sep = '\0';
+        size_t size = (size_t)strtoul(header, nullptr, 10);
+        uint32_t crc = (uint32_t)strtoul(sep + 1, nullptr, 16);
+        publishModelStatus("begin", driver::tfliteModelUpdateBegin(size, crc));
+    } else if (strcmp(topic, s_modelChunkTopic) == 0) {
+        driver::tfliteModelUpdateWrite(payload, length);
+    } else if (strcmp(topic, s_modelApplyTopic) == 0) {
+        publishModelStatus("apply", driver::tfliteModelUpdateApply());
+    }
+}
+#endif
+
+#if FACE_INDEX_ENABLED == STD_ON || MODEL_AB_ENABLED == STD_ON
+static bool s_controlSubscribed = false;
+
+/**
+ * @brief Dispatch incoming messages to the enabled control features
+ */
+static void handleControlMessage(const char* topic, const uint8_t* payload,
+                                 unsigned int length) {
+#if FACE_INDEX_ENABLED == STD_ON
+    handleIndexMessage(topic, payload, length);
+#endif
+#if MODEL_AB_ENABLED == STD_ON
+    handleModelMessage(topic, payload, length);
+#endif
+}
+
+/**
+ * @brief Subscribe to the control topics - re-run after every reconnect
+ */
+static void subscribeControlTopics() {
+    if (!hal::mqttIsConnected()) {
+        s_controlSubscribed = false;
+        return;
+    }
+    if (s_controlSubscribed) {
+        return;
+    }
+
+    bool ok = true;
+#if FACE_INDEX_ENABLED == STD_ON
+    ok = hal::mqttSubscribe(s_enrollTopic) &&
+         hal::mqttSubscribe(s_removeTopic) &&
+         hal::mqttSubscribe(s_sessionTopic) && ok;
+#endif
+#if MODEL_AB_ENABLED == STD_ON
+    ok = hal::mqttSubscribe(s_modelBeginTopic) &&
+         hal::mqttSubscribe(s_modelChunkTopic) &&
+         hal::mqttSubscribe(s_modelApplyTopic) && ok;
+#endif
+    s_controlSubscribed = ok;
+}
+#endif
+
 /**
  * @brief Initialize NTP time synchronization
  */
@@ -53,8 +240,36 @@ bool mqttManagerInit() {
              "%s/%s", MQTT_TOPIC_BASE, MQTT_LOCATION);
     
     Serial.printf("[App MQTT] Topic: %s\n", s_currentTopic);
-    
-    return hal::mqttInit();
+
+#if FACE_INDEX_ENABLED == STD_ON
+    snprintf(s_enrollTopic, sizeof(s_enrollTopic),
+             "%s/%s/index/enroll", MQTT_TOPIC_BASE, MQTT_LOCATION);
+    snprintf(s_removeTopic, sizeof(s_removeTopic),
+             "%s/%s/index/remove", MQTT_TOPIC_BASE, MQTT_LOCATION);
+    snprintf(s_sessionTopic, sizeof(s_sessionTopic),
+             "%s/%s/index/session", MQTT_TOPIC_BASE, MQTT_LOCATION);
+    snprintf(s_indexStatusTopic, sizeof(s_indexStatusTopic),
+             "%s/%s/index/status", MQTT_TOPIC_BASE, MQTT_LOCATION);
+#endif
+#if MODEL_AB_ENABLED == STD_ON
+    snprintf(s_modelBeginTopic, sizeof(s_modelBeginTopic),
+             "%s/%s/model/begin", MQTT_TOPIC_BASE, MQTT_LOCATION);
+    snprintf(s_modelChunkTopic, sizeof(s_modelChunkTopic),
+             "%s/%s/model/chunk", MQTT_TOPIC_BASE, MQTT_LOCATION);
+    snprintf(s_modelApplyTopic, sizeof(s_modelApplyTopic),
+             "%s/%s/model/apply", MQTT_TOPIC_BASE, MQTT_LOCATION);
+    snprintf(s_modelStatusTopic, sizeof(s_modelStatusTopic),
+             "%s/%s/model/status", MQTT_TOPIC_BASE, MQTT_LOCATION);
+#endif
+#if FACE_INDEX_ENABLED == STD_ON || MODEL_AB_ENABLED == STD_ON
+    hal::mqttSetMessageHandler(handleControlMessage);
+#endif
+
+    bool ok = hal::mqttInit();
+#if FACE_INDEX_ENABLED == STD_ON || MODEL_AB_ENABLED == STD_ON
+    subscribeControlTopics();
+#endif
+    return ok;
 }
 
 /**
@@ -144,6 +359,51 @@ bool publishStatistics(int framesProcessed, int faceRecognized) {
     return hal::mqttPublish(statsTopic, payload);
 }
 
+bool publishIdleHeartbeat() {
+    static char payload[256];
+
+    snprintf(payload, sizeof(payload),
+             "{"
+             "\"status\":\"idle\","
+             "\"timestamp\":\"%s\","
+             "\"location\":\"%s\""
+             "}",
+             getTimestampISO8601(),
+             MQTT_LOCATION);
+
+    static char heartbeatTopic[256];
+    snprintf(heartbeatTopic, sizeof(heartbeatTopic),
+             "%s/%s/heartbeat", MQTT_TOPIC_BASE, MQTT_LOCATION);
+
+    return hal::mqttPublish(heartbeatTopic, payload);
+}
+
+bool publishFaceThumbnail() {
+#if THUMBNAIL_ENABLED == STD_ON
+    camera_fb_t* fb = hal::cameraCaptureJpeg(THUMBNAIL_JPEG_QUALITY);
+    bool ok = false;
+
+    if (fb) {
+        static char thumbnailTopic[256];
+        snprintf(thumbnailTopic, sizeof(thumbnailTopic),
+                 "%s/%s/thumbnail", MQTT_TOPIC_BASE, MQTT_LOCATION);
+
+        // Hand the JPEG to the background stream - it drains in
+        // budgeted slices from mqttProcess(), so the recognition loop
+        // never blocks on the full payload
+        ok = hal::mqttStreamPublish(thumbnailTopic, fb->buf, fb->len);
+        hal::cameraRelease(fb);
+    } else {
+        Serial.println("[App MQTT] Thumbnail capture failed");
+    }
+
+    hal::cameraRestoreFormat();
+    return ok;
+#else
+    return false;
+#endif
+}
+
 const char* getCurrentTopic() {
     return s_currentTopic;
 }
@@ -154,6 +414,12 @@ bool isMqttReady() {
 
 void mqttManagerProcess() {
     hal::mqttProcess();
+#if FACE_INDEX_ENABLED == STD_ON || MODEL_AB_ENABLED == STD_ON
+    subscribeControlTopics();
+#endif
+#if FACE_INDEX_ENABLED == STD_ON
+    publishSessionResult();
+#endif
 }
 
 }  // namespace app
@@ -33,6 +33,20 @@ bool publishFaceDetection(const FaceResult& result);
  */
 bool publishStatistics(int framesProcessed, int faceRecognized);
 
+/**
+ * @brief Publish an idle heartbeat (no motion, inference skipped)
+ * @return true on success
+ */
+bool publishIdleHeartbeat();
+
+/**
+ * @brief Capture a hardware-encoded JPEG and publish it as a thumbnail
+ * @note Streams the frame buffer over MQTT in bounded chunks; the
+ *       sensor is restored to its inference format before returning.
+ * @return true on success
+ */
+bool publishFaceThumbnail();
+
 /**
  * @brief Get current MQTT topic (for debugging)
  * @return Topic string
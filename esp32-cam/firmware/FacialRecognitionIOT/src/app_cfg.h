@@ -51,8 +51,32 @@
 #define MQTT_TOPIC_BASE             "/hotel/Room101/Authentication/FaceRecognition"
 #define MQTT_LOCATION               "main_lobby"  // Change per location
 #define MQTT_RECONNECT_INTERVAL_MS  5000
+#define MQTT_BUFFER_SIZE            1536  // PubSubClient packet buffer (model chunks)
 #define PUBLISH_ONLY_RECOGNIZED     true  // Only publish recognized faces
 
+// Background streaming for large payloads: mqttStreamPublish() stages
+// the payload in PSRAM and mqttProcess() drains it a time-budgeted
+// slice per call, so a big publish never stalls the loop for more than
+// one frame. Payloads over the staging cap fall back to the blocking
+// chunked path.
+#define MQTT_STREAM_BUDGET_MS       15    // Max ms of socket writes per process call
+#define MQTT_STREAM_STAGE_KB        64    // PSRAM staging cap for one streamed payload
+
+// Presence: a Last Will registered at connect flips the retained
+// presence document to offline when the broker loses the kiosk, and a
+// compact retained heartbeat (uptime/heap/min-heap) refreshes it at
+// this period - dead devices show up on the dashboard by event, not
+// by guests noticing stale data.
+#define MQTT_PRESENCE_INTERVAL_MS   60000
+
+// JPEG thumbnail publishing: on recognition, re-capture one frame with
+// the sensor's hardware JPEG encoder and hand it to the background
+// MQTT stream, which drains it in budgeted slices.
+#define THUMBNAIL_ENABLED           STD_ON
+#define THUMBNAIL_JPEG_QUALITY      12     // Hardware encoder quality (lower = better)
+#define THUMBNAIL_MQTT_CHUNK        1024   // Bytes per chunked MQTT write
+#define THUMBNAIL_MIN_INTERVAL_MS   2000   // Rate limit between thumbnails
+
 // Optional MQTT authentication (uncomment to enable)
 // #define MQTT_USERNAME            "your_username"
 // #define MQTT_PASSWORD            "your_password"
@@ -128,6 +152,20 @@
     #define CROP_Y_OFFSET           0
 #endif
 
+/* =========================
+ * Frame Buffer Pool Configuration
+ * ========================= */
+// Explicit ownership over the camera driver's frame buffers: every
+// captured frame occupies a pool slot with a reference count until all
+// holders release it, so pipeline stages can keep a frame while the
+// next one is captured without guessing how many buffers the driver
+// has. Capture fails fast (and counts a starvation) when every slot is
+// held instead of stalling inside the driver. The pool size is also
+// the driver's fb_count - the DMA buffers themselves stay
+// driver-allocated in PSRAM.
+#define CAMERA_FB_POOL_ENABLED  STD_ON
+#define CAMERA_FB_POOL_SIZE     2
+
 // Validate sensor selection
 #if !defined(SENSOR_OV2640) && !defined(SENSOR_RHYX_M21_45)
     #error "No sensor selected! Uncomment ONE sensor type above."
@@ -146,17 +184,235 @@
 #define CONFIDENCE_THRESHOLD    0.995f
 #define TENSOR_ARENA_SIZE       (1 * 1024 * 1024)  // 1 MB
 
+// Load the model from a dedicated flash partition (esp_partition_mmap)
+// instead of the compiled-in model_data.h array. Requires a custom
+// partition table with a data partition labeled MODEL_PARTITION_LABEL;
+// falls back to the header array automatically if the partition is
+// missing or does not contain a valid TFLite flatbuffer.
+#define MODEL_PARTITION_ENABLED STD_ON
+#define MODEL_PARTITION_LABEL   "model"
+
+// A/B model slots: a second data partition (MODEL_PARTITION_B_LABEL in
+// the partition table) receives chunked model downloads over MQTT while
+// the active slot keeps serving inference. After a CRC32 check the
+// driver swaps slots and re-initializes; if the new model fails init it
+// swaps back. Ships a ~300 KB model refresh without a 2 MB firmware
+// OTA or a reboot. Requires MODEL_PARTITION_ENABLED.
+#define MODEL_AB_ENABLED        STD_ON
+#define MODEL_PARTITION_B_LABEL "model_b"
+
+// Use ESP-NN accelerated int8 conv/depthwise kernels. The kernels are
+// selected inside the TFLite Micro library at build time (ESP_NN macro,
+// set when linking the esp-tflite-micro component); this flag enables
+// the init-time quantization validation and kernel-resolution report
+// that make the optimized path trustworthy.
+#define TFLITE_ESP_NN_ENABLED   STD_ON
+
+// Tensor arena placement: keep persistent buffers in PSRAM but carve
+// the non-persistent (activation) arena out of internal DMA-capable
+// SRAM when enough is free. The scratch size is probed at init - the
+// largest internal block minus a reserve for WiFi/camera - and the
+// resulting split is reported over Serial and MQTT. Falls back to the
+// single PSRAM arena when internal memory is too tight.
+#define ARENA_SPLIT_ENABLED         STD_ON
+#define ARENA_SCRATCH_MIN_KB        64   // Below this the split is not worth it
+#define ARENA_INTERNAL_RESERVE_KB   48   // Internal headroom left untouched
+
+/* =========================
+ * PSRAM Arena Configuration
+ * ========================= */
+// Named PSRAM regions carved once at boot instead of ad-hoc ps_malloc:
+// large blocks (frame copies, tensor arena, burst ring) come from fixed
+// arenas, so PSRAM cannot fragment over uptime and a region that fits
+// at boot fits forever. Budgets must total well under the 4 MB module
+// (the camera driver's own frame buffers also live in PSRAM).
+#define PSRAM_ARENA_ENABLED         STD_ON
+#define PSRAM_ARENA_CAMERA_KB       1024  // Frame copies / burst-capture ring
+#define PSRAM_ARENA_MODEL_KB        1536  // Tensor arena + model staging
+#define PSRAM_ARENA_SCRATCH_KB      256   // Reset-on-demand working memory
+
+/* =========================
+ * Face Index Configuration
+ * ========================= */
+// Embedding-based matching: run the backbone to an embedding vector
+// and match it against an on-device index of enrolled int8 vectors
+// (persisted in NVS, updatable over MQTT) instead of the fixed
+// classifier head from class_labels.h. Enrolling a guest becomes a
+// data push, not a retrain-and-reflash cycle. Requires an embedding
+// backbone on the model partition whose output tensor is the
+// embedding - with the stock classifier flatbuffer leave this OFF and
+// the class-label path runs unchanged.
+#define FACE_INDEX_ENABLED      STD_OFF
+#define FACE_INDEX_DIM          128    // Embedding dimensions (model output)
+#define FACE_INDEX_MAX_ENTRIES  32     // Enrolled vectors held on device
+#define FACE_INDEX_LABEL_MAX    16     // Label bytes incl. terminator
+#define FACE_INDEX_THRESHOLD    0.80f  // Min cosine similarity to match
+
 /* =========================
  * LED Configuration
  * ========================= */
 #define LED_GPIO_NUM            33   // Built-in flash LED on AI-Thinker
 #define LED_FLASH_MS            50   // Flash duration on recognition
+#define LED_ASYNC_FLASH         STD_ON  // Turn off via one-shot timer instead of delay()
 
 /* =========================
  * Timing Configuration
  * ========================= */
 #define INFERENCE_DELAY_MS      100  // Delay between frames (~10 FPS)
 
+// Frame-rate governor: sleep only the remainder of the target period
+// after each frame instead of a fixed delay, so FPS holds steady as
+// inference time varies. Drops to the idle rate while the motion gate
+// reports a static scene; ramps back to the target on the next frame
+// with activity.
+#define FRAME_GOVERNOR_ENABLED  STD_ON
+#define GOVERNOR_TARGET_FPS     10
+#define GOVERNOR_IDLE_FPS       2
+
+/* =========================
+ * Capture Pipeline Configuration
+ * ========================= */
+#define CAPTURE_PIPELINE_ENABLED    STD_ON  // Capture frame N+1 during inference of frame N
+#define CAPTURE_QUEUE_DEPTH         2       // Two-slot frame queue (matches fb_count)
+#define CAPTURE_TASK_STACK_SIZE     4096
+#define CAPTURE_TASK_PRIORITY       2
+#define CAPTURE_TASK_CORE           0       // Capture/network on core 0
+#define CAPTURE_FRAME_TIMEOUT_MS    500     // Max wait for a pipelined frame
+
+/* =========================
+ * Inference Task Configuration
+ * ========================= */
+#define INFERENCE_TASK_ENABLED      STD_ON  // Run tfliteInvoke on its own core
+#define INFERENCE_TASK_STACK_SIZE   8192
+#define INFERENCE_TASK_PRIORITY     3
+#define INFERENCE_TASK_CORE         1       // Second core - isolates WiFi/MQTT jitter
+#define RESULT_QUEUE_DEPTH          4
+
+/* =========================
+ * Network Task Configuration
+ * ========================= */
+#define ASYNC_BOOT_ENABLED          STD_ON  // Bring up WiFi/NTP/MQTT in parallel with camera/TFLite
+#define NETWORK_TASK_STACK_SIZE     6144    // NTP + MQTT init run in this task
+#define NETWORK_TASK_PRIORITY       1
+#define NETWORK_TASK_CORE           0
+
+/* =========================
+ * Stage Watchdog Configuration
+ * ========================= */
+// Each pipeline stage gets a latency budget; a monitor task on core 0
+// watches the stage entry timestamps and triggers a full stage-level
+// recovery (stuck tasks deleted, camera deinit/reinit, TFLite re-init
+// via reset()) when a budget blows, then raises an MQTT alert carrying
+// the recent stage trace. Turns a post-brownout freeze from a
+// power-cycle visit into a few seconds of self-recovery.
+#define WATCHDOG_ENABLED              STD_ON
+#define WATCHDOG_CHECK_MS             500    // Monitor poll period
+#define WATCHDOG_CAPTURE_BUDGET_MS    3000   // Frame acquisition
+#define WATCHDOG_PREPROCESS_BUDGET_MS 1000   // Crop/resize/normalize
+#define WATCHDOG_INFERENCE_BUDGET_MS  5000   // tfliteInvoke
+#define WATCHDOG_MAX_CAPTURE_FAILS    5      // Consecutive null frames = camera dead
+#define WATCHDOG_TRACE_DEPTH          8      // Stage transitions kept for the alert
+#define WATCHDOG_TASK_STACK_SIZE      4096
+#define WATCHDOG_TASK_PRIORITY        4      // Above the stages it supervises
+#define WATCHDOG_TASK_CORE            0
+
+/* =========================
+ * Motion Gate Configuration
+ * ========================= */
+#define MOTION_GATE_ENABLED     STD_ON  // Skip inference on static scenes
+#define MOTION_GRID_COLS        16      // Luma signature grid
+#define MOTION_GRID_ROWS        12
+#define MOTION_DIFF_THRESHOLD   6       // Mean abs luma delta to count as motion
+#define IDLE_HEARTBEAT_MS       10000   // Heartbeat publish period while idle
+
+/* =========================
+ * Crop Tracking Configuration
+ * ========================= */
+// Reuse the motion gate's per-cell luma diffs to follow the active
+/// region: the crop window moves and shrinks onto it before sampling,
+// so the model sees more face and fewer background pixels - and the
+// preprocess loop reads a smaller source area. Reverts to the fixed
+// CROP_SIZE window after a quiet spell. Needs MOTION_GATE_ENABLED.
+#define CROP_TRACK_ENABLED      STD_ON
+#define CROP_TRACK_MIN_SIZE     120     // Smallest crop window (px)
+#define CROP_TRACK_SMOOTH_NUM   1       // Window moves NUM/DEN toward the
+#define CROP_TRACK_SMOOTH_DEN   4       // target each frame (jitter damping)
+#define CROP_TRACK_DECAY_FRAMES 15      // Quiet frames before full-crop revert
+
+/* =========================
+ * Result Cache Configuration
+ * ========================= */
+// Serve the last recognition from cache while the tracked guest holds
+// still: once a fused result clears RESULT_CACHE_MIN_CONFIDENCE, frames
+// whose motion signature stays under RESULT_CACHE_MOTION_MAX skip
+// preprocess+invoke entirely and return the cached FaceResult, with a
+// real inference re-run every RESULT_CACHE_REVALIDATE_MS to catch the
+// guest leaving or a new face arriving. Needs MOTION_GATE_ENABLED.
+#define RESULT_CACHE_ENABLED        STD_ON
+#define RESULT_CACHE_MIN_CONFIDENCE 0.80f   // Fused confidence to arm the cache
+#define RESULT_CACHE_MOTION_MAX     12      // Mean luma delta still read as "same guest"
+#define RESULT_CACHE_REVALIDATE_MS  1000    // Full inference at least this often
+
+/* =========================
+ * Instrumentation Configuration
+ * ========================= */
+// Shared header-only scope timers and per-site counters (instrument.h
+// in libraries/FaceRecognitionCommon). INSTR_SCOPE / INSTR_COUNT at
+// any site; every macro is a no-op with the flag off, so disabled
+// builds pay zero bytes and zero cycles.
+#define INSTRUMENT_ENABLED      STD_ON
+#define INSTR_REPORT_MS         30000   // Serial report interval
+
+/* =========================
+ * Temporal Fusion Configuration
+ * ========================= */
+#define TEMPORAL_FUSION_ENABLED STD_ON  // Fuse scores over a sliding frame window
+#define FUSION_WINDOW_SIZE      5       // Frames in the sliding window
+#define FUSION_DECAY            0.6f    // Per-frame-of-age weight multiplier
+
+/* =========================
+ * Boot Benchmark Configuration
+ * ========================= */
+// Per-boot self-calibration: before the pipeline tasks start, time
+// preprocessing and inference on a synthetic frame and publish the
+// numbers with the firmware version on the /bench/boot subtopic.
+// Grafana alerts on per-version regressions fleet-wide within minutes
+// of a rollout.
+#define BOOT_BENCH_ENABLED      STD_ON
+#define BOOT_BENCH_ITERS        8       // ~2 s of boot time at ~200 ms/invoke
+
+// Firmware identity stamped into the boot-bench report - bump on
+// release so the dashboards can group numbers per rollout
+#define FW_VERSION              "1.0.0"
+
+/* =========================
+ * Benchmark Configuration
+ * ========================= */
+// Benchmark build: measure N frames through the full pipeline and emit
+// a machine-readable report instead of running recognition. Normally
+// injected from the build (`make bench-cam` passes -DBENCHMARK_MODE=1).
+#ifndef BENCHMARK_MODE
+#define BENCHMARK_MODE          STD_OFF
+#endif
+#define BENCHMARK_FRAMES        100
+
+#if BENCHMARK_MODE == STD_ON
+// Measure the raw single-threaded pipeline - no pipelining, gating or
+// governor skewing the numbers
+#undef CAPTURE_PIPELINE_ENABLED
+#define CAPTURE_PIPELINE_ENABLED STD_OFF
+#undef INFERENCE_TASK_ENABLED
+#define INFERENCE_TASK_ENABLED   STD_OFF
+#undef MOTION_GATE_ENABLED
+#define MOTION_GATE_ENABLED      STD_OFF
+#undef FRAME_GOVERNOR_ENABLED
+#define FRAME_GOVERNOR_ENABLED   STD_OFF
+#undef RESULT_CACHE_ENABLED
+#define RESULT_CACHE_ENABLED     STD_OFF
+#undef BOOT_BENCH_ENABLED
+#define BOOT_BENCH_ENABLED       STD_OFF
+#endif
+
 /* =========================
  * Graphics Colors (RGB565)
  * ========================= */
@@ -4,14 +4,28 @@
  */
 
 #include "driver_tflite.h"
+#include "../../app_cfg.h"
 #include "../../hal/hal_memory/hal_memory.h"
 #include <Arduino.h>
+#include "freertos/FreeRTOS.h"
+#include "freertos/semphr.h"
 
+#if MODEL_PARTITION_ENABLED == STD_ON
+#include "esp_partition.h"
+#endif
+#if MODEL_AB_ENABLED == STD_ON
+#include "esp_rom_crc.h"
+#include <Preferences.h>
+#endif
+
+#include "tensorflow/lite/micro/micro_allocator.h"
 #include "tensorflow/lite/micro/micro_interpreter.h"
 #include "tensorflow/lite/micro/micro_log.h"
 #include "tensorflow/lite/micro/micro_mutable_op_resolver.h"
 #include "tensorflow/lite/schema/schema_generated.h"
 
+#include <new>
+
 namespace driver {
 
 // Static storage
@@ -22,12 +36,186 @@ static TfLiteTensor* s_output = nullptr;
 static uint8_t* s_tensorArena = nullptr;
 static bool s_ready = false;
 
+// Guards the interpreter and its arena: the inference pipeline (core 1)
+// holds it across each frame's tensor access + Invoke, the model-swap
+// path (MQTT handler, core 0) across teardown/rebuild. Without it a
+// /model/apply could reset the arena mid-Invoke.
+static SemaphoreHandle_t s_interpMutex = nullptr;
+
 // Op resolver with MobileNetV2 operations (static to persist)
 static tflite::MicroMutableOpResolver<15> s_resolver;
 
+// Interpreter storage - placement-new so reset() gets a fresh instance
+alignas(tflite::MicroInterpreter) static uint8_t s_interpreterMem[sizeof(tflite::MicroInterpreter)];
+
+#if ARENA_SPLIT_ENABLED == STD_ON
+// Activation scratch carved from internal DMA-capable SRAM; the PSRAM
+// arena then only holds persistent allocations (tensor metadata etc.)
+static uint8_t* s_scratchArena = nullptr;
+static size_t s_scratchSize = 0;
+static char s_arenaReport[160] = "{\"arena\":\"uninitialized\"}";
+#endif
+
+#if MODEL_PARTITION_ENABLED == STD_ON
+static spi_flash_mmap_handle_t s_modelMmapHandle = 0;
+
+#if MODEL_AB_ENABLED == STD_ON
+// Active slot (0 = MODEL_PARTITION_LABEL, 1 = MODEL_PARTITION_B_LABEL)
+// persists in NVS so a swapped model survives reboots. The original
+// tfliteInit arguments are kept for the re-init after a swap.
+static uint8_t s_activeSlot = 0;
+static bool s_slotLoaded = false;
+static const uint8_t* s_builtinModel = nullptr;
+static size_t s_savedArenaSize = 0;
+
+// In-progress download into the inactive slot
+static const esp_partition_t* s_updatePart = nullptr;
+static size_t s_updateSize = 0;
+static size_t s_updateOffset = 0;
+static uint32_t s_updateCrc = 0;
+
+static const char* slotLabel(uint8_t slot) {
+    return (slot == 0) ? MODEL_PARTITION_LABEL : MODEL_PARTITION_B_LABEL;
+}
+
+static void persistSlot(uint8_t slot) {
+    Preferences prefs;
+    if (prefs.begin("modelota", false)) {
+        prefs.putUChar("slot", slot);
+        prefs.end();
+    }
+    s_activeSlot = slot;
+}
+
+static uint8_t activeSlot() {
+    if (!s_slotLoaded) {
+        Preferences prefs;
+        if (prefs.begin("modelota", true)) {
+            s_activeSlot = prefs.getUChar("slot", 0);
+            prefs.end();
+        }
+        if (s_activeSlot > 1) {
+            s_activeSlot = 0;
+        }
+        s_slotLoaded = true;
+    }
+    return s_activeSlot;
+}
+#endif
+
+/**
+ * @brief Map the model partition into the data address space
+ * @return Pointer to the mapped model, or nullptr if unavailable
+ *
+ * mmap'd flash reads go through the flash cache exactly like the
+ * compiled-in array, so inference performance is unchanged - the win
+ * is a smaller app binary and model updates without relinking.
+ */
+static const uint8_t* mapModelPartition() {
+#if MODEL_AB_ENABLED == STD_ON
+    const char* label = slotLabel(activeSlot());
+#else
+    const char* label = MODEL_PARTITION_LABEL;
+#endif
+    const esp_partition_t* part = esp_partition_find_first(
+        ESP_PARTITION_TYPE_DATA, ESP_PARTITION_SUBTYPE_ANY, label);
+    if (!part) {
+        return nullptr;
+    }
+
+    const void* mapped = nullptr;
+    esp_err_t err = esp_partition_mmap(part, 0, part->size,
+                                       SPI_FLASH_MMAP_DATA, &mapped, &s_modelMmapHandle);
+    if (err != ESP_OK) {
+        Serial.printf("[TFLite] Partition mmap failed: %d\n", err);
+        return nullptr;
+    }
+
+    // Sanity check: TFLite flatbuffers carry "TFL3" at offset 4
+    const uint8_t* data = (const uint8_t*)mapped;
+    if (memcmp(data + 4, "TFL3", 4) != 0) {
+        Serial.printf("[TFLite] Partition '%s' has no valid model\n", label);
+        spi_flash_munmap(s_modelMmapHandle);
+        s_modelMmapHandle = 0;
+        return nullptr;
+    }
+
+    Serial.printf("[TFLite] Model mapped from partition '%s' (%d bytes)\n",
+                  label, part->size);
+    return data;
+}
+#endif
+
+#if TFLITE_ESP_NN_ENABLED == STD_ON
+/**
+ * @brief Report which kernel implementations the build resolved to
+ *
+ * ESP-NN substitution happens inside the TFLite Micro library when it
+ * is compiled with ESP_NN defined - the resolver Add* calls then bind
+ * the accelerated conv/depthwise/pooling registrations transparently.
+ * This log makes it obvious on the serial console whether a given
+ * firmware image is actually running the optimized path.
+ */
+static void logKernelResolution() {
+#ifdef ESP_NN
+    Serial.println("[TFLite] Kernels: ESP-NN optimized (conv2d, depthwise_conv2d, pooling)");
+#else
+    Serial.println("[TFLite] Kernels: reference implementations (ESP_NN not compiled in)");
+    Serial.println("[TFLite] Build the esp-tflite-micro component with ESP-NN for lower latency");
+#endif
+}
+
+/**
+ * @brief Verify the model is fully int8 quantized
+ *
+ * The ESP-NN fast path only covers int8 tensors; a float or hybrid
+ * model silently falls back to reference kernels. Flag that at init
+ * instead of wondering why inference is slow in the field.
+ */
+static bool validateQuantization() {
+    bool inputQuantized = (s_input->type == kTfLiteInt8 || s_input->type == kTfLiteUInt8);
+    bool outputQuantized = (s_output->type == kTfLiteInt8 || s_output->type == kTfLiteUInt8);
+
+    if (!inputQuantized || !outputQuantized) {
+        Serial.printf("[TFLite] WARNING: model not fully quantized (in=%d out=%d) - "
+                      "ESP-NN kernels will not engage\n",
+                      s_input->type, s_output->type);
+        return false;
+    }
+
+    Serial.printf("[TFLite] Quantization OK: input scale=%.6f zp=%d\n",
+                  s_input->params.scale, s_input->params.zero_point);
+    return true;
+}
+#endif
+
 bool tfliteInit(const uint8_t* modelData, size_t arenaSize) {
+    // Created once; re-init after a model swap reuses the same mutex
+    if (!s_interpMutex) {
+        s_interpMutex = xSemaphoreCreateMutex();
+    }
+#if MODEL_AB_ENABLED == STD_ON
+    // Remember the built-in fallback and arena size for slot swaps
+    s_builtinModel = modelData;
+    s_savedArenaSize = arenaSize;
+#endif
+#if MODEL_PARTITION_ENABLED == STD_ON
+    // Prefer the flash partition; the header array is only a fallback
+    const uint8_t* partitionModel = mapModelPartition();
+    if (partitionModel) {
+        modelData = partitionModel;
+    } else {
+        Serial.println("[TFLite] Using compiled-in model array");
+    }
+#endif
+
     // Allocate tensor arena in PSRAM
+#if PSRAM_ARENA_ENABLED == STD_ON
+    // From the model arena - carved at boot, cannot fragment or fail late
+    s_tensorArena = hal::memoryArenaAlloc(hal::MemoryArena::MODEL, arenaSize);
+#else
     s_tensorArena = hal::memoryAllocPsram(arenaSize);
+#endif
     if (!s_tensorArena) {
         Serial.println("[TFLite] Failed to allocate tensor arena!");
         return false;
@@ -42,29 +230,65 @@ bool tfliteInit(const uint8_t* modelData, size_t arenaSize) {
         return false;
     }
 
-    // Add required operations for MobileNetV2
-    s_resolver.AddConv2D();
-    s_resolver.AddDepthwiseConv2D();
-    s_resolver.AddFullyConnected();
-    s_resolver.AddSoftmax();
-    s_resolver.AddReshape();
-    s_resolver.AddAveragePool2D();
-    s_resolver.AddAdd();
-    s_resolver.AddMean();
-    s_resolver.AddQuantize();
-    s_resolver.AddDequantize();
-    s_resolver.AddPad();
-    s_resolver.AddRelu6();
-
-    // Create interpreter (static allocation)
-    static tflite::MicroInterpreter staticInterpreter(
-        s_model, s_resolver, s_tensorArena, arenaSize);
-    s_interpreter = &staticInterpreter;
-
-    // Allocate tensors
-    if (s_interpreter->AllocateTensors() != kTfLiteOk) {
-        Serial.println("[TFLite] AllocateTensors failed!");
-        return false;
+    // Add required operations for MobileNetV2. The resolver is static,
+    // so register only once - re-init after a model swap would otherwise
+    // append duplicates until the slot table overflows.
+    static bool opsRegistered = false;
+    if (!opsRegistered) {
+        s_resolver.AddConv2D();
+        s_resolver.AddDepthwiseConv2D();
+        s_resolver.AddFullyConnected();
+        s_resolver.AddSoftmax();
+        s_resolver.AddReshape();
+        s_resolver.AddAveragePool2D();
+        s_resolver.AddAdd();
+        s_resolver.AddMean();
+        s_resolver.AddQuantize();
+        s_resolver.AddDequantize();
+        s_resolver.AddPad();
+        s_resolver.AddRelu6();
+        opsRegistered = true;
+    }
+
+    // Create interpreter. With the arena split active, persistent
+    // allocations stay in PSRAM while the activation arena lives in
+    // internal DMA-capable SRAM so hot tensor traffic skips the SPI bus.
+    bool tensorsAllocated = false;
+#if ARENA_SPLIT_ENABLED == STD_ON
+    size_t largestInternal = hal::memoryGetLargestInternalDmaBlock();
+    size_t reserveBytes = (size_t)ARENA_INTERNAL_RESERVE_KB * 1024;
+    size_t minScratch = (size_t)ARENA_SCRATCH_MIN_KB * 1024;
+    if (largestInternal > reserveBytes + minScratch) {
+        s_scratchSize = largestInternal - reserveBytes;
+        if (s_scratchSize > arenaSize) s_scratchSize = arenaSize;
+        s_scratchArena = hal::memoryAllocInternalDma(s_scratchSize);
+    }
+    if (s_scratchArena) {
+        tflite::MicroAllocator* splitAllocator = tflite::MicroAllocator::Create(
+            s_tensorArena, arenaSize,        // persistent (PSRAM)
+            s_scratchArena, s_scratchSize);  // non-persistent (internal)
+        s_interpreter = new (s_interpreterMem)
+            tflite::MicroInterpreter(s_model, s_resolver, splitAllocator);
+        if (s_interpreter->AllocateTensors() == kTfLiteOk) {
+            tensorsAllocated = true;
+        } else {
+            // Probed scratch too small for this model - back out
+            Serial.println("[TFLite] Internal scratch too small, falling back to PSRAM arena");
+            s_interpreter->~MicroInterpreter();
+            s_interpreter = nullptr;
+            free(s_scratchArena);
+            s_scratchArena = nullptr;
+            s_scratchSize = 0;
+        }
+    }
+#endif
+    if (!tensorsAllocated) {
+        s_interpreter = new (s_interpreterMem)
+            tflite::MicroInterpreter(s_model, s_resolver, s_tensorArena, arenaSize);
+        if (s_interpreter->AllocateTensors() != kTfLiteOk) {
+            Serial.println("[TFLite] AllocateTensors failed!");
+            return false;
+        }
     }
 
     // Get input/output tensors
@@ -79,6 +303,19 @@ bool tfliteInit(const uint8_t* modelData, size_t arenaSize) {
     Serial.printf("[TFLite] Output classes: %d\n", s_output->dims->data[1]);
     Serial.printf("[TFLite] Arena used: %d bytes\n", s_interpreter->arena_used_bytes());
 
+#if ARENA_SPLIT_ENABLED == STD_ON
+    snprintf(s_arenaReport, sizeof(s_arenaReport),
+             "{\"persistent_psram\":%u,\"scratch_internal\":%u,\"arena_used\":%u}",
+             (unsigned)arenaSize, (unsigned)s_scratchSize,
+             (unsigned)s_interpreter->arena_used_bytes());
+    Serial.printf("[TFLite] Arena placement: %s\n", s_arenaReport);
+#endif
+
+#if TFLITE_ESP_NN_ENABLED == STD_ON
+    logKernelResolution();
+    validateQuantization();
+#endif
+
     s_ready = true;
     return true;
 }
@@ -90,6 +327,18 @@ bool tfliteInvoke() {
     return s_interpreter->Invoke() == kTfLiteOk;
 }
 
+void tfliteLock() {
+    if (s_interpMutex) {
+        xSemaphoreTake(s_interpMutex, portMAX_DELAY);
+    }
+}
+
+void tfliteUnlock() {
+    if (s_interpMutex) {
+        xSemaphoreGive(s_interpMutex);
+    }
+}
+
 TfLiteTensor* tfliteGetInput() {
     return s_input;
 }
@@ -109,12 +358,152 @@ bool tfliteIsReady() {
     return s_ready;
 }
 
+const char* tfliteGetArenaReport() {
+#if ARENA_SPLIT_ENABLED == STD_ON
+    return s_arenaReport;
+#else
+    return "{\"arena\":\"single_psram\"}";
+#endif
+}
+
+#if MODEL_AB_ENABLED == STD_ON
+
+const char* tfliteActiveModelLabel() {
+    return slotLabel(activeSlot());
+}
+
+bool tfliteModelUpdateBegin(size_t size, uint32_t crc32) {
+    const char* label = slotLabel(activeSlot() ^ 1);
+    s_updatePart = esp_partition_find_first(
+        ESP_PARTITION_TYPE_DATA, ESP_PARTITION_SUBTYPE_ANY, label);
+    if (!s_updatePart) {
+        Serial.printf("[TFLite] No '%s' partition - A/B update unavailable\n", label);
+        return false;
+    }
+    if (size == 0 || size > s_updatePart->size) {
+        Serial.printf("[TFLite] Model size %u exceeds slot (%u)\n",
+                      (unsigned)size, (unsigned)s_updatePart->size);
+        s_updatePart = nullptr;
+        return false;
+    }
+
+    if (esp_partition_erase_range(s_updatePart, 0, s_updatePart->size) != ESP_OK) {
+        Serial.println("[TFLite] Slot erase failed");
+        s_updatePart = nullptr;
+        return false;
+    }
+
+    s_updateSize = size;
+    s_updateOffset = 0;
+    s_updateCrc = crc32;
+    Serial.printf("[TFLite] Model download to '%s': %u bytes expected\n",
+                  label, (unsigned)size);
+    return true;
+}
+
+bool tfliteModelUpdateWrite(const uint8_t* data, size_t len) {
+    if (!s_updatePart || !data || len == 0) {
+        return false;
+    }
+    if (s_updateOffset + len > s_updateSize) {
+        Serial.println("[TFLite] Model download overran announced size");
+        s_updatePart = nullptr;
+        return false;
+    }
+
+    if (esp_partition_write(s_updatePart, s_updateOffset, data, len) != ESP_OK) {
+        Serial.println("[TFLite] Slot write failed");
+        s_updatePart = nullptr;
+        return false;
+    }
+    s_updateOffset += len;
+    return true;
+}
+
+bool tfliteModelUpdateApply() {
+    if (!s_updatePart || s_updateOffset != s_updateSize) {
+        Serial.printf("[TFLite] Incomplete download (%u/%u bytes)\n",
+                      (unsigned)s_updateOffset, (unsigned)s_updateSize);
+        return false;
+    }
+
+    // Verify the landed image before touching the running interpreter
+    uint32_t crc = 0;
+    uint8_t buf[256];
+    for (size_t off = 0; off < s_updateSize; off += sizeof(buf)) {
+        size_t chunk = s_updateSize - off;
+        if (chunk > sizeof(buf)) {
+            chunk = sizeof(buf);
+        }
+        if (esp_partition_read(s_updatePart, off, buf, chunk) != ESP_OK) {
+            Serial.println("[TFLite] Slot readback failed");
+            return false;
+        }
+        crc = esp_rom_crc32_le(crc, buf, chunk);
+    }
+    if (crc != s_updateCrc) {
+        Serial.printf("[TFLite] CRC mismatch: got %08lx want %08lx\n",
+                      (unsigned long)crc, (unsigned long)s_updateCrc);
+        s_updatePart = nullptr;
+        return false;
+    }
+
+    // Atomic switch: persist the new slot, rebuild the interpreter from
+    // it, and fall back to the previous slot if the new model fails init
+    uint8_t oldSlot = activeSlot();
+    uint8_t newSlot = oldSlot ^ 1;
+    s_updatePart = nullptr;
+
+    // The inference task may be mid-Invoke on the other core - wait for
+    // it to release the interpreter before tearing anything down
+    tfliteLock();
+    tfliteCleanup();
+    persistSlot(newSlot);
+    if (tfliteInit(s_builtinModel, s_savedArenaSize)) {
+        tfliteUnlock();
+        Serial.printf("[TFLite] Model swapped to slot '%s'\n", slotLabel(newSlot));
+        return true;
+    }
+
+    Serial.println("[TFLite] New model failed init - reverting slot");
+    persistSlot(oldSlot);
+    if (!tfliteInit(s_builtinModel, s_savedArenaSize)) {
+        Serial.println("[TFLite] Revert init failed - running on built-in model");
+    }
+    tfliteUnlock();
+    return false;
+}
+
+#endif  // MODEL_AB_ENABLED
+
 void tfliteCleanup() {
+#if MODEL_PARTITION_ENABLED == STD_ON
+    if (s_modelMmapHandle) {
+        spi_flash_munmap(s_modelMmapHandle);
+        s_modelMmapHandle = 0;
+    }
+#endif
+    if (s_interpreter) {
+        s_interpreter->~MicroInterpreter();
+        s_interpreter = nullptr;
+    }
+#if ARENA_SPLIT_ENABLED == STD_ON
+    if (s_scratchArena) {
+        free(s_scratchArena);
+        s_scratchArena = nullptr;
+        s_scratchSize = 0;
+    }
+#endif
     if (s_tensorArena) {
+#if PSRAM_ARENA_ENABLED == STD_ON
+        // Arena blocks are not individually freed; the model arena is
+        // reclaimed wholesale if the model is ever reloaded
+        hal::memoryArenaReset(hal::MemoryArena::MODEL);
+#else
         hal::memoryFreePsram(s_tensorArena);
+#endif
         s_tensorArena = nullptr;
     }
-    s_interpreter = nullptr;
     s_model = nullptr;
     s_input = nullptr;
     s_output = nullptr;
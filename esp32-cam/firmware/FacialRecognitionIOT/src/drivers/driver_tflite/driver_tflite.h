@@ -27,6 +27,21 @@ bool tfliteInit(const uint8_t* modelData, size_t arenaSize);
  */
 bool tfliteInvoke();
 
+/**
+ * @brief Acquire the interpreter lock (blocks)
+ *
+ * Serializes interpreter use against a model swap: the inference
+ * pipeline (core 1) holds it from input-tensor access through output
+ * decode, and tfliteModelUpdateApply (MQTT handler, core 0) holds it
+ * across the interpreter teardown/rebuild.
+ */
+void tfliteLock();
+
+/**
+ * @brief Release the interpreter lock
+ */
+void tfliteUnlock();
+
 /**
  * @brief Get input tensor pointer
  * @return Input tensor or nullptr
@@ -51,6 +66,42 @@ size_t tfliteGetArenaUsed();
  */
 bool tfliteIsReady();
 
+/**
+ * @brief JSON summary of the tensor arena placement (PSRAM/internal split)
+ * @return Static report string
+ */
+const char* tfliteGetArenaReport();
+
+/**
+ * @brief Label of the model partition currently serving inference
+ * @return Partition label string
+ */
+const char* tfliteActiveModelLabel();
+
+/**
+ * @brief Start a model download into the inactive A/B slot
+ * @param size Total model size in bytes
+ * @param crc32 Expected CRC32 of the full image
+ * @return false if the inactive slot is missing or too small
+ */
+bool tfliteModelUpdateBegin(size_t size, uint32_t crc32);
+
+/**
+ * @brief Append sequential model bytes to the in-progress download
+ * @param data Chunk bytes
+ * @param len Chunk length
+ * @return false on write failure or overrun (download aborted)
+ */
+bool tfliteModelUpdateWrite(const uint8_t* data, size_t len);
+
+/**
+ * @brief Verify the downloaded model and swap slots
+ * @note Re-initializes the interpreter from the new slot; reverts to
+ *       the previous slot if the new model fails init.
+ * @return true if the swap completed and the new model is serving
+ */
+bool tfliteModelUpdateApply();
+
 /**
  * @brief Cleanup TFLite resources
  */
@@ -11,6 +11,28 @@ namespace hal {
 
 static bool s_cameraReady = false;
 
+#if CAMERA_FB_POOL_ENABLED == STD_ON
+// Every tracked frame occupies one slot from capture until its last
+// holder releases it. The driver's DMA buffers back the frames; the
+// pool only adds ownership accounting on top.
+struct PoolSlot {
+    camera_fb_t* fb;
+    int refs;
+};
+
+static PoolSlot s_pool[CAMERA_FB_POOL_SIZE] = {};
+static uint32_t s_poolStarved = 0;
+
+static PoolSlot* poolSlotFor(camera_fb_t* fb) {
+    for (int i = 0; i < CAMERA_FB_POOL_SIZE; i++) {
+        if (s_pool[i].fb == fb) {
+            return &s_pool[i];
+        }
+    }
+    return nullptr;
+}
+#endif
+
 esp_err_t cameraInit() {
     camera_config_t config;
     
@@ -43,7 +65,11 @@ esp_err_t cameraInit() {
     config.grab_mode = INITIAL_GRAB_MODE;
     config.fb_location = CAMERA_FB_IN_PSRAM;
     config.jpeg_quality = INITIAL_JPEG_QUALITY;
+#if CAMERA_FB_POOL_ENABLED == STD_ON
+    config.fb_count = CAMERA_FB_POOL_SIZE;
+#else
     config.fb_count = INITIAL_FB_COUNT;
+#endif
 
     // Initialize camera
     esp_err_t err = esp_camera_init(&config);
@@ -74,6 +100,77 @@ esp_err_t cameraInit() {
     return ESP_OK;
 }
 
+void cameraDeinit() {
+    s_cameraReady = false;
+#if CAMERA_FB_POOL_ENABLED == STD_ON
+    // Deinit invalidates every driver buffer - drop the tracking so
+    // stale pointers cannot be returned to the re-initialized driver
+    for (int i = 0; i < CAMERA_FB_POOL_SIZE; i++) {
+        s_pool[i].fb = nullptr;
+        s_pool[i].refs = 0;
+    }
+#endif
+    esp_camera_deinit();
+}
+
+#if CAMERA_FB_POOL_ENABLED == STD_ON
+camera_fb_t* cameraCapture() {
+    if (!s_cameraReady) {
+        return nullptr;
+    }
+
+    // Claim a slot before touching the driver: with every buffer held
+    // downstream, esp_camera_fb_get would stall or recycle a frame a
+    // stage still owns. Failing fast keeps ownership honest.
+    PoolSlot* slot = poolSlotFor(nullptr);
+    if (!slot) {
+        s_poolStarved++;
+        return nullptr;
+    }
+
+    camera_fb_t* fb = esp_camera_fb_get();
+    if (!fb) {
+        return nullptr;
+    }
+
+    slot->fb = fb;
+    slot->refs = 1;
+    return fb;
+}
+
+bool cameraRetain(camera_fb_t* fb) {
+    PoolSlot* slot = fb ? poolSlotFor(fb) : nullptr;
+    if (!slot) {
+        return false;
+    }
+    slot->refs++;
+    return true;
+}
+
+void cameraRelease(camera_fb_t* fb) {
+    if (!fb) {
+        return;
+    }
+
+    PoolSlot* slot = poolSlotFor(fb);
+    if (!slot) {
+        // Untracked frame (e.g. the JPEG thumbnail path) - return it
+        // straight to the driver
+        esp_camera_fb_return(fb);
+        return;
+    }
+
+    if (--slot->refs > 0) {
+        return;
+    }
+    slot->fb = nullptr;
+    esp_camera_fb_return(fb);
+}
+
+uint32_t cameraPoolStarvedCount() {
+    return s_poolStarved;
+}
+#else
 camera_fb_t* cameraCapture() {
     if (!s_cameraReady) {
         return nullptr;
@@ -81,12 +178,60 @@ camera_fb_t* cameraCapture() {
     return esp_camera_fb_get();
 }
 
+bool cameraRetain(camera_fb_t* fb) {
+    (void)fb;
+    return false;
+}
+
 void cameraRelease(camera_fb_t* fb) {
     if (fb) {
         esp_camera_fb_return(fb);
     }
 }
 
+uint32_t cameraPoolStarvedCount() {
+    return 0;
+}
+#endif  // CAMERA_FB_POOL_ENABLED
+
+camera_fb_t* cameraCaptureJpeg(int quality) {
+    if (!s_cameraReady || !SENSOR_HAS_JPEG) {
+        return nullptr;
+    }
+
+    sensor_t* s = esp_camera_sensor_get();
+    if (!s) {
+        return nullptr;
+    }
+
+    s->set_pixformat(s, PIXFORMAT_JPEG);
+    s->set_quality(s, quality);
+
+    // Discard one frame so the new encoder settings take effect
+    camera_fb_t* flush = esp_camera_fb_get();
+    if (flush) {
+        esp_camera_fb_return(flush);
+    }
+
+    return esp_camera_fb_get();
+}
+
+void cameraRestoreFormat() {
+    sensor_t* s = esp_camera_sensor_get();
+    if (!s) {
+        return;
+    }
+
+    s->set_pixformat(s, INITIAL_PIXEL_FORMAT);
+    s->set_quality(s, INITIAL_JPEG_QUALITY);
+
+    // Flush the first frame in the restored format
+    camera_fb_t* flush = esp_camera_fb_get();
+    if (flush) {
+        esp_camera_fb_return(flush);
+    }
+}
+
 sensor_t* cameraGetSensor() {
     return esp_camera_sensor_get();
 }
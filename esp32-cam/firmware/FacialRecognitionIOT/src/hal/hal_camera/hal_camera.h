@@ -19,18 +19,64 @@ namespace hal {
  */
 esp_err_t cameraInit();
 
+/**
+ * @brief Tear down the camera driver (watchdog recovery path)
+ *
+ * Invalidates all outstanding frame buffers and clears the pool;
+ * callers must not release frames captured before the deinit.
+ */
+void cameraDeinit();
+
 /**
  * @brief Capture a frame from the camera
+ *
+ * With the frame-buffer pool enabled the frame occupies a pool slot
+ * (reference count 1) until released by every holder; capture returns
+ * nullptr and counts a starvation when all slots are held downstream.
+ *
  * @return Pointer to frame buffer, or nullptr on failure
  */
 camera_fb_t* cameraCapture();
 
 /**
- * @brief Return frame buffer to driver
+ * @brief Take an additional reference on a captured frame
+ *
+ * Lets a pipeline stage hold a frame across the next capture with zero
+ * copies; each retain needs a matching cameraRelease.
+ *
+ * @param fb Frame buffer from cameraCapture
+ * @return false if the frame is not pool-tracked (or pool disabled)
+ */
+bool cameraRetain(camera_fb_t* fb);
+
+/**
+ * @brief Drop one reference; the buffer returns to the driver at zero
  * @param fb Frame buffer pointer
  */
 void cameraRelease(camera_fb_t* fb);
 
+/**
+ * @brief Captures refused because every pool slot was held
+ * @return Cumulative starvation count since boot
+ */
+uint32_t cameraPoolStarvedCount();
+
+/**
+ * @brief Capture one frame via the sensor's hardware JPEG encoder
+ *
+ * Temporarily switches the sensor to PIXFORMAT_JPEG. Call
+ * cameraRestoreFormat() after releasing the returned frame.
+ *
+ * @param quality JPEG quality (lower = better)
+ * @return JPEG frame buffer, or nullptr if unsupported/failed
+ */
+camera_fb_t* cameraCaptureJpeg(int quality);
+
+/**
+ * @brief Restore the configured pixel format after a JPEG capture
+ */
+void cameraRestoreFormat();
+
 /**
  * @brief Get camera sensor handle for configuration
  * @return Sensor handle or nullptr
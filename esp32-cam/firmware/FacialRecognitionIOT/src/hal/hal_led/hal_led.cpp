@@ -7,13 +7,37 @@
 #include "../../app_cfg.h"
 #include <Arduino.h>
 
+#if LED_ASYNC_FLASH == STD_ON
+#include "esp_timer.h"
+#endif
+
 namespace hal {
 
+#if LED_ASYNC_FLASH == STD_ON
+// One-shot timer that ends a flash, so ledFlash never blocks the
+// recognition loop for the flash duration
+static esp_timer_handle_t s_flashOffTimer = nullptr;
+
+static void flashOffCallback(void* arg) {
+#if defined(LED_GPIO_NUM)
+    digitalWrite(LED_GPIO_NUM, LOW);
+#endif
+}
+#endif
+
 void ledInit() {
 #if defined(LED_GPIO_NUM)
     pinMode(LED_GPIO_NUM, OUTPUT);
     digitalWrite(LED_GPIO_NUM, LOW);
 #endif
+#if LED_ASYNC_FLASH == STD_ON
+    if (!s_flashOffTimer) {
+        esp_timer_create_args_t args = {};
+        args.callback = flashOffCallback;
+        args.name = "led_flash_off";
+        esp_timer_create(&args, &s_flashOffTimer);
+    }
+#endif
 }
 
 void ledOn() {
@@ -30,10 +54,21 @@ void ledOff() {
 
 void ledFlash(int durationMs) {
 #if defined(LED_GPIO_NUM)
+#if LED_ASYNC_FLASH == STD_ON
+    digitalWrite(LED_GPIO_NUM, HIGH);
+    if (s_flashOffTimer) {
+        // Re-arm: a flash mid-flash just extends the on time
+        esp_timer_stop(s_flashOffTimer);
+        esp_timer_start_once(s_flashOffTimer, (uint64_t)durationMs * 1000);
+    } else {
+        digitalWrite(LED_GPIO_NUM, LOW);
+    }
+#else
     digitalWrite(LED_GPIO_NUM, HIGH);
     delay(durationMs);
     digitalWrite(LED_GPIO_NUM, LOW);
 #endif
+#endif
 }
 
 }  // namespace hal
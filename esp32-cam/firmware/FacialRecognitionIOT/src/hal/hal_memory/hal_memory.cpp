@@ -4,11 +4,113 @@
  */
 
 #include "hal_memory.h"
+#include "../../app_cfg.h"
 #include <Arduino.h>
 #include <esp_heap_caps.h>
 
 namespace hal {
 
+#if PSRAM_ARENA_ENABLED == STD_ON
+
+namespace {
+
+constexpr size_t kArenaAlign = 16;  // DMA/SIMD friendly
+
+struct ArenaRegion {
+    const char* name;
+    uint8_t* base;
+    MemoryArenaStats stats;
+};
+
+ArenaRegion s_arenas[(int)MemoryArena::COUNT] = {
+    { "camera",  nullptr, {} },
+    { "model",   nullptr, {} },
+    { "scratch", nullptr, {} },
+};
+
+constexpr size_t kArenaSizes[(int)MemoryArena::COUNT] = {
+    (size_t)PSRAM_ARENA_CAMERA_KB * 1024,
+    (size_t)PSRAM_ARENA_MODEL_KB * 1024,
+    (size_t)PSRAM_ARENA_SCRATCH_KB * 1024,
+};
+
+ArenaRegion* arenaFor(MemoryArena arena) {
+    int idx = (int)arena;
+    if (idx < 0 || idx >= (int)MemoryArena::COUNT) {
+        return nullptr;
+    }
+    return &s_arenas[idx];
+}
+
+}  // namespace
+
+bool memoryArenaInit() {
+    for (int i = 0; i < (int)MemoryArena::COUNT; i++) {
+        ArenaRegion* region = &s_arenas[i];
+        if (region->base) {
+            continue;  // Already carved
+        }
+        region->base = (uint8_t*)heap_caps_aligned_alloc(
+            kArenaAlign, kArenaSizes[i], MALLOC_CAP_SPIRAM);
+        if (!region->base) {
+            Serial.printf("[HAL] ERROR: %s arena (%u KB) did not fit in PSRAM\n",
+                          region->name, (unsigned)(kArenaSizes[i] / 1024));
+            return false;
+        }
+        region->stats.capacity = kArenaSizes[i];
+        Serial.printf("[HAL] Arena %s: %u KB carved\n",
+                      region->name, (unsigned)(kArenaSizes[i] / 1024));
+    }
+    return true;
+}
+
+uint8_t* memoryArenaAlloc(MemoryArena arena, size_t size) {
+    ArenaRegion* region = arenaFor(arena);
+    if (!region || !region->base || size == 0) {
+        return nullptr;
+    }
+
+    size_t aligned = (size + kArenaAlign - 1) & ~(kArenaAlign - 1);
+    if (aligned > region->stats.capacity - region->stats.used) {
+        region->stats.failCount++;
+        Serial.printf("[HAL] WARNING: %s arena full (%u requested, %u free)\n",
+                      region->name, (unsigned)size,
+                      (unsigned)(region->stats.capacity - region->stats.used));
+        return nullptr;
+    }
+
+    uint8_t* ptr = region->base + region->stats.used;
+    region->stats.used += aligned;
+    region->stats.allocCount++;
+    if (region->stats.used > region->stats.highWater) {
+        region->stats.highWater = region->stats.used;
+    }
+    return ptr;
+}
+
+void memoryArenaReset(MemoryArena arena) {
+    ArenaRegion* region = arenaFor(arena);
+    if (region) {
+        region->stats.used = 0;  // High-water mark deliberately kept
+    }
+}
+
+bool memoryArenaGetStats(MemoryArena arena, MemoryArenaStats* out) {
+    ArenaRegion* region = arenaFor(arena);
+    if (!region || !region->base || !out) {
+        return false;
+    }
+    *out = region->stats;
+    return true;
+}
+
+const char* memoryArenaName(MemoryArena arena) {
+    ArenaRegion* region = arenaFor(arena);
+    return region ? region->name : "?";
+}
+
+#endif  // PSRAM_ARENA_ENABLED
+
 bool memoryHasPsram() {
     return psramFound();
 }
@@ -31,14 +133,38 @@ void memoryFreePsram(void* ptr) {
     }
 }
 
+uint8_t* memoryAllocInternalDma(size_t size) {
+    return (uint8_t*)heap_caps_malloc(size, MALLOC_CAP_INTERNAL | MALLOC_CAP_DMA | MALLOC_CAP_8BIT);
+}
+
+size_t memoryGetLargestInternalDmaBlock() {
+    return heap_caps_get_largest_free_block(MALLOC_CAP_INTERNAL | MALLOC_CAP_DMA | MALLOC_CAP_8BIT);
+}
+
 void memoryPrintStatus() {
     if (psramFound()) {
-        Serial.printf("[HAL] PSRAM: %d total, %d free\n", 
+        Serial.printf("[HAL] PSRAM: %d total, %d free\n",
                       ESP.getPsramSize(), ESP.getFreePsram());
     } else {
         Serial.println("[HAL] WARNING: No PSRAM found!");
     }
     Serial.printf("[HAL] Heap: %d free\n", ESP.getFreeHeap());
+
+#if PSRAM_ARENA_ENABLED == STD_ON
+    for (int i = 0; i < (int)MemoryArena::COUNT; i++) {
+        const ArenaRegion* region = &s_arenas[i];
+        if (!region->base) {
+            continue;
+        }
+        Serial.printf("[HAL] Arena %s: %u/%u KB used (peak %u KB, allocs %u, fails %u)\n",
+                      region->name,
+                      (unsigned)(region->stats.used / 1024),
+                      (unsigned)(region->stats.capacity / 1024),
+                      (unsigned)(region->stats.highWater / 1024),
+                      (unsigned)region->stats.allocCount,
+                      (unsigned)region->stats.failCount);
+    }
+#endif
 }
 
 }  // namespace hal
@@ -1,7 +1,7 @@
 /**
  * @file hal_memory.h
  * @brief Hardware Abstraction Layer - Memory Management
- * 
+ *
  * PSRAM allocation and management
  */
 
@@ -13,6 +13,32 @@
 
 namespace hal {
 
+/**
+ * @brief Named PSRAM arenas carved at boot
+ *
+ * Fixed regions instead of ad-hoc ps_malloc: camera holds frame copies
+ * and the burst-capture ring, model holds the tensor arena and model
+ * data, scratch is per-operation working memory that callers reset
+ * wholesale between uses.
+ */
+enum class MemoryArena {
+    CAMERA = 0,
+    MODEL,
+    SCRATCH,
+    COUNT
+};
+
+/**
+ * @brief Per-arena usage statistics
+ */
+struct MemoryArenaStats {
+    size_t capacity;        // Region size in bytes
+    size_t used;            // Currently allocated bytes
+    size_t highWater;       // Peak used since boot (survives resets)
+    uint32_t allocCount;    // Successful allocations
+    uint32_t failCount;     // Allocations refused for lack of space
+};
+
 /**
  * @brief Check if PSRAM is available
  * @return true if PSRAM found
@@ -44,6 +70,61 @@ uint8_t* memoryAllocPsram(size_t size);
  */
 void memoryFreePsram(void* ptr);
 
+/**
+ * @brief Allocate from internal DMA-capable SRAM (never PSRAM)
+ * @param size Size in bytes
+ * @return Pointer to allocated memory, or nullptr on failure
+ */
+uint8_t* memoryAllocInternalDma(size_t size);
+
+/**
+ * @brief Largest contiguous free block of internal DMA-capable SRAM
+ * @return Block size in bytes
+ */
+size_t memoryGetLargestInternalDmaBlock();
+
+/**
+ * @brief Carve the named arenas out of PSRAM - call once at boot
+ *
+ * Each region is one contiguous heap_caps_malloc, so later allocations
+ * can neither fragment PSRAM nor fail once init has succeeded within
+ * the configured budgets.
+ *
+ * @return true if all arenas were carved
+ */
+bool memoryArenaInit();
+
+/**
+ * @brief Bump-allocate from a named arena - O(1), 16-byte aligned
+ * @param arena Arena to allocate from
+ * @param size Size in bytes
+ * @return Pointer into the arena, or nullptr if the region is full
+ * @note Individual blocks cannot be freed; reclaim by resetting the
+ *       whole arena (intended for SCRATCH only).
+ */
+uint8_t* memoryArenaAlloc(MemoryArena arena, size_t size);
+
+/**
+ * @brief Reset an arena to empty - invalidates everything allocated from it
+ * @param arena Arena to reset
+ */
+void memoryArenaReset(MemoryArena arena);
+
+/**
+ * @brief Read an arena's usage statistics
+ * @param arena Arena to query
+ * @param out Filled with the current stats
+ * @return false if the arena was never initialized
+ */
+bool memoryArenaGetStats(MemoryArena arena, MemoryArenaStats* out);
+
+/**
+ * @brief Short arena name for diagnostics
+ * @param arena Arena to name
+ * @return Static string ("camera", "model", "scratch")
+ */
+const char* memoryArenaName(MemoryArena arena);
+
 /**
  * @brief Print memory status to serial
  */
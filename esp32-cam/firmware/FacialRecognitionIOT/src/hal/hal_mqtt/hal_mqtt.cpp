@@ -14,20 +14,46 @@ namespace hal {
 static WiFiClient espClient;
 static PubSubClient mqttClient(espClient);
 static bool s_mqttReady = false;
+static MqttMessageHandler s_messageHandler = nullptr;
 
-// MQTT callback for incoming messages (if needed)
+// Presence: topic built once at init; the Last Will retains the
+// offline document when the broker loses the session, the heartbeat
+// refreshes the online one
+#define MQTT_PRESENCE_OFFLINE  "{\"state\":\"offline\"}"
+static char s_presenceTopic[128] = {0};
+
+// Open chunked-publish packet (mqttBeginPublish..mqttEndPublish) - the
+// connection carries one packet at a time, so everything else waits
+static bool s_packetOpen = false;
+
+// Background stream: one staged payload drained in budgeted slices
+// from mqttProcess(). The stage is PSRAM, allocated on first use.
+static uint8_t* s_streamStage = nullptr;
+static size_t s_streamLen = 0;
+static size_t s_streamSent = 0;
+
+// MQTT callback for incoming messages - payloads may be binary
+// (enrollment vectors), so only the length is logged here
 void mqttCallback(char* topic, byte* payload, unsigned int length) {
-    Serial.printf("[MQTT] Received on %s: ", topic);
-    for (int i = 0; i < length; i++) {
-        Serial.print((char)payload[i]);
+    Serial.printf("[MQTT] Received %u bytes on %s\n", length, topic);
+    if (s_messageHandler) {
+        s_messageHandler(topic, payload, length);
     }
-    Serial.println();
+}
+
+void mqttSetMessageHandler(MqttMessageHandler handler) {
+    s_messageHandler = handler;
 }
 
 bool mqttInit() {
-    // Configure MQTT client
+    // Configure MQTT client. The default 256-byte packet buffer is too
+    // small for model-update chunks and the larger JSON payloads.
+    mqttClient.setBufferSize(MQTT_BUFFER_SIZE);
     mqttClient.setServer(MQTT_BROKER, MQTT_PORT);
     mqttClient.setCallback(mqttCallback);
+
+    snprintf(s_presenceTopic, sizeof(s_presenceTopic),
+             "%s/%s/presence", MQTT_TOPIC_BASE, MQTT_LOCATION);
     
     // Attempt connection
     if (mqttReconnect()) {
@@ -44,6 +70,24 @@ bool mqttIsConnected() {
     return mqttClient.connected();
 }
 
+/**
+ * @brief Publish the retained presence heartbeat
+ *
+ * Compact uptime/heap document on the presence topic; the Last Will
+ * overwrites it with {"state":"offline"} if the kiosk dies, so fleet
+ * liveness is event-driven.
+ */
+static void mqttPublishPresence() {
+    char payload[128];
+    snprintf(payload, sizeof(payload),
+             "{\"state\":\"online\",\"uptime_s\":%lu,"
+             "\"heap\":%u,\"min_heap\":%u}",
+             (unsigned long)(millis() / 1000UL),
+             (unsigned)ESP.getFreeHeap(),
+             (unsigned)ESP.getMinFreeHeap());
+    mqttClient.publish(s_presenceTopic, payload, true);
+}
+
 bool mqttReconnect() {
     if (mqttClient.connected()) {
         return true;
@@ -55,12 +99,16 @@ bool mqttReconnect() {
     char clientId[50];
     snprintf(clientId, sizeof(clientId), "%s-%llX", MQTT_CLIENT_ID, ESP.getEfuseMac());
     
-    // Attempt to connect
+    // Attempt to connect, registering the Last Will so the broker
+    // retains the offline presence document if the session dies
     bool connected = false;
 #ifdef MQTT_USERNAME
-    connected = mqttClient.connect(clientId, MQTT_USERNAME, MQTT_PASSWORD);
+    connected = mqttClient.connect(clientId, MQTT_USERNAME, MQTT_PASSWORD,
+                                   s_presenceTopic, 1, true,
+                                   MQTT_PRESENCE_OFFLINE);
 #else
-    connected = mqttClient.connect(clientId);
+    connected = mqttClient.connect(clientId, s_presenceTopic, 1, true,
+                                   MQTT_PRESENCE_OFFLINE);
 #endif
     
     if (!connected) {
@@ -70,10 +118,17 @@ bool mqttReconnect() {
     
     Serial.println("[MQTT] Connected!");
     s_mqttReady = true;
+    mqttPublishPresence();  // Overwrite the retained offline doc
     return true;
 }
 
 bool mqttPublish(const char* topic, const char* payload) {
+    if (s_packetOpen || s_streamLen > 0) {
+        // A chunked packet owns the connection - interleaving a normal
+        // publish would corrupt the wire protocol
+        return false;
+    }
+
     if (!mqttClient.connected()) {
         Serial.println("[MQTT] Not connected, attempting reconnect");
         if (!mqttReconnect()) {
@@ -90,6 +145,150 @@ bool mqttPublish(const char* topic, const char* payload) {
     }
 }
 
+bool mqttBeginPublish(const char* topic, size_t totalLen) {
+    if (!mqttClient.connected() || s_packetOpen || s_streamLen > 0) {
+        return false;
+    }
+
+    if (!mqttClient.beginPublish(topic, totalLen, false)) {
+        Serial.printf("[MQTT] beginPublish failed, rc=%d\n", mqttClient.state());
+        return false;
+    }
+
+    s_packetOpen = true;
+    return true;
+}
+
+size_t mqttWritePayload(const uint8_t* data, size_t len) {
+    if (!s_packetOpen) {
+        return 0;
+    }
+
+    size_t sent = 0;
+    while (sent < len) {
+        size_t chunk = len - sent;
+        if (chunk > THUMBNAIL_MQTT_CHUNK) {
+            chunk = THUMBNAIL_MQTT_CHUNK;
+        }
+        if (mqttClient.write(data + sent, chunk) != chunk) {
+            break;  // Socket backpressure - caller retries the rest
+        }
+        sent += chunk;
+    }
+    return sent;
+}
+
+bool mqttEndPublish() {
+    if (!s_packetOpen) {
+        return false;
+    }
+
+    s_packetOpen = false;
+    if (!mqttClient.endPublish()) {
+        Serial.printf("[MQTT] endPublish failed, rc=%d\n", mqttClient.state());
+        return false;
+    }
+    return true;
+}
+
+bool mqttPublishBinary(const char* topic, const uint8_t* data, size_t len) {
+    if (!mqttBeginPublish(topic, len)) {
+        return false;
+    }
+
+    if (mqttWritePayload(data, len) != len) {
+        Serial.println("[MQTT] Chunked write failed");
+        mqttEndPublish();
+        return false;
+    }
+
+    if (!mqttEndPublish()) {
+        return false;
+    }
+
+    Serial.printf("[MQTT] Published %u bytes to %s\n", (unsigned)len, topic);
+    return true;
+}
+
+bool mqttStreamPublish(const char* topic, const uint8_t* data, size_t len) {
+    if (!mqttClient.connected() || s_packetOpen || s_streamLen > 0) {
+        return false;
+    }
+
+    if (len > MQTT_STREAM_STAGE_KB * 1024u) {
+        // Too big to stage - take the blocking path rather than drop it
+        return mqttPublishBinary(topic, data, len);
+    }
+
+    if (!s_streamStage) {
+        s_streamStage = (uint8_t*)ps_malloc(MQTT_STREAM_STAGE_KB * 1024u);
+        if (!s_streamStage) {
+            Serial.println("[MQTT] Stream stage allocation failed");
+            return mqttPublishBinary(topic, data, len);
+        }
+    }
+
+    if (!mqttClient.beginPublish(topic, len, false)) {
+        Serial.printf("[MQTT] beginPublish failed, rc=%d\n", mqttClient.state());
+        return false;
+    }
+
+    memcpy(s_streamStage, data, len);
+    s_streamLen = len;
+    s_streamSent = 0;
+    return true;
+}
+
+bool mqttStreamActive() {
+    return s_streamLen > 0;
+}
+
+/**
+ * @brief Drain one budgeted slice of the background stream
+ *
+ * Called from mqttProcess(). The packet stays open across calls; the
+ * budget bounds how long any single loop iteration spends on the
+ * socket, so a thumbnail-sized publish costs a few 15 ms slices
+ * instead of one long stall.
+ */
+static void mqttStreamPump() {
+    if (s_streamLen == 0) {
+        return;
+    }
+
+    if (!mqttClient.connected()) {
+        // Connection died mid-packet - abandon the stream; the next
+        // reconnect starts from a clean socket
+        s_streamLen = 0;
+        s_streamSent = 0;
+        return;
+    }
+
+    unsigned long start = millis();
+    while (s_streamSent < s_streamLen &&
+           millis() - start < MQTT_STREAM_BUDGET_MS) {
+        size_t chunk = s_streamLen - s_streamSent;
+        if (chunk > THUMBNAIL_MQTT_CHUNK) {
+            chunk = THUMBNAIL_MQTT_CHUNK;
+        }
+        if (mqttClient.write(s_streamStage + s_streamSent, chunk) != chunk) {
+            return;  // Backpressure - resume next pump
+        }
+        s_streamSent += chunk;
+    }
+
+    if (s_streamSent >= s_streamLen) {
+        size_t len = s_streamLen;
+        s_streamLen = 0;
+        s_streamSent = 0;
+        if (mqttClient.endPublish()) {
+            Serial.printf("[MQTT] Streamed %u bytes\n", (unsigned)len);
+        } else {
+            Serial.printf("[MQTT] endPublish failed, rc=%d\n", mqttClient.state());
+        }
+    }
+}
+
 bool mqttSubscribe(const char* topic) {
     if (!mqttClient.connected()) {
         return false;
@@ -117,9 +316,20 @@ void mqttProcess() {
                     lastReconnectAttempt = 0;
                 }
             }
-        } else {
+        } else if (s_streamLen > 0) {
+            // Mid-packet: drain a slice; loop() must wait until the
+            // packet closes or it would interleave into the stream
+            mqttStreamPump();
+        } else if (!s_packetOpen) {
             // Process incoming messages
             mqttClient.loop();
+
+            // Retained liveness heartbeat
+            static unsigned long lastPresenceMs = 0;
+            if (millis() - lastPresenceMs >= MQTT_PRESENCE_INTERVAL_MS) {
+                lastPresenceMs = millis();
+                mqttPublishPresence();
+            }
         }
     }
 }
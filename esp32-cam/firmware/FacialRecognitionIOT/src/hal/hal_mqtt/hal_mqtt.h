@@ -12,12 +12,25 @@
 
 namespace hal {
 
+/**
+ * @brief Handler for incoming MQTT messages
+ * @note Payload may be binary and is only valid for the call duration
+ */
+typedef void (*MqttMessageHandler)(const char* topic, const uint8_t* payload,
+                                   unsigned int length);
+
 /**
  * @brief Initialize MQTT connection
  * @return true if connected to broker
  */
 bool mqttInit();
 
+/**
+ * @brief Register the handler invoked for subscribed-topic messages
+ * @param handler Handler function, or nullptr to clear
+ */
+void mqttSetMessageHandler(MqttMessageHandler handler);
+
 /**
  * @brief Check if connected to MQTT broker
  * @return true if connected
@@ -38,6 +51,68 @@ bool mqttReconnect();
  */
 bool mqttPublish(const char* topic, const char* payload);
 
+/**
+ * @brief Publish a binary payload of arbitrary size in bounded chunks
+ *
+ * Streams straight from the caller's buffer via beginPublish/write, so
+ * payloads larger than the client buffer (e.g. JPEG frames) go out
+ * without an intermediate copy.
+ *
+ * @param topic MQTT topic
+ * @param data Payload bytes
+ * @param len Payload length
+ * @return true on success
+ */
+bool mqttPublishBinary(const char* topic, const uint8_t* data, size_t len);
+
+/**
+ * @brief Open a chunked publish for incremental writes
+ *
+ * Claims the connection until mqttEndPublish(); other publishes and
+ * inbound processing are held off while a packet is open.
+ *
+ * @param topic MQTT topic
+ * @param totalLen Total payload length that will be written
+ * @return true if the packet header went out
+ */
+bool mqttBeginPublish(const char* topic, size_t totalLen);
+
+/**
+ * @brief Write part of an open chunked publish
+ * @param data Payload bytes
+ * @param len Bytes to write
+ * @return Bytes actually accepted (short on socket backpressure)
+ */
+size_t mqttWritePayload(const uint8_t* data, size_t len);
+
+/**
+ * @brief Close a chunked publish opened with mqttBeginPublish()
+ * @return true on success
+ */
+bool mqttEndPublish();
+
+/**
+ * @brief Publish a large payload in the background
+ *
+ * Copies the payload into a PSRAM staging buffer and returns at once;
+ * mqttProcess() streams it out in MQTT_STREAM_BUDGET_MS slices, so the
+ * caller's loop never blocks on a big publish. One stream at a time -
+ * returns false while a previous one is still draining. Payloads over
+ * MQTT_STREAM_STAGE_KB fall back to the blocking chunked path.
+ *
+ * @param topic MQTT topic
+ * @param data Payload bytes (free to reuse after return)
+ * @param len Payload length
+ * @return true if the stream was accepted (or the fallback succeeded)
+ */
+bool mqttStreamPublish(const char* topic, const uint8_t* data, size_t len);
+
+/**
+ * @brief Check whether a background stream is still draining
+ * @return true while a stream is in flight
+ */
+bool mqttStreamActive();
+
 /**
  * @brief Subscribe to topic (optional for future features)
  * @param topic MQTT topic
@@ -27,19 +27,21 @@
 // Camera configuration (sensor selection + initialization)
 #include "cam_config.h"
 
-// Model data (stored in PROGMEM)
-#include "model_data.h"
+// Shared library: model blob, class labels and preprocessing kernel
+// (single copy used by both face-recognition firmwares)
+#include "../libraries/FaceRecognitionCommon/src/model_data.h"
+#include "../libraries/FaceRecognitionCommon/src/class_labels.h"
+#include "../libraries/FaceRecognitionCommon/src/face_preprocess.h"
 
 // MQTT Client for publishing recognition events
 #include "mqtt_client.h"
 
 // ==================== CONFIGURATION ====================
 
-// Model configuration
-#define MODEL_INPUT_WIDTH   96
-#define MODEL_INPUT_HEIGHT  96
+// Model configuration (input dims come from the shared library)
+#define MODEL_INPUT_WIDTH   FACEREC_MODEL_DIM
+#define MODEL_INPUT_HEIGHT  FACEREC_MODEL_DIM
 #define MODEL_INPUT_CHANNELS 3
-#define NUM_CLASSES         5
 
 // Confidence threshold for recognition
 #define CONFIDENCE_THRESHOLD 0.995f
@@ -47,16 +49,6 @@
 // Enable/disable MQTT publishing
 #define MQTT_ENABLED        1
 
-// ==================== CLASS LABELS ====================
-
-static const char* kLabels[] = {
-    "maha",
-    "mokhtar",
-    "omar",
-    "radwan",
-    "tarek"
-};
-
 // ==================== TFLite GLOBALS ====================
 
 const tflite::Model* model = nullptr;
@@ -126,72 +118,13 @@ void draw_box(camera_fb_t* fb, int x, int y, int w, int h, uint16_t color) {
 // ==================== IMAGE PREPROCESSING ====================
 
 void process_image(camera_fb_t* fb) {
-    if (!fb || !input) return;
-
-    // Smart Crop Logic:
-    // Use sensor-specific crop settings from cam_config.h
-    int min_side = CROP_SIZE;
-    int crop_x_start = CROP_X_OFFSET;
-    int crop_y_start = CROP_Y_OFFSET;
-
-    uint16_t* rgb565 = (uint16_t*)fb->buf;
-
-    if (input->type == kTfLiteUInt8) {
-        // Quantized model - use uint8 input
-        uint8_t* input_data = input->data.uint8;
-
-        for (int y = 0; y < MODEL_INPUT_HEIGHT; y++) {
-            for (int x = 0; x < MODEL_INPUT_WIDTH; x++) {
-                // Map output coords to cropped input coords
-                int src_x = crop_x_start + (x * min_side) / MODEL_INPUT_WIDTH;
-                int src_y = crop_y_start + (y * min_side) / MODEL_INPUT_HEIGHT;
-
-                // Clamp to valid range
-                if (src_x >= fb->width) src_x = fb->width - 1;
-                if (src_y >= fb->height) src_y = fb->height - 1;
-
-                int src_idx = src_y * fb->width + src_x;
-                uint16_t pixel = rgb565[src_idx];
-
-                // Extract RGB from RGB565
-                uint8_t r = ((pixel >> 11) & 0x1F) << 3;
-                uint8_t g = ((pixel >> 5) & 0x3F) << 2;
-                uint8_t b = (pixel & 0x1F) << 3;
-
-                // Store as uint8 (0-255)
-                int out_idx = (y * MODEL_INPUT_WIDTH + x) * 3;
-                input_data[out_idx + 0] = r;
-                input_data[out_idx + 1] = g;
-                input_data[out_idx + 2] = b;
-            }
-        }
-    } else if (input->type == kTfLiteFloat32) {
-        // Float model
-        float* input_data = input->data.f;
-
-        for (int y = 0; y < MODEL_INPUT_HEIGHT; y++) {
-            for (int x = 0; x < MODEL_INPUT_WIDTH; x++) {
-                int src_x = crop_x_start + (x * min_side) / MODEL_INPUT_WIDTH;
-                int src_y = crop_y_start + (y * min_side) / MODEL_INPUT_HEIGHT;
-
-                if (src_x >= fb->width) src_x = fb->width - 1;
-                if (src_y >= fb->height) src_y = fb->height - 1;
-
-                int src_idx = src_y * fb->width + src_x;
-                uint16_t pixel = rgb565[src_idx];
-
-                uint8_t r = ((pixel >> 11) & 0x1F) << 3;
-                uint8_t g = ((pixel >> 5) & 0x3F) << 2;
-                uint8_t b = (pixel & 0x1F) << 3;
-
-                // Normalize to [-1, 1] for MobileNetV2
-                int out_idx = (y * MODEL_INPUT_WIDTH + x) * 3;
-                input_data[out_idx + 0] = (r / 127.5f) - 1.0f;
-                input_data[out_idx + 1] = (g / 127.5f) - 1.0f;
-                input_data[out_idx + 2] = (b / 127.5f) - 1.0f;
-            }
-        }
-    }
+    // Crop/resize/convert via the shared kernel (coordinate maps +
+    // LUTs); sensor-specific crop settings come from cam_config.h
+    facerec::CropGeometry geo = {
+        fb ? fb->width : 0, fb ? fb->height : 0,
+        CROP_SIZE, CROP_X_OFFSET, CROP_Y_OFFSET
+    };
+    facerec::preprocessRgb565(fb, input, geo);
 }
 
 // ==================== SETUP ====================
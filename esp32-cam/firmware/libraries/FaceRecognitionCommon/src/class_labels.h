@@ -1,8 +1,9 @@
-// Auto-generated class labels
-// Generated from: class_labels.json
-// Number of classes: 5
-//
-// Copy this to your ESP32 project to keep labels in sync with training
+/**
+ * @file class_labels.h
+ * @brief Face Recognition Class Labels
+ * 
+ * Auto-generated class labels matching model output indices
+ */
 
 #ifndef CLASS_LABELS_H
 #define CLASS_LABELS_H
@@ -18,8 +19,12 @@ static const char* kLabels[NUM_CLASSES] = {
     "tarek"
 };
 
-// Helper function to get label from index
-inline const char* get_class_label(int index) {
+/**
+ * @brief Get label from class index
+ * @param index Class index (0 to NUM_CLASSES-1)
+ * @return Label string or "Unknown" if invalid
+ */
+inline const char* getClassLabel(int index) {
     if (index >= 0 && index < NUM_CLASSES) {
         return kLabels[index];
     }
@@ -0,0 +1,106 @@
+/**
+ * @file face_preprocess.h
+ * @brief Shared RGB565 Preprocessing Kernel
+ *
+ * One implementation of the crop/resize/convert kernel used by both
+ * face-recognition firmwares, so optimizations land in each at once.
+ * Header-only on purpose: sketches include it via a relative path and
+ * need no library installation step.
+ *
+ * The kernel precomputes source coordinate maps and channel/float
+ * lookup tables for a given crop geometry and rebuilds them only when
+ * the geometry changes.
+ */
+
+#ifndef FACE_PREPROCESS_H
+#define FACE_PREPROCESS_H
+
+#include "esp_camera.h"
+#include "tensorflow/lite/micro/micro_interpreter.h"
+
+// Model input is fixed at 96x96 across the fleet; bump if retrained
+#define FACEREC_MODEL_DIM 96
+
+namespace facerec {
+
+/**
+ * @brief Crop geometry, normally filled from the firmware's config macros
+ */
+struct CropGeometry {
+    int frameWidth;
+    int frameHeight;
+    int cropSize;
+    int cropXOffset;
+    int cropYOffset;
+};
+
+/**
+ * @brief Crop, resize and convert an RGB565 frame into the input tensor
+ *
+ * Handles uint8 (raw 0-255) and float32 ([-1, 1] MobileNetV2) inputs.
+ *
+ * @param fb Camera frame (RGB565)
+ * @param input Model input tensor
+ * @param geo Crop geometry
+ */
+inline void preprocessRgb565(const camera_fb_t* fb, TfLiteTensor* input,
+                             const CropGeometry& geo) {
+    if (!fb || !input) return;
+
+    // LUTs and coordinate maps, rebuilt only when geometry changes
+    static uint16_t srcXMap[FACEREC_MODEL_DIM];
+    static uint32_t srcRowBase[FACEREC_MODEL_DIM];
+    static uint8_t expand5[32];
+    static uint8_t expand6[64];
+    static float norm[256];
+    static CropGeometry cached = {0, 0, 0, 0, 0};
+
+    if (cached.frameWidth != geo.frameWidth || cached.frameHeight != geo.frameHeight ||
+        cached.cropSize != geo.cropSize || cached.cropXOffset != geo.cropXOffset ||
+        cached.cropYOffset != geo.cropYOffset) {
+        for (int x = 0; x < FACEREC_MODEL_DIM; x++) {
+            int srcX = geo.cropXOffset + (x * geo.cropSize) / FACEREC_MODEL_DIM;
+            if (srcX >= geo.frameWidth) srcX = geo.frameWidth - 1;
+            srcXMap[x] = (uint16_t)srcX;
+        }
+        for (int y = 0; y < FACEREC_MODEL_DIM; y++) {
+            int srcY = geo.cropYOffset + (y * geo.cropSize) / FACEREC_MODEL_DIM;
+            if (srcY >= geo.frameHeight) srcY = geo.frameHeight - 1;
+            srcRowBase[y] = (uint32_t)srcY * geo.frameWidth;
+        }
+        for (int i = 0; i < 32; i++) expand5[i] = (uint8_t)(i << 3);
+        for (int i = 0; i < 64; i++) expand6[i] = (uint8_t)(i << 2);
+        for (int i = 0; i < 256; i++) norm[i] = (i / 127.5f) - 1.0f;
+        cached = geo;
+    }
+
+    const uint16_t* rgb565 = (const uint16_t*)fb->buf;
+
+    if (input->type == kTfLiteUInt8) {
+        uint8_t* out = input->data.uint8;
+        for (int y = 0; y < FACEREC_MODEL_DIM; y++) {
+            const uint16_t* srcRow = rgb565 + srcRowBase[y];
+            for (int x = 0; x < FACEREC_MODEL_DIM; x++) {
+                uint16_t pixel = srcRow[srcXMap[x]];
+                *out++ = expand5[(pixel >> 11) & 0x1F];
+                *out++ = expand6[(pixel >> 5) & 0x3F];
+                *out++ = expand5[pixel & 0x1F];
+            }
+        }
+    } else if (input->type == kTfLiteFloat32) {
+        float* out = input->data.f;
+        for (int y = 0; y < FACEREC_MODEL_DIM; y++) {
+            const uint16_t* srcRow = rgb565 + srcRowBase[y];
+            for (int x = 0; x < FACEREC_MODEL_DIM; x++) {
+                uint16_t pixel = srcRow[srcXMap[x]];
+                *out++ = norm[expand5[(pixel >> 11) & 0x1F]];
+                *out++ = norm[expand6[(pixel >> 5) & 0x3F]];
+                *out++ = norm[expand5[pixel & 0x1F]];
+            }
+        }
+    }
+}
+
+}  // namespace facerec
+
+#endif // FACE_PREPROCESS_H
@@ -0,0 +1,138 @@
+#include <Arduino.h>
+#include <Preferences.h>
+#include <stddef.h>
+#include "app_config.h"
+#include "../../app_cfg.h"
+#include "../thermostat/thermostat_config.h"
+
+#if CONFIG_CACHE_ENABLED == STD_ON
+
+static AppConfig_t g_config;
+static bool g_dirty = false;
+
+// Field descriptor table for key=value updates over MQTT
+typedef enum {
+    CFG_FIELD_STR,
+    CFG_FIELD_U16,
+    CFG_FIELD_F32
+} ConfigFieldType_t;
+
+typedef struct {
+    const char* key;
+    ConfigFieldType_t type;
+    size_t offset;
+    size_t size;    // Buffer capacity for CFG_FIELD_STR
+} ConfigField_t;
+
+static const ConfigField_t g_fields[] = {
+    { "ssid",      CFG_FIELD_STR, offsetof(AppConfig_t, wifi_ssid),       sizeof(g_config.wifi_ssid) },
+    { "pass",      CFG_FIELD_STR, offsetof(AppConfig_t, wifi_password),   sizeof(g_config.wifi_password) },
+    { "broker",    CFG_FIELD_STR, offsetof(AppConfig_t, mqtt_broker),     sizeof(g_config.mqtt_broker) },
+    { "port",      CFG_FIELD_U16, offsetof(AppConfig_t, mqtt_port),       0 },
+    { "temp_db",   CFG_FIELD_F32, offsetof(AppConfig_t, temp_deadband),   0 },
+    { "hum_db",    CFG_FIELD_F32, offsetof(AppConfig_t, hum_deadband),    0 },
+    { "gas_db",    CFG_FIELD_F32, offsetof(AppConfig_t, gas_deadband),    0 },
+    { "ldr_db",    CFG_FIELD_F32, offsetof(AppConfig_t, ldr_deadband),    0 },
+    { "temp_ms",   CFG_FIELD_U16, offsetof(AppConfig_t, temp_sample_ms),  0 },
+    { "input_ms",  CFG_FIELD_U16, offsetof(AppConfig_t, input_sample_ms), 0 },
+};
+
+#define CONFIG_FIELD_COUNT  (sizeof(g_fields) / sizeof(g_fields[0]))
+
+/**
+ * @brief Fill the cache from the compile-time macros
+ */
+static void Config_LoadDefaults(void)
+{
+    memset(&g_config, 0, sizeof(g_config));
+    g_config.version = CONFIG_BLOB_VERSION;
+    strlcpy(g_config.wifi_ssid, WIFI_SSID, sizeof(g_config.wifi_ssid));
+    strlcpy(g_config.wifi_password, WIFI_PASSWORD, sizeof(g_config.wifi_password));
+    strlcpy(g_config.mqtt_broker, MQTT_BROKER, sizeof(g_config.mqtt_broker));
+    g_config.mqtt_port       = MQTT_PORT;
+    g_config.temp_deadband   = REPORT_TEMP_DEADBAND;
+    g_config.hum_deadband    = REPORT_HUM_DEADBAND;
+    g_config.gas_deadband    = REPORT_GAS_DEADBAND;
+    g_config.ldr_deadband    = REPORT_LDR_DEADBAND;
+    g_config.temp_sample_ms  = TEMP_SENSOR_SAMPLE_RATE_MS;
+    g_config.input_sample_ms = INPUT_SAMPLE_RATE_MS;
+}
+
+void Config_Init(void)
+{
+    Config_LoadDefaults();
+
+    Preferences prefs;
+    prefs.begin("config", true);
+    size_t got = prefs.getBytes("blob", &g_config, sizeof(g_config));
+    prefs.end();
+
+    if (got != sizeof(g_config) || g_config.version != CONFIG_BLOB_VERSION) {
+        // No blob, or the layout changed - run on macro defaults. Not
+        // written back here: NVS only carries deliberate overrides.
+        if (got != 0) {
+            Serial.println("[CONFIG] Stored blob stale, using defaults");
+        }
+        Config_LoadDefaults();
+        return;
+    }
+
+    Serial.printf("[CONFIG] Loaded from NVS (broker %s:%u)\n",
+                  g_config.mqtt_broker, (unsigned)g_config.mqtt_port);
+}
+
+const AppConfig_t* Config_Get(void)
+{
+    return &g_config;
+}
+
+bool Config_Apply(const char* key, const char* value)
+{
+    for (size_t i = 0; i < CONFIG_FIELD_COUNT; i++) {
+        if (strcmp(key, g_fields[i].key) != 0) continue;
+
+        void* field = (uint8_t*)&g_config + g_fields[i].offset;
+        switch (g_fields[i].type) {
+            case CFG_FIELD_STR:
+                if (strncmp((char*)field, value, g_fields[i].size) == 0) {
+                    return true;  // Unchanged - nothing to commit
+                }
+                strlcpy((char*)field, value, g_fields[i].size);
+                break;
+            case CFG_FIELD_U16: {
+                uint16_t v = (uint16_t)atoi(value);
+                if (*(uint16_t*)field == v) return true;
+                *(uint16_t*)field = v;
+                break;
+            }
+            case CFG_FIELD_F32: {
+                float v = atof(value);
+                if (*(float*)field == v) return true;
+                *(float*)field = v;
+                break;
+            }
+        }
+        g_dirty = true;
+        return true;
+    }
+    return false;
+}
+
+void Config_Commit(void)
+{
+    if (!g_dirty) return;
+
+    Preferences prefs;
+    prefs.begin("config", false);
+    size_t written = prefs.putBytes("blob", &g_config, sizeof(g_config));
+    prefs.end();
+
+    if (written == sizeof(g_config)) {
+        g_dirty = false;
+        Serial.println("[CONFIG] Committed to NVS");
+    } else {
+        Serial.println("[ERROR] Config commit failed");
+    }
+}
+
+#endif /* CONFIG_CACHE_ENABLED */
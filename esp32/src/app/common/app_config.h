@@ -0,0 +1,57 @@
+#ifndef APP_CONFIG_H
+#define APP_CONFIG_H
+
+#include <stdint.h>
+#include <stdbool.h>
+
+/**
+ * @brief Runtime configuration cache
+ *
+ * One packed blob loaded from NVS at boot (a single read) into a
+ * read-mostly struct; every default comes from the existing app_cfg.h
+ * macros, so a device with no stored config behaves exactly as before.
+ * Hot paths read plain struct fields through Config_Get() - same cost
+ * as the macros they replace. Per-site tuning arrives over the MQTT
+ * config topic as "key=value" and commits to NVS only when a field
+ * actually changed, so flash wear stays bounded.
+ */
+
+#define CONFIG_BLOB_VERSION  1
+
+typedef struct __attribute__((packed)) {
+    uint16_t version;            // CONFIG_BLOB_VERSION - mismatch = defaults
+    char     wifi_ssid[32];
+    char     wifi_password[64];
+    char     mqtt_broker[48];
+    uint16_t mqtt_port;
+    float    temp_deadband;      // REPORT_TEMP_DEADBAND
+    float    hum_deadband;       // REPORT_HUM_DEADBAND
+    float    gas_deadband;       // REPORT_GAS_DEADBAND
+    float    ldr_deadband;       // REPORT_LDR_DEADBAND
+    uint16_t temp_sample_ms;     // TEMP_SENSOR_SAMPLE_RATE_MS
+    uint16_t input_sample_ms;    // INPUT_SAMPLE_RATE_MS
+} AppConfig_t;
+
+/**
+ * @brief Load the blob from NVS (or seed from macros) - call from
+ *        setup() before WiFi/MQTT init
+ */
+void Config_Init(void);
+
+/**
+ * @brief Read-mostly cache - valid after Config_Init, never reallocated
+ */
+const AppConfig_t* Config_Get(void);
+
+/**
+ * @brief Set one field by name ("broker", "port", "temp_db", ...)
+ * @return true if the key was known and the value parsed
+ */
+bool Config_Apply(const char* key, const char* value);
+
+/**
+ * @brief Persist to NVS if any field changed since the last commit
+ */
+void Config_Commit(void);
+
+#endif // APP_CONFIG_H
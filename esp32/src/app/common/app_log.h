@@ -0,0 +1,39 @@
+#ifndef APP_LOG_H
+#define APP_LOG_H
+
+#include <Arduino.h>
+#include "../../app_cfg.h"
+
+/*
+ * Leveled compile-time logging.
+ *
+ * LOG_E/W/I/D(module, fmt, ...) route every print site through one
+ * macro whose condition is built from two integer constants: the
+ * module's ceiling (LOG_LEVEL_<module> in app_cfg.h) and the global cap
+ * (LOG_LEVEL_GLOBAL, overridable from the build). The compiler folds
+ * the condition, so a site below the effective level costs zero cycles
+ * and its format string never reaches flash. `make log-audit` in the
+ * repo root builds with the cap at OFF and fails if any log string
+ * survives in the image.
+ *
+ * The older families (DEBUG_PRINT in thermostat_config.h, ROOM_DEBUG_*
+ * in room_config.h, the per-HAL DEBUG_PRINTLN locals) honour
+ * LOG_LEVEL_GLOBAL too, so one -D flag strips the lot.
+ */
+
+#define LOG_SITE(module, level, prefix, fmt, ...)           \
+    do {                                                    \
+        if (LOG_LEVEL_GLOBAL >= (level) &&                  \
+            LOG_LEVEL_##module >= (level)) {                \
+            Serial.print(prefix);                           \
+            Serial.printf(fmt, ##__VA_ARGS__);              \
+            Serial.println();                               \
+        }                                                   \
+    } while (0)
+
+#define LOG_E(module, fmt, ...) LOG_SITE(module, LOG_LEVEL_ERROR, "[ERROR] ",       fmt, ##__VA_ARGS__)
+#define LOG_W(module, fmt, ...) LOG_SITE(module, LOG_LEVEL_WARN,  "[" #module "] ", fmt, ##__VA_ARGS__)
+#define LOG_I(module, fmt, ...) LOG_SITE(module, LOG_LEVEL_INFO,  "[" #module "] ", fmt, ##__VA_ARGS__)
+#define LOG_D(module, fmt, ...) LOG_SITE(module, LOG_LEVEL_DEBUG, "[" #module "] ", fmt, ##__VA_ARGS__)
+
+#endif /* APP_LOG_H */
@@ -0,0 +1,105 @@
+#include <Arduino.h>
+#include <stdio.h>
+#include "esp_system.h"
+#include "blackbox.h"
+#include "../../hal/communication/hal_mqtt/hal_mqtt.h"
+
+#if BLACKBOX_ENABLED == STD_ON
+
+// A magic word guards against reading uninitialized RTC memory after a
+// cold boot, exactly like the store-and-forward ring
+#define BLACKBOX_MAGIC  0x42424F58UL  // "BBOX"
+
+typedef struct {
+    uint32_t timestamp_ms;
+    uint8_t  task;
+    uint8_t  event;
+    uint16_t arg;
+} BlackboxRecord_t;
+
+RTC_NOINIT_ATTR static BlackboxRecord_t g_bbRing[BLACKBOX_RING_SIZE];
+RTC_NOINIT_ATTR static uint32_t g_bbHead;
+RTC_NOINIT_ATTR static uint32_t g_bbMagic;
+
+static portMUX_TYPE g_bbMux = portMUX_INITIALIZER_UNLOCKED;
+
+// Captured at init, before this boot's events overwrite the ring
+static BlackboxRecord_t g_bbSnapshot[BLACKBOX_RING_SIZE];
+static uint32_t g_bbSnapshotCount = 0;
+static esp_reset_reason_t g_bbResetReason = ESP_RST_UNKNOWN;
+static bool g_bbReported = false;
+
+void Blackbox_Init(void)
+{
+    g_bbResetReason = esp_reset_reason();
+
+    if (g_bbMagic == BLACKBOX_MAGIC) {
+        // Ring survived the reset - snapshot it oldest-first for the
+        // boot report before new events overwrite the slots
+        for (uint32_t i = 0; i < BLACKBOX_RING_SIZE; i++) {
+            BlackboxRecord_t* rec =
+                &g_bbRing[(g_bbHead + i) % BLACKBOX_RING_SIZE];
+            if (rec->timestamp_ms != 0 || rec->event != 0 || rec->task != 0) {
+                g_bbSnapshot[g_bbSnapshotCount++] = *rec;
+            }
+        }
+    } else {
+        // Cold boot - nothing trustworthy in RTC memory
+        memset((void*)g_bbRing, 0, sizeof(g_bbRing));
+        g_bbHead = 0;
+        g_bbMagic = BLACKBOX_MAGIC;
+        g_bbSnapshotCount = 0;
+    }
+
+    Blackbox_Record(BB_TASK_NONE, BB_EV_BOOT, (uint16_t)g_bbResetReason);
+}
+
+void Blackbox_Record(uint8_t task_id, uint8_t event_id, uint16_t arg)
+{
+    taskENTER_CRITICAL(&g_bbMux);
+
+    BlackboxRecord_t* rec = &g_bbRing[g_bbHead % BLACKBOX_RING_SIZE];
+    rec->timestamp_ms = millis();
+    rec->task = task_id;
+    rec->event = event_id;
+    rec->arg = arg;
+    g_bbHead++;
+
+    taskEXIT_CRITICAL(&g_bbMux);
+}
+
+void Blackbox_PublishBootReport(void)
+{
+    if (g_bbReported) {
+        return;
+    }
+    g_bbReported = true;
+
+    // Compact array form keeps the payload under the PubSubClient
+    // packet limit: [timestamp_ms, task, event, arg] per entry, newest
+    // BLACKBOX_PUBLISH_COUNT entries only
+    char json[224];
+    size_t len = 0;
+
+    len += snprintf(json + len, sizeof(json) - len,
+                    "{\"reset\":%d,\"events\":[", (int)g_bbResetReason);
+
+    uint32_t first = 0;
+    if (g_bbSnapshotCount > BLACKBOX_PUBLISH_COUNT) {
+        first = g_bbSnapshotCount - BLACKBOX_PUBLISH_COUNT;
+    }
+    for (uint32_t i = first; i < g_bbSnapshotCount && len < sizeof(json) - 32; i++) {
+        BlackboxRecord_t* rec = &g_bbSnapshot[i];
+        len += snprintf(json + len, sizeof(json) - len,
+                        "%s[%lu,%u,%u,%u]",
+                        (i == first) ? "" : ",",
+                        (unsigned long)rec->timestamp_ms,
+                        rec->task, rec->event, rec->arg);
+    }
+
+    len += snprintf(json + len, sizeof(json) - len, "]}");
+
+    MQTT_Publish(MQTT_TOPIC_DIAG_BOOT, json);
+}
+
+#endif /* BLACKBOX_ENABLED */
@@ -0,0 +1,61 @@
+#ifndef BLACKBOX_H
+#define BLACKBOX_H
+
+#include <stdint.h>
+#include <stdbool.h>
+#include "../../app_cfg.h"
+
+#if BLACKBOX_ENABLED == STD_ON
+
+/*
+ * Crash black box.
+ *
+ * A small event ring in RTC noinit memory (same magic-guarded pattern
+ * as the store-and-forward ring) that survives watchdog resets, panics
+ * and brownouts. Tasks drop breadcrumbs - lifecycle transitions and
+ * execution-time spikes from the TaskDebugStats_t instrumentation -
+ * at microsecond cost; after the next boot the ring plus the reset
+ * reason is published once on the diagnostics topic, so a field reset
+ * leaves evidence instead of nothing.
+ */
+
+typedef enum {
+    BB_TASK_NONE = 0,
+    BB_TASK_TEMP_SENSOR,
+    BB_TASK_USER_INPUT,
+    BB_TASK_FAN_CONTROL,
+    BB_TASK_MQTT,
+    BB_TASK_WIFI,
+    BB_TASK_SENSORS      // Consolidated temp/hum/pot/gas task - appended
+                         // so pre-upgrade RTC rings still decode
+} Blackbox_Task_t;
+
+typedef enum {
+    BB_EV_BOOT = 0,      // arg = esp_reset_reason()
+    BB_EV_TASK_START,
+    BB_EV_WIFI_UP,
+    BB_EV_WIFI_DOWN,
+    BB_EV_SF_DIVERT,     // Broker outage - arg = buffered record count
+    BB_EV_EXEC_SPIKE     // New worst-case run time - arg = ms
+} Blackbox_Event_t;
+
+/**
+ * @brief Validate the RTC ring, capture the reset reason and record BOOT
+ * @note Call once from setup(), before any task starts
+ */
+void Blackbox_Init(void);
+
+/**
+ * @brief Drop one event into the ring (~microseconds, never blocks)
+ */
+void Blackbox_Record(uint8_t task_id, uint8_t event_id, uint16_t arg);
+
+/**
+ * @brief Publish reset reason + last events once per boot
+ * @note Call from the MQTT task while connected; later calls are no-ops
+ */
+void Blackbox_PublishBootReport(void);
+
+#endif /* BLACKBOX_ENABLED */
+
+#endif /* BLACKBOX_H */
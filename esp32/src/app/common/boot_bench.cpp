@@ -0,0 +1,88 @@
+#include <Arduino.h>
+#include <stdio.h>
+#include "esp_timer.h"
+#include "boot_bench.h"
+#include "../room/room_types.h"
+#include "../../hal/communication/hal_mqtt/hal_mqtt.h"
+#include "../../mqtt_topics.h"
+
+#if BOOT_BENCH_ENABLED == STD_ON
+
+// Staged at BootBench_Run, published once the broker is up - same
+// one-shot pattern as the blackbox boot report
+static char g_benchReport[224] = "{}";
+static bool g_benchReported = false;
+
+/**
+ * @brief Average cost of one iteration in nanoseconds
+ */
+static uint32_t BenchPerOpNs(int64_t startUs, int iterations)
+{
+    int64_t elapsed = esp_timer_get_time() - startUs;
+    return (uint32_t)((elapsed * 1000LL) / iterations);
+}
+
+void BootBench_Run(void)
+{
+    int64_t t0;
+
+    // 1. Dispatch-table lookup: the per-message cost of the inbound
+    //    path (binary search over the sorted topic table)
+    t0 = esp_timer_get_time();
+    for (int i = 0; i < BOOT_BENCH_ITERATIONS; i++) {
+        MQTT_BenchLookup(MQTT_TOPIC_CONTROL);
+    }
+    uint32_t dispatchNs = BenchPerOpNs(t0, BOOT_BENCH_ITERATIONS);
+
+    // 2. Payload format: the telemetry batch JSON as Task_Mqtt builds
+    //    it, with representative values
+    char payload[128];
+    t0 = esp_timer_get_time();
+    for (int i = 0; i < BOOT_BENCH_ITERATIONS; i++) {
+        snprintf(payload, sizeof(payload),
+                 "{\"temperature\":%.2f,\"target_temp\":%.1f,"
+                 "\"humidity\":%.1f,\"fan_speed\":%.0f}",
+                 23.45f + i, 22.0f, 48.5f, 2.0f);
+    }
+    uint32_t formatNs = BenchPerOpNs(t0, BOOT_BENCH_ITERATIONS);
+
+    // 3. Queue round-trip: the room command path's send + receive, on a
+    //    throwaway queue so the live one stays untouched
+    uint32_t queueNs = 0;
+    QueueHandle_t q = xQueueCreate(4, sizeof(Room_Command_t));
+    if (q != NULL) {
+        Room_Command_t cmd = { ROOM_CMD_SET_MODE, 1 };
+        t0 = esp_timer_get_time();
+        for (int i = 0; i < BOOT_BENCH_ITERATIONS; i++) {
+            xQueueSend(q, &cmd, 0);
+            xQueueReceive(q, &cmd, 0);
+        }
+        queueNs = BenchPerOpNs(t0, BOOT_BENCH_ITERATIONS);
+        vQueueDelete(q);
+    }
+
+    snprintf(g_benchReport, sizeof(g_benchReport),
+             "{\"version\":\"" FW_VERSION "\","
+             "\"build\":\"" __DATE__ " " __TIME__ "\","
+             "\"dispatch_ns\":%lu,\"format_ns\":%lu,\"queue_rt_ns\":%lu,"
+             "\"cpu_mhz\":%lu}",
+             (unsigned long)dispatchNs,
+             (unsigned long)formatNs,
+             (unsigned long)queueNs,
+             (unsigned long)getCpuFrequencyMhz());
+
+    // "BENCH:" prefix lets host-side tooling grep one line off the log
+    Serial.printf("BENCH:%s\n", g_benchReport);
+}
+
+void BootBench_PublishReport(void)
+{
+    if (g_benchReported) {
+        return;
+    }
+    g_benchReported = true;
+
+    MQTT_Publish(MQTT_TOPIC_DIAG_BENCH, g_benchReport);
+}
+
+#endif /* BOOT_BENCH_ENABLED */
@@ -0,0 +1,35 @@
+#ifndef BOOT_BENCH_H
+#define BOOT_BENCH_H
+
+#include "../../app_cfg.h"
+
+#if BOOT_BENCH_ENABLED == STD_ON
+
+/*
+ * Per-boot self-calibration benchmark.
+ *
+ * Before any task starts, a fixed set of representative hot-path
+ * operations is timed - a dispatch-table lookup, a telemetry payload
+ * format and a command-queue round-trip - and the per-op costs are
+ * published once with the firmware version on the diagnostics topic.
+ * The numbers come from the same binary the fleet runs, so a rollout
+ * that slows a hot path shows up as a per-version step in Grafana
+ * within minutes instead of as a slow dashboard drift.
+ */
+
+/**
+ * @brief Run the micro-benchmark and stage the report
+ * @note Call once from setup(), before InitThermostat() - the measured
+ *       paths must not be contended by live tasks
+ */
+void BootBench_Run(void);
+
+/**
+ * @brief Publish the staged report on MQTT_TOPIC_DIAG_BENCH
+ * @note Call from the MQTT task while connected; later calls are no-ops
+ */
+void BootBench_PublishReport(void);
+
+#endif /* BOOT_BENCH_ENABLED */
+
+#endif /* BOOT_BENCH_H */
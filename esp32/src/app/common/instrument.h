@@ -0,0 +1,141 @@
+/**
+ * @file instrument.h
+ * @brief Header-only scope timers and per-site counters
+ *
+ * Drop-in performance observability: INSTR_SCOPE times the enclosing
+ * scope via RAII, INSTR_COUNT bumps a per-site counter, INSTR_REPORT
+ * prints every site seen so far. Each use site owns one static stats
+ * record that registers itself on an intrusive list the first time the
+ * site runs - no central table to edit, no per-task boilerplate.
+ *
+ * The including tree's config defines INSTRUMENT_ENABLED; with it off
+ * (the default) every macro expands to a no-op expression, so disabled
+ * builds pay zero bytes and zero cycles.
+ *
+ * Identical copies live in esp32/src/app/common and
+ * esp32-cam/firmware/libraries/FaceRecognitionCommon/src - the two
+ * trees build separately and share no include path. Keep them in sync.
+ */
+
+#ifndef INSTRUMENT_H
+#define INSTRUMENT_H
+
+#ifndef INSTRUMENT_ENABLED
+#define INSTRUMENT_ENABLED 0
+#endif
+
+#if INSTRUMENT_ENABLED
+
+#include <Arduino.h>
+#include "esp_timer.h"
+
+namespace instr {
+
+/**
+ * @brief Accumulated statistics for one instrumented site
+ *
+ * Single writer - the task executing the scope. Readers (the report)
+ * tolerate torn counters; these are diagnostics, not ground truth.
+ */
+struct SiteStats {
+    const char* name;
+    uint32_t calls;
+    uint64_t totalUs;
+    uint32_t maxUs;
+    uint32_t lastUs;
+    SiteStats* next;  // Intrusive list, newest first
+};
+
+inline SiteStats*& siteList() {
+    static SiteStats* s_head = nullptr;
+    return s_head;
+}
+
+inline void registerSite(SiteStats* site) {
+    site->next = siteList();
+    siteList() = site;
+}
+
+/**
+ * @brief RAII scope timer - credits the elapsed time on destruction
+ */
+class ScopeTimer {
+public:
+    explicit ScopeTimer(SiteStats* stats)
+        : m_stats(stats), m_startUs(esp_timer_get_time()) {}
+
+    ~ScopeTimer() {
+        uint32_t us = (uint32_t)(esp_timer_get_time() - m_startUs);
+        m_stats->calls++;
+        m_stats->totalUs += us;
+        m_stats->lastUs = us;
+        if (us > m_stats->maxUs) {
+            m_stats->maxUs = us;
+        }
+    }
+
+private:
+    SiteStats* m_stats;
+    int64_t m_startUs;
+};
+
+/**
+ * @brief Print one line per site: calls, mean/max/last microseconds
+ */
+inline void report() {
+    for (SiteStats* s = siteList(); s; s = s->next) {
+        uint32_t meanUs = s->calls ? (uint32_t)(s->totalUs / s->calls) : 0;
+        Serial.printf("[Instr] %-24s calls=%lu mean=%luus max=%luus last=%luus\n",
+                      s->name, (unsigned long)s->calls, (unsigned long)meanUs,
+                      (unsigned long)s->maxUs, (unsigned long)s->lastUs);
+    }
+}
+
+}  // namespace instr
+
+// Two-level paste so __LINE__ expands before concatenation
+#define INSTR_CONCAT2(a, b) a##b
+#define INSTR_CONCAT(a, b) INSTR_CONCAT2(a, b)
+
+/**
+ * @brief Time the rest of the enclosing scope under the given name
+ *
+ * The name must be a string literal; one stats record per use site.
+ */
+#define INSTR_SCOPE(name_literal)                                            \
+    static instr::SiteStats INSTR_CONCAT(s_instrSite, __LINE__) =            \
+        {name_literal, 0, 0, 0, 0, nullptr};                                 \
+    static bool INSTR_CONCAT(s_instrReg, __LINE__) =                         \
+        (instr::registerSite(&INSTR_CONCAT(s_instrSite, __LINE__)), true);   \
+    (void)INSTR_CONCAT(s_instrReg, __LINE__);                                \
+    instr::ScopeTimer INSTR_CONCAT(s_instrTimer, __LINE__)(                  \
+        &INSTR_CONCAT(s_instrSite, __LINE__))
+
+/**
+ * @brief Bump a per-site event counter (shows up in the report)
+ */
+#define INSTR_COUNT(name_literal)                                            \
+    do {                                                                     \
+        static instr::SiteStats INSTR_CONCAT(s_instrSite, __LINE__) =        \
+            {name_literal, 0, 0, 0, 0, nullptr};                             \
+        static bool INSTR_CONCAT(s_instrReg, __LINE__) =                     \
+            (instr::registerSite(&INSTR_CONCAT(s_instrSite, __LINE__)),      \
+             true);                                                          \
+        (void)INSTR_CONCAT(s_instrReg, __LINE__);                            \
+        INSTR_CONCAT(s_instrSite, __LINE__).calls++;                         \
+    } while (0)
+
+/**
+ * @brief Print every registered site over Serial
+ */
+#define INSTR_REPORT() instr::report()
+
+#else  // INSTRUMENT_ENABLED
+
+#define INSTR_SCOPE(name_literal) ((void)0)
+#define INSTR_COUNT(name_literal) ((void)0)
+#define INSTR_REPORT() ((void)0)
+
+#endif  // INSTRUMENT_ENABLED
+
+#endif  // INSTRUMENT_H
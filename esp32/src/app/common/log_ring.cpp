@@ -0,0 +1,157 @@
+#include <Arduino.h>
+#include <string.h>
+#include <stdio.h>
+#include "log_ring.h"
+
+#if LOG_RING_ENABLED == STD_ON
+
+// Format table, indexed by LogFmtId_t. Keep in sync with the enum.
+// %s (when present) is always the first placeholder - the drain task
+// relies on that ordering.
+static const char* const g_logFormats[LOG_FMT_COUNT] = {
+    "[MQTT RX] %s",                         // LOG_FMT_MQTT_RX
+    "[MQTT] Unknown topic: %s",             // LOG_FMT_MQTT_UNKNOWN
+    "Published to %s",                      // LOG_FMT_MQTT_PUB_OK
+    "MQTT publish failed",                  // LOG_FMT_MQTT_PUB_FAIL
+    "MQTT publish failed: Not connected",   // LOG_FMT_MQTT_PUB_NOCONN
+    "MQTT binary publish failed",           // LOG_FMT_MQTT_BIN_FAIL
+    "Published: %s",                        // LOG_FMT_ROOM_PUB
+};
+
+typedef struct {
+    uint32_t timestamp_ms;
+    int32_t  arg0;
+    int32_t  arg1;
+    uint8_t  fmt_id;
+    bool     has_str;
+    char     str[LOG_RING_STR_MAX];
+} LogRecord_t;
+
+// ==================== RING STATE ====================
+// Producers can be any task or the network callback; a short spinlock
+// guards the index update and record copy. Full ring drops the newest
+// record and counts it - the drain task reports drops when it catches up.
+static LogRecord_t g_logRing[LOG_RING_SIZE];
+static volatile uint32_t g_logHead = 0;   // Next write slot
+static volatile uint32_t g_logTail = 0;   // Next read slot
+static volatile uint32_t g_logDropped = 0;
+
+static portMUX_TYPE g_logMux = portMUX_INITIALIZER_UNLOCKED;
+static TaskHandle_t g_logTaskHandle = NULL;
+
+static void LogRing_Push(LogFmtId_t id, const char* str,
+                         int32_t arg0, int32_t arg1)
+{
+    if (id >= LOG_FMT_COUNT) {
+        return;
+    }
+
+    taskENTER_CRITICAL(&g_logMux);
+
+    uint32_t next = (g_logHead + 1) % LOG_RING_SIZE;
+    if (next == g_logTail) {
+        // Full - dropping beats blocking the hot path
+        g_logDropped++;
+        taskEXIT_CRITICAL(&g_logMux);
+        return;
+    }
+
+    LogRecord_t* rec = &g_logRing[g_logHead];
+    rec->timestamp_ms = millis();
+    rec->fmt_id = (uint8_t)id;
+    rec->arg0 = arg0;
+    rec->arg1 = arg1;
+    if (str != NULL) {
+        rec->has_str = true;
+        strlcpy(rec->str, str, sizeof(rec->str));
+    } else {
+        rec->has_str = false;
+        rec->str[0] = '\0';
+    }
+    g_logHead = next;
+
+    taskEXIT_CRITICAL(&g_logMux);
+
+    if (g_logTaskHandle != NULL) {
+        xTaskNotifyGive(g_logTaskHandle);
+    }
+}
+
+void LogRing_Log(LogFmtId_t id, int32_t arg0, int32_t arg1)
+{
+    LogRing_Push(id, NULL, arg0, arg1);
+}
+
+void LogRing_LogStr(LogFmtId_t id, const char* str, int32_t arg0)
+{
+    LogRing_Push(id, str, arg0, 0);
+}
+
+/**
+ * @brief Low-priority drain task - formats queued records onto the UART
+ */
+static void Task_LogDrain(void* pvParameters)
+{
+    (void)pvParameters;
+
+    LogRecord_t rec;
+    char line[LOG_RING_STR_MAX + 64];
+
+    for (;;) {
+        // Wake on a new record, or periodically to report drops
+        ulTaskNotifyTake(pdTRUE, pdMS_TO_TICKS(LOG_RING_DRAIN_TIMEOUT_MS));
+
+        for (;;) {
+            taskENTER_CRITICAL(&g_logMux);
+            if (g_logTail == g_logHead) {
+                taskEXIT_CRITICAL(&g_logMux);
+                break;
+            }
+            rec = g_logRing[g_logTail];
+            g_logTail = (g_logTail + 1) % LOG_RING_SIZE;
+            taskEXIT_CRITICAL(&g_logMux);
+
+            const char* fmt = g_logFormats[rec.fmt_id];
+            if (rec.has_str) {
+                snprintf(line, sizeof(line), fmt,
+                         rec.str, (long)rec.arg0, (long)rec.arg1);
+            } else {
+                snprintf(line, sizeof(line), fmt,
+                         (long)rec.arg0, (long)rec.arg1);
+            }
+            Serial.printf("[%10lu] %s\n", (unsigned long)rec.timestamp_ms, line);
+        }
+
+        uint32_t dropped = g_logDropped;
+        if (dropped > 0) {
+            g_logDropped = 0;
+            Serial.printf("[LOG] %lu records dropped\n", (unsigned long)dropped);
+        }
+    }
+}
+
+void LogRing_Init(void)
+{
+    if (g_logTaskHandle != NULL) {
+        return;  // Already running
+    }
+
+    g_logHead = 0;
+    g_logTail = 0;
+    g_logDropped = 0;
+
+    BaseType_t ok = xTaskCreate(
+        Task_LogDrain,
+        "LogDrain",
+        LOG_RING_TASK_STACK_SIZE,
+        NULL,
+        LOG_RING_TASK_PRIORITY,
+        &g_logTaskHandle
+    );
+    if (ok != pdPASS) {
+        g_logTaskHandle = NULL;
+        Serial.println("[ERROR] Failed to create LogDrain task!");
+    }
+}
+
+#endif /* LOG_RING_ENABLED */
@@ -0,0 +1,54 @@
+#ifndef LOG_RING_H
+#define LOG_RING_H
+
+#include <stdint.h>
+#include <stdbool.h>
+#include "../../app_cfg.h"
+
+#if LOG_RING_ENABLED == STD_ON
+
+/*
+ * Deferred logging ring.
+ *
+ * Hot paths (MQTT RX callback, publish paths) must not block on the
+ * UART - at 9600 baud a single log line costs tens of milliseconds.
+ * Instead they queue a compact binary record (format id + args) here;
+ * a low-priority drain task formats the record and prints it. Hot-path
+ * cost is a short critical section plus a bounded memcpy.
+ *
+ * Format strings live in the table in log_ring.cpp, indexed by id.
+ * Convention: the %s placeholder, when a format has one, comes FIRST,
+ * followed by up to two %ld arguments.
+ */
+
+typedef enum {
+    LOG_FMT_MQTT_RX = 0,     // "[MQTT RX] %s"            (topic=payload)
+    LOG_FMT_MQTT_UNKNOWN,    // "[MQTT] Unknown topic: %s"
+    LOG_FMT_MQTT_PUB_OK,     // "Published to %s"         (topic=payload)
+    LOG_FMT_MQTT_PUB_FAIL,   // "MQTT publish failed"
+    LOG_FMT_MQTT_PUB_NOCONN, // "MQTT publish failed: Not connected"
+    LOG_FMT_MQTT_BIN_FAIL,   // "MQTT binary publish failed"
+    LOG_FMT_ROOM_PUB,        // "Published: %s"           (topic=payload)
+    LOG_FMT_COUNT
+} LogFmtId_t;
+
+/**
+ * @brief Create the drain task and reset the ring
+ * @note Call once from setup(), after Serial.begin()
+ */
+void LogRing_Init(void);
+
+/**
+ * @brief Queue a record with numeric arguments only
+ */
+void LogRing_Log(LogFmtId_t id, int32_t arg0, int32_t arg1);
+
+/**
+ * @brief Queue a record with a string argument (truncated copy) plus
+ *        one numeric argument
+ */
+void LogRing_LogStr(LogFmtId_t id, const char* str, int32_t arg0);
+
+#endif /* LOG_RING_ENABLED */
+
+#endif /* LOG_RING_H */
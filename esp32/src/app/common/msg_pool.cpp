@@ -0,0 +1,69 @@
+#include <string.h>
+#include "msg_pool.h"
+
+void MsgPool_Init(MsgPool_t* pool, void* storage, bool* in_use,
+                  size_t slot_size, size_t slot_count)
+{
+    pool->storage = (uint8_t*)storage;
+    pool->in_use = in_use;
+    pool->slot_size = slot_size;
+    pool->slot_count = slot_count;
+    memset(in_use, 0, slot_count * sizeof(bool));
+    memset(&pool->stats, 0, sizeof(pool->stats));
+
+    portMUX_TYPE initial = portMUX_INITIALIZER_UNLOCKED;
+    pool->lock = initial;
+}
+
+void* MsgPool_Alloc(MsgPool_t* pool)
+{
+    void* block = NULL;
+
+    taskENTER_CRITICAL(&pool->lock);
+
+    for (size_t i = 0; i < pool->slot_count; i++) {
+        if (!pool->in_use[i]) {
+            pool->in_use[i] = true;
+            pool->stats.used++;
+            if (pool->stats.used > pool->stats.high_water) {
+                pool->stats.high_water = pool->stats.used;
+            }
+            block = pool->storage + i * pool->slot_size;
+            break;
+        }
+    }
+
+    if (block == NULL) {
+        pool->stats.alloc_fail++;
+    }
+
+    taskEXIT_CRITICAL(&pool->lock);
+    return block;
+}
+
+void MsgPool_Free(MsgPool_t* pool, void* block)
+{
+    if (block == NULL) {
+        return;
+    }
+
+    size_t offset = (size_t)((uint8_t*)block - pool->storage);
+    size_t index = offset / pool->slot_size;
+    if (index >= pool->slot_count || offset % pool->slot_size != 0) {
+        return;  // Not a pool pointer - ignore rather than corrupt state
+    }
+
+    taskENTER_CRITICAL(&pool->lock);
+    if (pool->in_use[index]) {
+        pool->in_use[index] = false;
+        pool->stats.used--;
+    }
+    taskEXIT_CRITICAL(&pool->lock);
+}
+
+void MsgPool_GetStats(MsgPool_t* pool, MsgPoolStats_t* out)
+{
+    taskENTER_CRITICAL(&pool->lock);
+    *out = pool->stats;
+    taskEXIT_CRITICAL(&pool->lock);
+}
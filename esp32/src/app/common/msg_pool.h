@@ -0,0 +1,59 @@
+#ifndef MSG_POOL_H
+#define MSG_POOL_H
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <stddef.h>
+#include <Arduino.h>
+
+/*
+ * Fixed-block message pool.
+ *
+ * Queues carry pointers to pool slots instead of copying whole message
+ * structs by value. Allocation is a bitmap scan under a short spinlock,
+ * so in-flight message memory is bounded and observable - used count,
+ * high-water mark and refused allocations - instead of hiding inside
+ * FreeRTOS queue copies.
+ *
+ * The caller owns the storage (static arrays); the pool never touches
+ * the heap.
+ */
+
+typedef struct {
+    uint16_t used;        // Slots currently allocated
+    uint16_t high_water;  // Most slots ever allocated at once
+    uint32_t alloc_fail;  // Allocations refused because the pool was full
+} MsgPoolStats_t;
+
+typedef struct {
+    uint8_t* storage;
+    bool*    in_use;
+    size_t   slot_size;
+    size_t   slot_count;
+    MsgPoolStats_t stats;
+    portMUX_TYPE lock;
+} MsgPool_t;
+
+/**
+ * @brief Bind a pool to caller-provided storage and reset its state
+ */
+void MsgPool_Init(MsgPool_t* pool, void* storage, bool* in_use,
+                  size_t slot_size, size_t slot_count);
+
+/**
+ * @brief Allocate one slot
+ * @return Slot pointer, or NULL when the pool is exhausted (counted)
+ */
+void* MsgPool_Alloc(MsgPool_t* pool);
+
+/**
+ * @brief Return a slot to the pool
+ */
+void MsgPool_Free(MsgPool_t* pool, void* block);
+
+/**
+ * @brief Snapshot the usage counters
+ */
+void MsgPool_GetStats(MsgPool_t* pool, MsgPoolStats_t* out);
+
+#endif /* MSG_POOL_H */
@@ -0,0 +1,48 @@
+#include <Arduino.h>
+#include "power_mgr.h"
+
+#if POWER_MGR_ENABLED == STD_ON
+
+#include "esp_pm.h"
+#include "esp_wifi.h"
+
+void PowerMgr_Init(void)
+{
+#if defined(CONFIG_PM_ENABLE) && CONFIG_PM_ENABLE
+    esp_pm_config_esp32_t cfg = {};
+    cfg.max_freq_mhz = POWER_CPU_MAX_MHZ;
+    cfg.min_freq_mhz = POWER_CPU_MIN_MHZ;
+#if POWER_LIGHT_SLEEP == STD_ON
+    cfg.light_sleep_enable = true;
+#else
+    cfg.light_sleep_enable = false;
+#endif
+
+    esp_err_t err = esp_pm_configure(&cfg);
+    if (err == ESP_ERR_NOT_SUPPORTED && cfg.light_sleep_enable) {
+        // Core libraries built without tickless idle - keep the
+        // frequency scaling, lose the automatic light sleep
+        cfg.light_sleep_enable = false;
+        err = esp_pm_configure(&cfg);
+        Serial.println("[POWER] No tickless idle in this core - DFS only");
+    }
+
+    if (err == ESP_OK) {
+        Serial.printf("[POWER] DFS %d-%d MHz, light sleep %s\n",
+                      cfg.min_freq_mhz, cfg.max_freq_mhz,
+                      cfg.light_sleep_enable ? "on" : "off");
+    } else {
+        Serial.printf("[POWER] esp_pm_configure failed: %d\n", (int)err);
+    }
+#else
+    // Core built without CONFIG_PM_ENABLE - modem-sleep is all we get
+    Serial.println("[POWER] Core built without PM support - modem-sleep only");
+#endif /* CONFIG_PM_ENABLE */
+
+    // Modem-sleep: the radio powers down between DTIM beacons while the
+    // association stays up, so MQTT keepalive and subscriptions survive.
+    // This is the dominant idle drain on the battery-backed door nodes.
+    esp_wifi_set_ps(WIFI_PS_MIN_MODEM);
+}
+
+#endif /* POWER_MGR_ENABLED */
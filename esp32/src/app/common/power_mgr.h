@@ -0,0 +1,33 @@
+#ifndef POWER_MGR_H
+#define POWER_MGR_H
+
+#include "../../app_cfg.h"
+
+/**
+ * @brief Power-performance mode for battery-backed nodes
+ *
+ * Enables dynamic frequency scaling between POWER_CPU_MAX_MHZ and
+ * POWER_CPU_MIN_MHZ and, when the core libraries were built with
+ * tickless idle, automatic light sleep whenever every task is blocked.
+ * The WiFi radio drops to modem-sleep (wakes for DTIM beacons only).
+ *
+ * Event-driven wakeups (button/RFID interrupts, task notifications)
+ * bring the CPU back in microseconds, so control latency is unchanged;
+ * only busy-polling keeps the chip out of sleep, which is why the
+ * service loops wait on notifications with a timeout instead of short
+ * fixed delays.
+ */
+
+#if POWER_MGR_ENABLED == STD_ON
+
+/**
+ * @brief Configure DFS/light-sleep and WiFi modem-sleep
+ * @note Call once from setup() after WIFI_Init_. Degrades gracefully:
+ *       cores built without CONFIG_PM_ENABLE keep modem-sleep only,
+ *       cores without tickless idle keep DFS without light sleep.
+ */
+void PowerMgr_Init(void);
+
+#endif /* POWER_MGR_ENABLED */
+
+#endif /* POWER_MGR_H */
@@ -0,0 +1,31 @@
+#include <math.h>
+#include "report_policy.h"
+
+bool Report_ShouldPublish(const ReportPolicy_t* policy, ReportState_t* state,
+                          float value, uint32_t now_ms)
+{
+    // First sample after boot always goes out
+    if (!state->has_reported) {
+        state->last_value = value;
+        state->last_report_ms = now_ms;
+        state->has_reported = true;
+        return true;
+    }
+
+    uint32_t silence = now_ms - state->last_report_ms;
+
+    // Rate limit - even a big jump waits out the minimum interval
+    if (silence < policy->min_interval_ms) {
+        return false;
+    }
+
+    // Deadband exceeded, or heartbeat due
+    if (fabsf(value - state->last_value) >= policy->deadband ||
+        silence >= policy->max_silence_ms) {
+        state->last_value = value;
+        state->last_report_ms = now_ms;
+        return true;
+    }
+
+    return false;
+}
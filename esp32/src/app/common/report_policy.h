@@ -0,0 +1,41 @@
+#ifndef REPORT_POLICY_H
+#define REPORT_POLICY_H
+
+#include <stdint.h>
+#include <stdbool.h>
+
+/**
+ * @brief Report-by-exception policy for one telemetry metric
+ *
+ * A metric is published when it moved by at least the deadband since
+ * the last report (rate-limited by min_interval_ms), or when nothing
+ * has been reported for max_silence_ms (heartbeat, so the backend can
+ * tell "unchanged" from "dead").
+ */
+typedef struct {
+    float    deadband;         // Minimum change worth reporting
+    uint32_t min_interval_ms;  // Rate limit between reports
+    uint32_t max_silence_ms;   // Heartbeat when nothing changed
+} ReportPolicy_t;
+
+/**
+ * @brief Per-metric runtime state (zero-initialize; first sample always reports)
+ */
+typedef struct {
+    float    last_value;
+    uint32_t last_report_ms;
+    bool     has_reported;
+} ReportState_t;
+
+/**
+ * @brief Decide whether a new sample should be published
+ * @param policy Metric policy (deadband / rate limit / heartbeat)
+ * @param state Metric state - updated when the answer is true
+ * @param value Current sample
+ * @param now_ms Current millis()
+ * @return true if the caller should publish this sample
+ */
+bool Report_ShouldPublish(const ReportPolicy_t* policy, ReportState_t* state,
+                          float value, uint32_t now_ms);
+
+#endif // REPORT_POLICY_H
@@ -0,0 +1,118 @@
+#include <Arduino.h>
+#include "esp_timer.h"
+#include "scheduler.h"
+#include "../../app_cfg.h"
+#include "instrument.h"
+
+#if SCHEDULER_ENABLED == STD_ON
+
+typedef struct {
+    const char* name;
+    SchedulerJobFn_t fn;
+    uint32_t period_ms;
+    uint32_t next_run_ms;
+    uint32_t run_count;
+    uint32_t max_exec_us;   // Worst case - a job that grows here should
+                            // graduate back to its own task
+} SchedulerJob_t;
+
+static SchedulerJob_t g_jobs[SCHEDULER_MAX_JOBS];
+static uint8_t g_jobCount = 0;
+
+// Static task storage, same pattern as the thermostat/room tasks
+static StaticTask_t g_schedulerTCB;
+static StackType_t  g_schedulerStack[SCHEDULER_TASK_STACK_SIZE];
+static TaskHandle_t g_schedulerTaskHandle = NULL;
+
+bool Scheduler_AddJob(const char* name, uint32_t period_ms, SchedulerJobFn_t fn)
+{
+    if (g_jobCount >= SCHEDULER_MAX_JOBS || fn == NULL || period_ms == 0) {
+        Serial.printf("[ERROR] Scheduler: cannot register job %s\n",
+                      (name != NULL) ? name : "?");
+        return false;
+    }
+
+    g_jobs[g_jobCount].name        = name;
+    g_jobs[g_jobCount].fn          = fn;
+    g_jobs[g_jobCount].period_ms   = period_ms;
+    g_jobs[g_jobCount].next_run_ms = millis() + period_ms;
+    g_jobs[g_jobCount].run_count   = 0;
+    g_jobs[g_jobCount].max_exec_us = 0;
+    g_jobCount++;
+    return true;
+}
+
+/**
+ * @brief Task: run due jobs, then sleep until the earliest deadline
+ *
+ * Signed tick arithmetic keeps the due checks correct across millis()
+ * wraparound. A job's next deadline advances from "now", not from the
+ * previous deadline, so a slow cycle degrades to a longer period
+ * instead of a catch-up burst.
+ */
+static void Scheduler_Task(void* pvParameters)
+{
+    (void)pvParameters;
+
+    Serial.printf("[SCHED] Executor started (%u jobs)\n", (unsigned)g_jobCount);
+
+    for (;;) {
+        uint32_t now = millis();
+        uint32_t next_due = now + SCHEDULER_IDLE_MS;
+
+        for (uint8_t i = 0; i < g_jobCount; i++) {
+            SchedulerJob_t* job = &g_jobs[i];
+
+            if ((int32_t)(now - job->next_run_ms) >= 0) {
+                int64_t startUs = esp_timer_get_time();
+                job->fn();
+                uint32_t execUs = (uint32_t)(esp_timer_get_time() - startUs);
+                if (execUs > job->max_exec_us) {
+                    job->max_exec_us = execUs;
+                }
+                job->run_count++;
+
+                now = millis();  // Job bodies take time
+                job->next_run_ms = now + job->period_ms;
+            }
+
+            if ((int32_t)(job->next_run_ms - next_due) < 0) {
+                next_due = job->next_run_ms;
+            }
+        }
+
+#if INSTRUMENT_ENABLED
+        // The executor owns the polls, so it also owns the site report
+        static uint32_t s_lastReportMs = 0;
+        if (millis() - s_lastReportMs >= INSTR_REPORT_MS) {
+            s_lastReportMs = millis();
+            INSTR_REPORT();
+        }
+#endif
+
+        int32_t sleep_ms = (int32_t)(next_due - millis());
+        if (sleep_ms < 1) sleep_ms = 1;
+        vTaskDelay(pdMS_TO_TICKS(sleep_ms));
+    }
+}
+
+void Scheduler_Start(void)
+{
+    if (g_schedulerTaskHandle != NULL) return;  // Already running
+
+    g_schedulerTaskHandle = xTaskCreateStaticPinnedToCore(
+        Scheduler_Task,
+        "Scheduler",
+        SCHEDULER_TASK_STACK_SIZE,
+        NULL,
+        SCHEDULER_TASK_PRIORITY,
+        g_schedulerStack,
+        &g_schedulerTCB,
+        SCHEDULER_TASK_CORE
+    );
+    if (g_schedulerTaskHandle == NULL) {
+        Serial.println("[ERROR] Failed to create Scheduler task!");
+    }
+}
+
+#endif /* SCHEDULER_ENABLED */
@@ -0,0 +1,36 @@
+#ifndef SCHEDULER_H
+#define SCHEDULER_H
+
+#include <stdint.h>
+#include <stdbool.h>
+
+/**
+ * @brief Cooperative scheduler for lightweight periodic jobs
+ *
+ * One timer-driven executor task runs every registered job from a
+ * single stack, replacing the per-poll tasks (pot read, gas read, LDR
+ * update) that each held 2-4 KB of stack to sleep between tiny polls.
+ * Jobs must be non-blocking: anything that waits on the network, a
+ * queue or a slow peripheral keeps its own task. The executor sleeps
+ * until the next job is due, so consolidation does not turn into a
+ * busy poll.
+ */
+
+typedef void (*SchedulerJobFn_t)(void);
+
+/**
+ * @brief Register a periodic job - call before Scheduler_Start
+ * @param name Short job name (diagnostics)
+ * @param period_ms Period between runs
+ * @param fn Job body - must return quickly and never block
+ * @return false if the job table is full
+ */
+bool Scheduler_AddJob(const char* name, uint32_t period_ms, SchedulerJobFn_t fn);
+
+/**
+ * @brief Create the executor task - call once from setup() after all
+ *        modules registered their jobs
+ */
+void Scheduler_Start(void);
+
+#endif // SCHEDULER_H
@@ -0,0 +1,89 @@
+#include <Arduino.h>
+#include <math.h>
+#include "sensor_history.h"
+#include "../../app_cfg.h"
+
+#if SENSOR_HISTORY_ENABLED == STD_ON
+
+typedef struct {
+    float    samples[SENSOR_HISTORY_SIZE];
+    uint16_t head;      // Next write slot
+    uint16_t count;     // Valid samples (saturates at SENSOR_HISTORY_SIZE)
+    // Incremental accumulators: the evicted sample is subtracted on
+    // insert, so mean/variance never need a window rescan. double keeps
+    // the add/subtract cycle from drifting over long uptimes.
+    double   sum;
+    double   sumsq;
+} HistoryRing_t;
+
+static HistoryRing_t g_rings[HISTORY_METRIC_COUNT];
+static portMUX_TYPE g_historyLock = portMUX_INITIALIZER_UNLOCKED;
+
+static const char* const g_metricNames[HISTORY_METRIC_COUNT] = {
+    "temp", "hum", "gas", "ldr"
+};
+
+void History_Add(HistoryMetric_t metric, float value)
+{
+    if (metric >= HISTORY_METRIC_COUNT) return;
+
+    HistoryRing_t* ring = &g_rings[metric];
+
+    taskENTER_CRITICAL(&g_historyLock);
+    if (ring->count == SENSOR_HISTORY_SIZE) {
+        // Window full - evict the sample this write overwrites
+        float old = ring->samples[ring->head];
+        ring->sum   -= old;
+        ring->sumsq -= (double)old * old;
+    } else {
+        ring->count++;
+    }
+    ring->samples[ring->head] = value;
+    ring->sum   += value;
+    ring->sumsq += (double)value * value;
+    ring->head = (ring->head + 1) % SENSOR_HISTORY_SIZE;
+    taskEXIT_CRITICAL(&g_historyLock);
+}
+
+bool History_GetStats(HistoryMetric_t metric, HistoryStats_t* out)
+{
+    if (metric >= HISTORY_METRIC_COUNT || out == NULL) return false;
+
+    HistoryRing_t* ring = &g_rings[metric];
+
+    taskENTER_CRITICAL(&g_historyLock);
+    uint16_t count = ring->count;
+    if (count == 0) {
+        taskEXIT_CRITICAL(&g_historyLock);
+        return false;
+    }
+
+    float min = ring->samples[0];
+    float max = ring->samples[0];
+    for (uint16_t i = 1; i < count; i++) {
+        if (ring->samples[i] < min) min = ring->samples[i];
+        if (ring->samples[i] > max) max = ring->samples[i];
+    }
+    double sum   = ring->sum;
+    double sumsq = ring->sumsq;
+    taskEXIT_CRITICAL(&g_historyLock);
+
+    double mean = sum / count;
+    double var  = sumsq / count - mean * mean;
+    if (var < 0.0) var = 0.0;  // Guard float rounding near zero variance
+
+    out->min    = min;
+    out->max    = max;
+    out->mean   = (float)mean;
+    out->stddev = (float)sqrt(var);
+    out->count  = count;
+    return true;
+}
+
+const char* History_MetricName(HistoryMetric_t metric)
+{
+    if (metric >= HISTORY_METRIC_COUNT) return "?";
+    return g_metricNames[metric];
+}
+
+#endif /* SENSOR_HISTORY_ENABLED */
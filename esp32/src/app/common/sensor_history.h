@@ -0,0 +1,56 @@
+#ifndef SENSOR_HISTORY_H
+#define SENSOR_HISTORY_H
+
+#include <stdint.h>
+#include <stdbool.h>
+
+/**
+ * @brief On-device history rings with incremental aggregates
+ *
+ * One fixed-size sample window per metric, written by the sensor tasks
+ * on every read (not just the ones report-by-exception lets through).
+ * Sum and sum-of-squares are maintained incrementally on insert, so
+ * mean/stddev are O(1) at query time; min/max are scanned over the
+ * window when asked for, which only happens at the aggregate publish
+ * rate. Together with the per-metric deadbands this keeps dashboard
+ * statistics at full resolution while raw publishes stay exception-only.
+ */
+
+typedef enum {
+    HISTORY_TEMP,
+    HISTORY_HUMIDITY,
+    HISTORY_GAS,
+    HISTORY_LDR,
+
+    HISTORY_METRIC_COUNT  // Keep last
+} HistoryMetric_t;
+
+/**
+ * @brief Aggregate snapshot of one metric's sample window
+ */
+typedef struct {
+    float    min;
+    float    max;
+    float    mean;
+    float    stddev;
+    uint16_t count;   // Samples currently in the window
+} HistoryStats_t;
+
+/**
+ * @brief Record a sample into a metric's ring
+ * @note Safe to call from any task - insert is a short critical section
+ */
+void History_Add(HistoryMetric_t metric, float value);
+
+/**
+ * @brief Compute aggregates over a metric's current window
+ * @return false if the window is still empty
+ */
+bool History_GetStats(HistoryMetric_t metric, HistoryStats_t* out);
+
+/**
+ * @brief Short metric name for payloads ("temp", "hum", "gas", "ldr")
+ */
+const char* History_MetricName(HistoryMetric_t metric);
+
+#endif // SENSOR_HISTORY_H
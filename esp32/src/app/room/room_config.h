@@ -21,6 +21,7 @@
 #define ROOM_PWM_CHANNEL_LED2   1
 #define ROOM_PWM_FREQUENCY      5000
 #define ROOM_PWM_RESOLUTION     8
+#define ROOM_PWM_FADE_MS        400   // Hardware fade time per brightness change
 
 // Auto-dimming thresholds
 #define ROOM_LIGHT_THRESHOLD_LOW    30  // Below this: full brightness
@@ -33,10 +34,19 @@
 #define ROOM_MQTT_PUBLISH_INTERVAL  2000  // Publish LDR every 2 seconds
 #define ROOM_LED_UPDATE_INTERVAL    100   // Update LED brightness every 100ms
 
+// Event-sourced status publishing: status changes set dirty bits in a
+// packed word and one consolidated retained JSON document goes out per
+// settling window (ROOM_TOPIC_STATUS_DOC), instead of a per-topic
+// message per change. STD_OFF restores the per-topic publishers.
+#define ROOM_STATUS_DOC_ENABLED     STD_ON
+#define ROOM_STATUS_SETTLE_MS       250   // Coalescing window after first change
+
 // Debug Configuration
 #define ROOM_DEBUG_ENABLED          STD_ON
 
-#if ROOM_DEBUG_ENABLED == STD_ON
+// Also capped by LOG_LEVEL_GLOBAL (app_cfg.h) so release builds strip
+// these sites together with the leveled LOG_* ones
+#if ROOM_DEBUG_ENABLED == STD_ON && LOG_LEVEL_GLOBAL >= LOG_LEVEL_DEBUG
 #define ROOM_DEBUG_PRINT(x)     Serial.print(x)
 #define ROOM_DEBUG_PRINTLN(x)   Serial.println(x)
 #else
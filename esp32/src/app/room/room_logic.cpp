@@ -8,10 +8,57 @@
 
 // Internal state
 static Room_Status_t room_status;
-static unsigned long button1_last_press = 0;
-static unsigned long button2_last_press = 0;
 static unsigned long last_brightness_update = 0;
 
+// Seqlock sequence for room_status: odd while a write is in progress,
+// bumped to even when it completes. Readers retry instead of blocking,
+// so only the writer path pays any synchronization cost. Writers are
+// still serialized by room_status_mutex in room_rtos.cpp; the depth
+// counter lets mutators nest (SetMode calls UpdateAutoMode).
+static volatile uint32_t room_status_seq = 0;
+static uint8_t room_status_write_depth = 0;
+
+static void Room_Status_WriteBegin(void)
+{
+    if (room_status_write_depth++ == 0) {
+        room_status_seq++;
+    }
+}
+
+static void Room_Status_WriteEnd(void)
+{
+    if (--room_status_write_depth == 0) {
+        room_status_seq++;
+    }
+}
+
+// Gamma-corrected brightness table, generated offline. Index is the
+// LDR light percentage (0-100), value is the PWM duty: the threshold
+// clamps and the MAX->MIN ramp from the old Room_Logic_CalculateBrightness
+// are baked in, with a gamma-2 curve applied to the ramp so equal LDR
+// steps produce perceptually equal brightness steps. The control loop
+// converges in fewer corrective updates and the per-iteration mapping
+// is a single indexed load. (A constexpr builder needs C++14; the
+// pinned core 2.x toolchain compiles -std=gnu++11, so the table is a
+// literal.) Regenerate if the room_config.h constants change:
+//   pct < ROOM_LIGHT_THRESHOLD_LOW              -> ROOM_BRIGHTNESS_MAX
+//   pct > ROOM_LIGHT_THRESHOLD_HIGH             -> ROOM_BRIGHTNESS_MIN
+//   else, b = HIGH - pct, span = HIGH - LOW:
+//     duty = MIN + ((MAX - MIN) * b * b) / (span * span)
+static const uint8_t room_gamma_table[101] = {
+    255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+    255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+    255, 255, 255, 255, 255, 255, 255, 255, 255, 255,
+    255, 244, 235, 225, 216, 207, 198, 189, 181, 173,
+    165, 158, 150, 143, 137, 130, 124, 118, 112, 107,
+    102,  97,  92,  87,  83,  79,  75,  72,  69,  66,
+     63,  61,  59,  57,  55,  54,  53,  52,  51,  51,
+     51,  51,  51,  51,  51,  51,  51,  51,  51,  51,
+     51,  51,  51,  51,  51,  51,  51,  51,  51,  51,
+     51,  51,  51,  51,  51,  51,  51,  51,  51,  51,
+     51
+};
+
 // Internal function prototypes
 static void Room_Logic_SetBrightness(Room_LED_t led, uint8_t brightness);
 static uint8_t Room_Logic_CalculateBrightness(uint16_t light_percentage);
@@ -42,6 +89,7 @@ void Room_Logic_Init(void)
     // Setup PWM using HAL wrapper
     PWM_Init(ROOM_PWM_CHANNEL_LED1, ROOM_LED1_PIN, ROOM_PWM_FREQUENCY, ROOM_PWM_RESOLUTION);
     PWM_Init(ROOM_PWM_CHANNEL_LED2, ROOM_LED2_PIN, ROOM_PWM_FREQUENCY, ROOM_PWM_RESOLUTION);
+    PWM_FadeInit();  // Hardware fades for brightness ramps
     
     // Initialize buttons
     GPIO_PinInit(ROOM_BUTTON1_PIN, GPIO_INPUT_PULLUP);
@@ -59,6 +107,8 @@ void Room_Logic_Init(void)
 
 void Room_Logic_SetMode(Room_Mode_t mode)
 {
+    Room_Status_WriteBegin();
+
     Room_Mode_t old_mode = room_status.mode;
     room_status.mode = mode;
     
@@ -94,6 +144,8 @@ void Room_Logic_SetMode(Room_Mode_t mode)
             ROOM_DEBUG_PRINTLN("[MODE] Auto control enabled");
             break;
     }
+
+    Room_Status_WriteEnd();
 }
 
 Room_Mode_t Room_Logic_GetMode(void)
@@ -101,9 +153,9 @@ Room_Mode_t Room_Logic_GetMode(void)
     return room_status.mode;
 }
 
-const char* Room_Logic_GetModeString(void)
+const char* Room_Logic_ModeToString(Room_Mode_t mode)
 {
-    switch (room_status.mode) {
+    switch (mode) {
         case ROOM_MODE_OFF:    return "OFF";
         case ROOM_MODE_MANUAL: return "MANUAL";
         case ROOM_MODE_AUTO:   return "AUTO";
@@ -111,6 +163,11 @@ const char* Room_Logic_GetModeString(void)
     }
 }
 
+const char* Room_Logic_GetModeString(void)
+{
+    return Room_Logic_ModeToString(room_status.mode);
+}
+
 // ============================================================================
 // LED Control Functions
 // ============================================================================
@@ -130,6 +187,8 @@ void Room_Logic_SetLED(Room_LED_t led, Room_LED_State_t state, Room_ControlSourc
         return;
     }
     
+    Room_Status_WriteBegin();
+
     if (led == ROOM_LED_1) {
         room_status.led1_state = state;
         ROOM_DEBUG_PRINT("LED1 set to: ");
@@ -154,6 +213,8 @@ void Room_Logic_SetLED(Room_LED_t led, Room_LED_State_t state, Room_ControlSourc
     }
     
     Room_Logic_ApplyLEDState(led);
+
+    Room_Status_WriteEnd();
 }
 
 void Room_Logic_ToggleLED(Room_LED_t led, Room_ControlSource_t source)
@@ -234,6 +295,8 @@ void Room_Logic_UpdateAutoMode(void)
     
     // Update if changed
     if (new_brightness != room_status.led1_brightness) {
+        Room_Status_WriteBegin();
+
         room_status.led1_brightness = new_brightness;
         room_status.led2_brightness = new_brightness;
         
@@ -249,17 +312,32 @@ void Room_Logic_UpdateAutoMode(void)
         ROOM_DEBUG_PRINT("% (LDR: ");
         ROOM_DEBUG_PRINT(room_status.ldr_percentage);
         ROOM_DEBUG_PRINTLN("%)");
+
+        Room_Status_WriteEnd();
     }
 }
 
 void Room_Logic_UpdateLDR(void)
 {
-    // Call HAL main function
+    // Sample-then-store in one call; kept for callers that do not care
+    // about lock hold time
+    Room_Logic_StoreLDR(Room_Logic_SampleLDR());
+}
+
+uint16_t Room_Logic_SampleLDR(void)
+{
+    // Call HAL main function - this is where the blocking analogRead
+    // happens, so it must run with no locks held
     LDR_1_main();
-    
-    // Update status
+    return LDR_1_getLightPercentage();
+}
+
+void Room_Logic_StoreLDR(uint16_t percentage)
+{
+    Room_Status_WriteBegin();
    // room_status.ldr_raw_value = LDR_1_getRawValue();
-    room_status.ldr_percentage = LDR_1_getLightPercentage();
+    room_status.ldr_percentage = percentage;
+    Room_Status_WriteEnd();
 }
 
 uint16_t Room_Logic_GetLDRRaw(void)
@@ -272,102 +350,17 @@ uint16_t Room_Logic_GetLDRPercentage(void)
     return room_status.ldr_percentage;
 }
 
-void Room_Logic_ProcessButtons(void)
+void Room_Logic_HandleButtonEvent(Room_LED_t led)
 {
+    // Edge detection and debounce happen in the ISR (room_rtos.cpp);
+    // by the time an event reaches us it is a real press
+
     // Buttons only work in MANUAL mode
     if (room_status.mode != ROOM_MODE_MANUAL) {
         return;
     }
-    
-    unsigned long current_time = millis();
-    
-    // Button 1 - LED1 control
-    if (digitalRead(ROOM_BUTTON1_PIN) == LOW) {
-        if (current_time - button1_last_press > ROOM_BUTTON_DEBOUNCE_MS) {
-            button1_last_press = current_time;
-            Room_Logic_ToggleLED(ROOM_LED_1, ROOM_CONTROL_BUTTON);
-        }
-    }
-    
-    // Button 2 - LED2 control
-    if (digitalRead(ROOM_BUTTON2_PIN) == LOW) {
-        if (current_time - button2_last_press > ROOM_BUTTON_DEBOUNCE_MS) {
-            button2_last_press = current_time;
-            Room_Logic_ToggleLED(ROOM_LED_2, ROOM_CONTROL_BUTTON);
-        }
-    }
-}
 
-void Room_Logic_ProcessMQTTMessage(const char* topic, const char* payload)
-{
-    ROOM_DEBUG_PRINT("[MQTT] Processing - Topic: ");
-    ROOM_DEBUG_PRINT(topic);
-    ROOM_DEBUG_PRINT(", Payload: ");
-    ROOM_DEBUG_PRINTLN(payload);
-    
-    // Mode Control - Works in any mode
-    if (strcmp(topic, ROOM_TOPIC_MODE_CTRL) == 0) {
-        Room_Mode_t mode = Room_Logic_ParseMode(payload);
-        if (mode != 0xFF) {  // Valid mode
-            Room_Logic_SetMode(mode);
-            ROOM_DEBUG_PRINT("[MQTT] Mode set to: ");
-            ROOM_DEBUG_PRINTLN(Room_Logic_GetModeString());
-        } else {
-            ROOM_DEBUG_PRINT("[MQTT] Invalid mode command: ");
-            ROOM_DEBUG_PRINTLN(payload);
-        }
-    }
-    // LED1 Control - Only works in MANUAL mode
-    else if (strcmp(topic, ROOM_TOPIC_LED1_CTRL) == 0) {
-        if (room_status.mode != ROOM_MODE_MANUAL) {
-            ROOM_DEBUG_PRINT("[MQTT] Cannot control LED1 - Mode is ");
-            ROOM_DEBUG_PRINTLN(Room_Logic_GetModeString());
-            return;
-        }
-        Room_LED_State_t state = Room_Logic_ParseLEDState(payload);
-        if (state != 0xFF) {  // Valid state
-            Room_Logic_SetLED(ROOM_LED_1, state, ROOM_CONTROL_MQTT);
-            ROOM_DEBUG_PRINT("[MQTT] LED1 set to: ");
-            ROOM_DEBUG_PRINTLN(state == ROOM_LED_ON ? "ON" : "OFF");
-        } else {
-            ROOM_DEBUG_PRINT("[MQTT] Invalid LED1 command: ");
-            ROOM_DEBUG_PRINTLN(payload);
-        }
-    }
-    // LED2 Control - Only works in MANUAL mode
-    else if (strcmp(topic, ROOM_TOPIC_LED2_CTRL) == 0) {
-        if (room_status.mode != ROOM_MODE_MANUAL) {
-            ROOM_DEBUG_PRINT("[MQTT] Cannot control LED2 - Mode is ");
-            ROOM_DEBUG_PRINTLN(Room_Logic_GetModeString());
-            return;
-        }
-        Room_LED_State_t state = Room_Logic_ParseLEDState(payload);
-        if (state != 0xFF) {  // Valid state
-            Room_Logic_SetLED(ROOM_LED_2, state, ROOM_CONTROL_MQTT);
-            ROOM_DEBUG_PRINT("[MQTT] LED2 set to: ");
-            ROOM_DEBUG_PRINTLN(state == ROOM_LED_ON ? "ON" : "OFF");
-        } else {
-            ROOM_DEBUG_PRINT("[MQTT] Invalid LED2 command: ");
-            ROOM_DEBUG_PRINTLN(payload);
-        }
-    }
-    // Auto-dim Control (deprecated - maps to mode)
-    else if (strcmp(topic, ROOM_TOPIC_AUTO_DIM) == 0) {
-        Room_AutoDimMode_t autodim_mode = Room_Logic_ParseAutoDimMode(payload);
-        if (autodim_mode != 0xFF) {  // Valid mode
-            Room_Logic_SetAutoDimMode(autodim_mode);
-            ROOM_DEBUG_PRINT("[MQTT] Auto-dim set to: ");
-            ROOM_DEBUG_PRINTLN(autodim_mode == ROOM_AUTO_DIM_ENABLED ? "ENABLED" : "DISABLED");
-        } else {
-            ROOM_DEBUG_PRINT("[MQTT] Invalid auto-dim command: ");
-            ROOM_DEBUG_PRINTLN(payload);
-        }
-    }
-    // Unknown topic
-    else {
-        ROOM_DEBUG_PRINT("[MQTT] Unknown topic: ");
-        ROOM_DEBUG_PRINTLN(topic);
-    }
+    Room_Logic_ToggleLED(led, ROOM_CONTROL_BUTTON);
 }
 
 void Room_Logic_GetStatus(Room_Status_t* status)
@@ -377,6 +370,23 @@ void Room_Logic_GetStatus(Room_Status_t* status)
     }
 }
 
+void Room_Logic_GetStatusSnapshot(Room_Status_t* status)
+{
+    uint32_t seq_before, seq_after;
+
+    if (status == NULL) {
+        return;
+    }
+
+    // Seqlock read: retry if a write started (odd) or completed (changed)
+    // while we were copying. Never blocks the reader on a mutex.
+    do {
+        seq_before = room_status_seq;
+        memcpy(status, &room_status, sizeof(Room_Status_t));
+        seq_after = room_status_seq;
+    } while ((seq_before & 1u) || seq_before != seq_after);
+}
+
 // ============================================================================
 // Internal Functions
 // ============================================================================
@@ -407,35 +417,23 @@ static void Room_Logic_ApplyLEDState(Room_LED_t led)
     uint8_t brightness = (led == ROOM_LED_1) ? 
         room_status.led1_brightness : room_status.led2_brightness;
     
+    // One hardware fade command per target change - the LEDC peripheral
+    // ramps the duty itself, so there is no software staircase and no
+    // CPU wakeups while the ramp runs
     if (state == ROOM_LED_ON) {
-        PWM_Write(pwm_channel, brightness);
+        PWM_Fade(pwm_channel, brightness, ROOM_PWM_FADE_MS);
     } else {
-        PWM_Write(pwm_channel, 0);
+        PWM_Fade(pwm_channel, 0, ROOM_PWM_FADE_MS);
     }
 }
 
 static uint8_t Room_Logic_CalculateBrightness(uint16_t light_percentage)
 {
-    uint8_t brightness;
-    
-    if (light_percentage < ROOM_LIGHT_THRESHOLD_LOW) {
-        // Dark environment - full brightness
-        brightness = ROOM_BRIGHTNESS_MAX;
-    } 
-    else if (light_percentage > ROOM_LIGHT_THRESHOLD_HIGH) {
-        // Bright environment - minimum brightness
-        brightness = ROOM_BRIGHTNESS_MIN;
-    } 
-    else {
-        // Map the range between thresholds
-        brightness = map(light_percentage, 
-                        ROOM_LIGHT_THRESHOLD_LOW, 
-                        ROOM_LIGHT_THRESHOLD_HIGH, 
-                        ROOM_BRIGHTNESS_MAX, 
-                        ROOM_BRIGHTNESS_MIN);
+    // Table lookup - thresholds and gamma curve baked in at compile time
+    if (light_percentage > 100) {
+        light_percentage = 100;
     }
-    
-    return brightness;
+    return room_gamma_table[light_percentage];
 }
 
 static Room_LED_State_t Room_Logic_ParseLEDState(const char* payload)
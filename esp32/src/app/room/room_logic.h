@@ -11,6 +11,7 @@ void Room_Logic_Init(void);
 void Room_Logic_SetMode(Room_Mode_t mode);
 Room_Mode_t Room_Logic_GetMode(void);
 const char* Room_Logic_GetModeString(void);
+const char* Room_Logic_ModeToString(Room_Mode_t mode);
 
 // LED Control (only works in MANUAL mode)
 void Room_Logic_SetLED(Room_LED_t led, Room_LED_State_t state, Room_ControlSource_t source);
@@ -28,16 +29,40 @@ void Room_Logic_UpdateAutoMode(void);
 
 // LDR Processing
 void Room_Logic_UpdateLDR(void);
+
+/**
+ * @brief Run the blocking LDR acquisition - no locks required
+ * @return Light level percentage (0-100)
+ * @note Touches only the HAL, never room_status: callers sample first
+ *       and commit the result with Room_Logic_StoreLDR afterwards, so
+ *       the analogRead time is spent outside the status mutex.
+ */
+uint16_t Room_Logic_SampleLDR(void);
+
+/**
+ * @brief Commit a sampled light level into room_status
+ * @param percentage Value from Room_Logic_SampleLDR
+ * @note Seqlock-guarded store; call with room_status_mutex held like
+ *       every other status writer.
+ */
+void Room_Logic_StoreLDR(uint16_t percentage);
+
 uint16_t Room_Logic_GetLDRRaw(void);
 uint16_t Room_Logic_GetLDRPercentage(void);
 
 // Button Processing
-void Room_Logic_ProcessButtons(void);
+void Room_Logic_HandleButtonEvent(Room_LED_t led);
 
 // MQTT Message Processing
-void Room_Logic_ProcessMQTTMessage(const char* topic, const char* payload);
 
 // Status
 void Room_Logic_GetStatus(Room_Status_t* status);
 
+/**
+ * @brief Copy a consistent Room_Status_t without taking any mutex
+ * @note Seqlock read - retries if a writer was active during the copy.
+ *       Safe from any task; only writers pay synchronization cost.
+ */
+void Room_Logic_GetStatusSnapshot(Room_Status_t* status);
+
 #endif // ROOM_LOGIC_H
@@ -7,30 +7,139 @@
 #include "../../hal/communication/hal_mqtt/hal_mqtt.h"
 #include "../../hal/sensors/hal_rfid/hal_rfid.h"
 #include "../../hal/hal_led/hal_led.h"
+#include "../../drivers/driver_gpio/driver_gpio.h"
+#include "../thermostat/thermostat_rtos.h"
+#include "../common/report_policy.h"
+#include "../common/log_ring.h"
+#include "../common/sensor_history.h"
+#include "../common/app_config.h"
+#include "../common/scheduler.h"
+#include "../common/instrument.h"
 // Task handles
 TaskHandle_t room_sensor_task_handle = NULL;
 TaskHandle_t room_control_task_handle = NULL;
 TaskHandle_t room_mqtt_task_handle = NULL;
 TaskHandle_t room_button_task_handle = NULL;
 
+// Static task storage: stacks and TCBs in .bss instead of the heap,
+// cores pinned per room_rtos.h so network bursts on core 0 cannot
+// jitter the control/sensor loops on core 1
+#if SCHEDULER_ENABLED == STD_OFF
+// The LDR poll runs as a scheduler job when the executor is enabled -
+// this stack only exists for the dedicated-task fallback
+static StaticTask_t room_sensor_tcb;
+static StackType_t  room_sensor_stack[ROOM_TASK_STACK_SIZE_SMALL];
+#endif
+static StaticTask_t room_control_tcb;
+static StackType_t  room_control_stack[ROOM_TASK_STACK_SIZE_SMALL];
+static StaticTask_t room_button_tcb;
+static StackType_t  room_button_stack[ROOM_TASK_STACK_SIZE_LARGE];
+static StaticTask_t room_rfid_tcb;
+static StackType_t  room_rfid_stack[ROOM_TASK_STACK_SIZE_LARGE];
+
 // Queue handles
-QueueHandle_t room_mqtt_rx_queue = NULL;
+QueueHandle_t room_cmd_queue = NULL;
 QueueHandle_t room_mqtt_tx_queue = NULL;
 
+// Message pool: the MQTT queues carry Room_MQTTMessage_t* into these
+// static slots, so enqueue/dequeue moves 4 bytes instead of ~194 and
+// in-flight message memory is bounded and observable (see msg_pool.h)
+static Room_MQTTMessage_t room_msg_slots[ROOM_MQTT_POOL_SIZE];
+static bool room_msg_in_use[ROOM_MQTT_POOL_SIZE];
+static MsgPool_t room_msg_pool;
+
+#if ROOM_STATUS_DOC_ENABLED == STD_ON
+// Event-sourced status publishing: the per-topic publishers below fold
+// into dirty bits in this packed word, and the MQTT service cycle
+// emits one consolidated retained document once the word has been
+// dirty for a full settling window. A mode change that also flips both
+// LEDs costs one publish instead of three.
+#define ROOM_DIRTY_MODE   (1u << 0)
+#define ROOM_DIRTY_LED1   (1u << 1)
+#define ROOM_DIRTY_LED2   (1u << 2)
+#define ROOM_DIRTY_LDR    (1u << 3)
+
+static volatile uint32_t room_status_dirty = 0;
+static uint32_t room_status_first_dirty_ms = 0;
+// Markers run on both cores (scheduler, MQTT and button paths) - the
+// word and its timestamp update under a spinlock, never a mutex
+static portMUX_TYPE room_status_dirty_mux = portMUX_INITIALIZER_UNLOCKED;
+
+static void Room_RTOS_MarkStatusDirty(uint32_t bits)
+{
+    taskENTER_CRITICAL(&room_status_dirty_mux);
+    if (room_status_dirty == 0) {
+        room_status_first_dirty_ms = millis();  // Settling window opens
+    }
+    room_status_dirty |= bits;
+    taskEXIT_CRITICAL(&room_status_dirty_mux);
+}
+#endif /* ROOM_STATUS_DOC_ENABLED */
+
 // Mutex handles
 SemaphoreHandle_t room_status_mutex = NULL;
 SemaphoreHandle_t room_mutex;
 
 
-//////////////////////// RFID 
+//////////////////////// RFID
 TaskHandle_t room_rfid_task_handle = NULL;
 QueueHandle_t room_rfid_event_queue = NULL;
 
+//////////////////////// Buttons
+/// Wall switches are edge-interrupt driven: the ISRs debounce in place
+// and push the LED id into this queue, and the button task sleeps on
+// the queue instead of polling every second under the global mutex.
+static QueueHandle_t room_button_event_queue = NULL;
+
+static void ARDUINO_ISR_ATTR Room_RTOS_Button1ISR(void)
+{
+    static uint32_t last_edge_ms = 0;
+    uint32_t now = millis();
+    if (now - last_edge_ms < ROOM_BUTTON_DEBOUNCE_MS) {
+        return;  // Contact bounce
+    }
+    last_edge_ms = now;
+
+    // Single register read, safe from ISR context: if the line already
+    // bounced back high this was a noise spike, not a press
+    if (GPIO_ReadMask(GPIO_PIN_MASK(ROOM_BUTTON1_PIN)) != 0) {
+        return;
+    }
+
+    Room_LED_t led = ROOM_LED_1;
+    BaseType_t woken = pdFALSE;
+    xQueueSendFromISR(room_button_event_queue, &led, &woken);
+    portYIELD_FROM_ISR(woken);
+}
+
+static void ARDUINO_ISR_ATTR Room_RTOS_Button2ISR(void)
+{
+    static uint32_t last_edge_ms = 0;
+    uint32_t now = millis();
+    if (now - last_edge_ms < ROOM_BUTTON_DEBOUNCE_MS) {
+        return;  // Contact bounce
+    }
+    last_edge_ms = now;
+
+    if (GPIO_ReadMask(GPIO_PIN_MASK(ROOM_BUTTON2_PIN)) != 0) {
+        return;  // Noise spike - line is back high already
+    }
+
+    Room_LED_t led = ROOM_LED_2;
+    BaseType_t woken = pdFALSE;
+    xQueueSendFromISR(room_button_event_queue, &led, &woken);
+    portYIELD_FROM_ISR(woken);
+}
+
 
 // Internal function prototypes
 static void Room_RTOS_WiFiConnect(void);
 static void Room_RTOS_MQTTConnect(void);
 static void Room_RTOS_MQTTCallback(char* topic, byte* payload, unsigned int length);
+static void Room_RTOS_SensorPoll(void);
+#if ROOM_STATUS_DOC_ENABLED == STD_ON
+static void Room_RTOS_StatusDocService(void);
+#endif
 
 void Room_RTOS_Init(void)
 {
@@ -39,82 +148,117 @@ void Room_RTOS_Init(void)
     // Create mutex
     room_status_mutex = xSemaphoreCreateMutex();
     
-    // Create queues
-    room_mqtt_rx_queue = xQueueCreate(ROOM_MQTT_QUEUE_SIZE, sizeof(Room_MQTTMessage_t));
-    room_mqtt_tx_queue = xQueueCreate(ROOM_MQTT_QUEUE_SIZE, sizeof(Room_MQTTMessage_t));
+    // Create queues (pointer queues - slots live in room_msg_pool)
+    MsgPool_Init(&room_msg_pool, room_msg_slots, room_msg_in_use,
+                 sizeof(Room_MQTTMessage_t), ROOM_MQTT_POOL_SIZE);
+    // Inbound commands are 2 bytes and go by value; only the tx queue
+    // carries pool pointers
+    room_cmd_queue = xQueueCreate(ROOM_MQTT_QUEUE_SIZE, sizeof(Room_Command_t));
+    room_mqtt_tx_queue = xQueueCreate(ROOM_MQTT_QUEUE_SIZE, sizeof(Room_MQTTMessage_t*));
     
     room_mutex = xSemaphoreCreateMutex();
     
     room_rfid_event_queue = xQueueCreate(5, sizeof(Room_RFID_Event_t));
 
-    // Create tasks
-    xTaskCreate(
+    room_button_event_queue = xQueueCreate(4, sizeof(Room_LED_t));
+
+#if SCHEDULER_ENABLED == STD_ON
+    // The LDR poll is a 5 s tick of non-blocking work - it shares the
+    // executor task instead of holding a 2 KB stack of its own
+    Scheduler_AddJob("ldr", ROOM_SENSOR_PERIOD_MS, Room_RTOS_SensorPoll);
+#else
+    // Create tasks - static storage, pinned cores
+    room_sensor_task_handle = xTaskCreateStaticPinnedToCore(
         Room_RTOS_SensorTask,
         "SensorTask",
         ROOM_TASK_STACK_SIZE_SMALL,
         NULL,
         ROOM_TASK_PRIORITY_MEDIUM,
-        &room_sensor_task_handle
+        room_sensor_stack,
+        &room_sensor_tcb,
+        ROOM_TASK_CORE_CONTROL
     );
-    
-    xTaskCreate(
+#endif
+
+    room_control_task_handle = xTaskCreateStaticPinnedToCore(
         Room_RTOS_ControlTask,
         "ControlTask",
         ROOM_TASK_STACK_SIZE_SMALL,
         NULL,
         ROOM_TASK_PRIORITY_MEDIUM,
-        &room_control_task_handle
+        room_control_stack,
+        &room_control_tcb,
+        ROOM_TASK_CORE_CONTROL
     );
-    
-    
-    xTaskCreate(
+
+    room_button_task_handle = xTaskCreateStaticPinnedToCore(
         Room_RTOS_ButtonTask,
         "ButtonTask",
-        4096,
+        ROOM_TASK_STACK_SIZE_LARGE,
         NULL,
         ROOM_TASK_PRIORITY_MEDIUM,
-        &room_button_task_handle
+        room_button_stack,
+        &room_button_tcb,
+        ROOM_TASK_CORE_CONTROL
     );
 
-
-    xTaskCreate(
-    Room_RTOS_RFIDTask,
-    "RFIDTask",
-    4096,                 // RFID + SPI + String = BIG stack
-    NULL,
-    ROOM_TASK_PRIORITY_MEDIUM,
-    &room_rfid_task_handle
+    room_rfid_task_handle = xTaskCreateStaticPinnedToCore(
+        Room_RTOS_RFIDTask,
+        "RFIDTask",
+        ROOM_TASK_STACK_SIZE_LARGE,  // RFID + SPI + String = BIG stack
+        NULL,
+        ROOM_TASK_PRIORITY_MEDIUM,
+        room_rfid_stack,
+        &room_rfid_tcb,
+        ROOM_TASK_CORE_CONTROL
     );
 
-    
+#if ROOM_STATUS_DOC_ENABLED == STD_ON
+    // Seed every bit so the first serviced window publishes a complete
+    // retained document - late dashboard subscribers always converge
+    Room_RTOS_MarkStatusDirty(ROOM_DIRTY_MODE | ROOM_DIRTY_LED1 |
+                              ROOM_DIRTY_LED2 | ROOM_DIRTY_LDR);
+#endif
+
     ROOM_DEBUG_PRINTLN("Room RTOS: Initialized");
 }
 
 // ============================================================================
-// Sensor Task - Reads LDR and updates values
+// Sensor Poll - Reads LDR and updates values
 // ============================================================================
+static void Room_RTOS_SensorPoll(void)
+{
+    INSTR_SCOPE("room.ldr_poll");
+
+    // Sample with no locks held - the blocking analogRead used to sit
+    // inside the mutex, stalling the control/button paths for its
+    // duration. Only the committed result takes the mutex, and the
+    // store itself is seqlock-guarded like every other status write.
+    uint16_t percentage = Room_Logic_SampleLDR();
+
+    if (xSemaphoreTake(room_status_mutex, portMAX_DELAY)) {
+        Room_Logic_StoreLDR(percentage);
+        xSemaphoreGive(room_status_mutex);
+    }
+
+    // Publish by exception - Room_RTOS_PublishLDRData applies the
+    // LDR deadband/heartbeat policy, so calling it every cycle only
+    // costs a compare unless the light level actually moved
+    Room_RTOS_PublishLDRData();
+}
+
+#if SCHEDULER_ENABLED == STD_OFF
 void Room_RTOS_SensorTask(void* parameter)
 {
     TickType_t last_wake_time = xTaskGetTickCount();
-    const TickType_t frequency = pdMS_TO_TICKS(5000); // 100ms
-    
+    const TickType_t frequency = pdMS_TO_TICKS(ROOM_SENSOR_PERIOD_MS);
+
     while (1) {
-        // Update LDR reading
-        if (xSemaphoreTake(room_status_mutex, portMAX_DELAY)) {
-            Room_Logic_UpdateLDR();
-            xSemaphoreGive(room_status_mutex);
-        }
-        
-        // Publish LDR data every 5 seconds
-        static uint8_t counter = 0;
-        if (++counter >= 50) { // 50 * 100ms = 5000ms
-            counter = 0;
-            Room_RTOS_PublishLDRData();
-        }
-        
+        Room_RTOS_SensorPoll();
         vTaskDelayUntil(&last_wake_time, frequency);
     }
 }
+#endif /* SCHEDULER_ENABLED == STD_OFF */
 
 // ============================================================================
 // Control Task - Handles auto-dimming logic
@@ -162,42 +306,91 @@ void Room_RTOS_ControlTask(void* parameter)
 // ============================================================================
 // MQTT Task - Handles MQTT connection and message processing
 // ============================================================================
-Room_MQTTMessage_t tx_message;
-Room_MQTTMessage_t rx_message;
+
+// Max messages drained per queue per call - bounds time spent here so a
+// flooded queue can't starve the rest of the Task_Mqtt cycle
+#define ROOM_MQTT_DRAIN_BUDGET  16
 
 void Room_RTOS_MQTTWarrper(void )
 {
-            
-        // Process outgoing messages
-        if (xQueueReceive(room_mqtt_tx_queue, &tx_message, 0) == pdTRUE) {
-            MQTT_Publish(tx_message.topic, tx_message.payload);
+        uint8_t budget;
+        Room_MQTTMessage_t* msg;
+
+        // Drain all outgoing messages (bounded by the budget)
+        budget = ROOM_MQTT_DRAIN_BUDGET;
+        while (budget-- > 0 &&
+               xQueueReceive(room_mqtt_tx_queue, &msg, 0) == pdTRUE) {
+            MQTT_Publish(msg->topic, msg->payload);
+#if LOG_RING_ENABLED == STD_ON
+            char pub_line[LOG_RING_STR_MAX];
+            snprintf(pub_line, sizeof(pub_line), "%s = %s",
+                     msg->topic, msg->payload);
+            LogRing_LogStr(LOG_FMT_ROOM_PUB, pub_line, 0);
+#else
             ROOM_DEBUG_PRINT("Published: ");
-            ROOM_DEBUG_PRINT(tx_message.topic);
+            ROOM_DEBUG_PRINT(msg->topic);
             ROOM_DEBUG_PRINT(" = ");
-            ROOM_DEBUG_PRINTLN(tx_message.payload);
+            ROOM_DEBUG_PRINTLN(msg->payload);
+#endif
+            MsgPool_Free(&room_msg_pool, msg);
         }
-        
-        // Process incoming messages
-        if (xQueueReceive(room_mqtt_rx_queue, &rx_message, 0) == pdTRUE) {
+
+        // Drain decoded inbound commands, collecting which statuses
+        // changed so each is published once after the burst instead of
+        // per message. Commands arrive pre-routed (Room_Command_t) -
+        // no topic strings to compare, two bytes moved per dequeue.
+        bool publish_mode = false;
+        bool publish_led1 = false;
+        bool publish_led2 = false;
+
+        Room_Command_t cmd;
+        budget = ROOM_MQTT_DRAIN_BUDGET;
+        while (budget-- > 0 &&
+               xQueueReceive(room_cmd_queue, &cmd, 0) == pdTRUE) {
             if (xSemaphoreTake(room_status_mutex, portMAX_DELAY)) {
-                Room_Logic_ProcessMQTTMessage(rx_message.topic, rx_message.payload);
-
-                if (strcmp(rx_message.topic, ROOM_TOPIC_MODE_CTRL) == 0) {
-                    Room_RTOS_PublishModeStatus();
-                } else if (strcmp(rx_message.topic, ROOM_TOPIC_LED1_CTRL) == 0) {
-                    Room_RTOS_PublishLEDStatus(ROOM_LED_1);
-                } else if (strcmp(rx_message.topic, ROOM_TOPIC_LED2_CTRL) == 0) {
-                    Room_RTOS_PublishLEDStatus(ROOM_LED_2);
-                } else if (strcmp(rx_message.topic, ROOM_TOPIC_AUTO_DIM) == 0) {
-                    Room_RTOS_PublishModeStatus();  // Auto-dim maps to mode
+                switch ((Room_Command_Type_t)cmd.type) {
+                    case ROOM_CMD_SET_MODE:
+                        Room_Logic_SetMode((Room_Mode_t)cmd.value);
+                        publish_mode = true;
+                        break;
+
+                    case ROOM_CMD_SET_LED1:
+                    case ROOM_CMD_SET_LED2: {
+                        Room_LED_t led = (cmd.type == ROOM_CMD_SET_LED1)
+                                             ? ROOM_LED_1 : ROOM_LED_2;
+                        // MQTT only drives LEDs in MANUAL mode - gate
+                        // here on the owning task, where mode can't
+                        // change under us, not in the network callback
+                        if (Room_Logic_GetMode() == ROOM_MODE_MANUAL) {
+                            Room_Logic_SetLED(led, (Room_LED_State_t)cmd.value,
+                                              ROOM_CONTROL_MQTT);
+                            if (led == ROOM_LED_1) publish_led1 = true;
+                            else                   publish_led2 = true;
+                        } else {
+                            ROOM_DEBUG_PRINT("[MQTT] LED command ignored - mode is ");
+                            ROOM_DEBUG_PRINTLN(Room_Logic_GetModeString());
+                        }
+                        break;
+                    }
+
+                    case ROOM_CMD_SET_AUTODIM:
+                        Room_Logic_SetAutoDimMode((Room_AutoDimMode_t)cmd.value);
+                        publish_mode = true;  // Auto-dim maps to mode
+                        break;
                 }
                 xSemaphoreGive(room_status_mutex);
+            }
+        }
 
-            }  
+        // Batched status updates - one publish per changed status
+        // (dirty-bit markers when the consolidated document is enabled)
+        if (publish_mode) Room_RTOS_PublishModeStatus();
+        if (publish_led1) Room_RTOS_PublishLEDStatus(ROOM_LED_1);
+        if (publish_led2) Room_RTOS_PublishLEDStatus(ROOM_LED_2);
 
-            }
-            
-            // Publish status update
+#if ROOM_STATUS_DOC_ENABLED == STD_ON
+        Room_RTOS_StatusDocService();
+#endif
 }
 
 // ============================================================================
@@ -205,17 +398,24 @@ void Room_RTOS_MQTTWarrper(void )
 // ============================================================================
 void Room_RTOS_ButtonTask(void* parameter)
 {
-    TickType_t last_wake_time = xTaskGetTickCount();
-    const TickType_t frequency = pdMS_TO_TICKS(1000); // 50ms
-    
+    // Arm the wall-switch edge interrupts; pins are already configured
+    // as INPUT_PULLUP by Room_Logic_Init, so a press is a falling edge
+    GPIO_AttachInterruptFalling(ROOM_BUTTON1_PIN, Room_RTOS_Button1ISR);
+    GPIO_AttachInterruptFalling(ROOM_BUTTON2_PIN, Room_RTOS_Button2ISR);
+
+    Room_LED_t led;
+
     while (1) {
-        // Process button presses
+        // Sleep until an ISR delivers a debounced press - no periodic
+        // wakeups, and switch-to-light latency is queue + mutex only
+        if (xQueueReceive(room_button_event_queue, &led, portMAX_DELAY) != pdTRUE) {
+            continue;
+        }
+
         if (xSemaphoreTake(room_status_mutex, portMAX_DELAY)) {
-            Room_Logic_ProcessButtons();
+            Room_Logic_HandleButtonEvent(led);
             xSemaphoreGive(room_status_mutex);
         }
-        
-        vTaskDelayUntil(&last_wake_time, frequency);
     }
 }
 
@@ -229,33 +429,49 @@ void Room_RTOS_RFIDTask(void *parameter)
     }
 
     Room_RFID_Event_t event;
-    String uid;
+
+    // Prefer interrupt-driven detection; fall back to polling if the
+    // IRQ line is not wired on this board
+    bool irq_mode = RFID_EnableIRQMode(xTaskGetCurrentTaskHandle());
 
     while (1) {
 
-        if (RFID_IsNewCardPresent()) {
+        if (irq_mode) {
+            // Park the reader and sleep until the ISR wakes us on a tap
+            RFID_ArmIRQ();
+            ulTaskNotifyTake(pdTRUE, portMAX_DELAY);
+            RFID_ClearIRQ();
+        } else {
+            vTaskDelay(pdMS_TO_TICKS(200)); // RFID polling interval
 
-            if (RFID_ReadCard(&uid, NULL, NULL)) {
+            if (!RFID_IsNewCardPresent()) {
+                continue;
+            }
+        }
 
-                memset(&event, 0, sizeof(event));
-                strncpy(event.uid, uid.c_str(), sizeof(event.uid) - 1);
-                event.type = RFID_EVENT_CARD_DETECTED;
+        if (irq_mode && !RFID_IsNewCardPresent()) {
+            continue;  // Spurious wake
+        }
 
-                xQueueSend(room_rfid_event_queue, &event, 0);
+        memset(&event, 0, sizeof(event));
 
-                if (RFID_CheckAuthorization(uid)) {
-                    event.type = RFID_EVENT_AUTH_GRANTED;
-                    LED_ON(ACCESS_CONTROL);
+        // UID is formatted straight into the event - no heap per scan
+        if (RFID_ReadCard(event.uid, sizeof(event.uid), NULL, NULL)) {
 
-                } else {
-                    event.type = RFID_EVENT_AUTH_DENIED;
-                }
+            event.type = RFID_EVENT_CARD_DETECTED;
+
+            xQueueSend(room_rfid_event_queue, &event, 0);
+
+            if (RFID_CheckAuthorization(event.uid)) {
+                event.type = RFID_EVENT_AUTH_GRANTED;
+                LED_ON(ACCESS_CONTROL);
 
-                xQueueSend(room_rfid_event_queue, &event, 0);
+            } else {
+                event.type = RFID_EVENT_AUTH_DENIED;
             }
-        }
 
-        vTaskDelay(pdMS_TO_TICKS(200)); // RFID polling interval
+            xQueueSend(room_rfid_event_queue, &event, 0);
+        }
     }
 }
 
@@ -269,40 +485,107 @@ bool Room_RTOS_SendMQTTMessage(const Room_MQTTMessage_t* message)
     if (room_mqtt_tx_queue == NULL || message == NULL) {
         return false;
     }
-    return xQueueSend(room_mqtt_tx_queue, message, pdMS_TO_TICKS(100)) == pdTRUE;
+
+    Room_MQTTMessage_t* slot =
+        (Room_MQTTMessage_t*)MsgPool_Alloc(&room_msg_pool);
+    if (slot == NULL) {
+        return false;  // Pool exhausted - counted in the pool stats
+    }
+
+    *slot = *message;
+    if (xQueueSend(room_mqtt_tx_queue, &slot, pdMS_TO_TICKS(100)) != pdTRUE) {
+        MsgPool_Free(&room_msg_pool, slot);
+        return false;
+    }
+
+    // The MQTT service loop idles on a notification wait - kick it so
+    // the longer idle period costs no publish latency
+    Thermostat_MqttKick();
+    return true;
 }
 
-bool Room_RTOS_ReceiveMQTTMessage(Room_MQTTMessage_t* message, uint32_t timeout_ms)
+bool Room_RTOS_SendCommand(const Room_Command_t* cmd)
 {
-    if (room_mqtt_rx_queue == NULL || message == NULL) {
+    if (room_cmd_queue == NULL || cmd == NULL) {
         return false;
     }
-    return xQueueReceive(room_mqtt_rx_queue, message, pdMS_TO_TICKS(timeout_ms)) == pdTRUE;
+
+    // Called from the network task's message callback - never block it
+    if (xQueueSend(room_cmd_queue, cmd, 0) != pdTRUE) {
+        return false;  // Burst beyond queue depth - command dropped
+    }
+
+    // Same kick as the tx path - the service loop idles on a notify
+    Thermostat_MqttKick();
+    return true;
+}
+
+void Room_RTOS_GetMsgPoolStats(MsgPoolStats_t* out)
+{
+    MsgPool_GetStats(&room_msg_pool, out);
 }
 
 void Room_RTOS_PublishLEDStatus(Room_LED_t led)
 {
+#if ROOM_STATUS_DOC_ENABLED == STD_ON
+    Room_RTOS_MarkStatusDirty((led == ROOM_LED_1) ? ROOM_DIRTY_LED1
+                                                  : ROOM_DIRTY_LED2);
+#else
     Room_MQTTMessage_t message;
-    Room_LED_State_t state = Room_Logic_GetLEDState(led);
-    
+    Room_Status_t status;
+
+    // Lock-free consistent read - publishers never block on the mutex
+    Room_Logic_GetStatusSnapshot(&status);
+    Room_LED_State_t state = (led == ROOM_LED_1) ? status.led1_state : status.led2_state;
+
     if (led == ROOM_LED_1) {
         strcpy(message.topic, ROOM_TOPIC_LED1_STATUS);
     } else {
         strcpy(message.topic, ROOM_TOPIC_LED2_STATUS);
     }
-    
+
     strcpy(message.payload, (state == ROOM_LED_ON) ? "ON" : "OFF");
     message.length = strlen(message.payload);
-    
+
     Room_RTOS_SendMQTTMessage(&message);
+#endif
 }
 
 void Room_RTOS_PublishLDRData(void)
 {
     Room_MQTTMessage_t message;
-    //uint16_t raw_value = Room_Logic_GetLDRRaw();
-    uint16_t percentage = Room_Logic_GetLDRPercentage();
-    
+    Room_Status_t status;
+
+    // Report-by-exception: deadband + heartbeat instead of the old
+    // unconditional publish every 5 s
+#if CONFIG_CACHE_ENABLED == STD_ON
+    const ReportPolicy_t ldr_policy =
+        { Config_Get()->ldr_deadband, REPORT_LDR_MIN_MS, REPORT_LDR_HEARTBEAT_MS };
+#else
+    static const ReportPolicy_t ldr_policy =
+        { REPORT_LDR_DEADBAND, REPORT_LDR_MIN_MS, REPORT_LDR_HEARTBEAT_MS };
+#endif
+    static ReportState_t ldr_state = {};
+
+    Room_Logic_GetStatusSnapshot(&status);
+    //uint16_t raw_value = status.ldr_raw_value;
+    uint16_t percentage = status.ldr_percentage;
+
+#if SENSOR_HISTORY_ENABLED == STD_ON
+    // Every raw sample feeds the history window, published or not
+    History_Add(HISTORY_LDR, (float)percentage);
+#endif
+
+    if (!Report_ShouldPublish(&ldr_policy, &ldr_state, (float)percentage, millis())) {
+        return;
+    }
+
+#if ROOM_STATUS_DOC_ENABLED == STD_ON
+    // Deadband/heartbeat verdict stands - only the transport changed:
+    // the value rides the consolidated document instead of its own topic
+    (void)message;
+    Room_RTOS_MarkStatusDirty(ROOM_DIRTY_LDR);
+#else
     // Publish raw value
     /*
     strcpy(message.topic, ROOM_TOPIC_LDR_RAW);
@@ -315,18 +598,68 @@ void Room_RTOS_PublishLDRData(void)
     sprintf(message.payload, "%d", percentage);
     message.length = strlen(message.payload);
     Room_RTOS_SendMQTTMessage(&message);
+#endif
 }
 
 void Room_RTOS_PublishModeStatus(void)
 {
+#if ROOM_STATUS_DOC_ENABLED == STD_ON
+    Room_RTOS_MarkStatusDirty(ROOM_DIRTY_MODE);
+#else
     Room_MQTTMessage_t message;
-    
+    Room_Status_t status;
+
+    Room_Logic_GetStatusSnapshot(&status);
+
     strcpy(message.topic, ROOM_TOPIC_MODE_STATUS);
-    strcpy(message.payload, Room_Logic_GetModeString());
+    strcpy(message.payload, Room_Logic_ModeToString(status.mode));
     message.length = strlen(message.payload);
-    
+
     Room_RTOS_SendMQTTMessage(&message);
+#endif
+}
+
+#if ROOM_STATUS_DOC_ENABLED == STD_ON
+/**
+ * @brief Coalescing publisher - one retained document per settling window
+ * @note Runs in the MQTT service cycle (Room_RTOS_MQTTWarrper), so it
+ *       shares that task instead of owning one. The dirty bits only
+ *       gate WHEN a document goes out; the document itself always
+ *       carries the full status snapshot, so the retained copy on the
+ *       broker is complete for late subscribers.
+ */
+static void Room_RTOS_StatusDocService(void)
+{
+    uint32_t now = millis();
+
+    taskENTER_CRITICAL(&room_status_dirty_mux);
+    if (room_status_dirty == 0 ||
+        (now - room_status_first_dirty_ms) < ROOM_STATUS_SETTLE_MS) {
+        taskEXIT_CRITICAL(&room_status_dirty_mux);
+        return;  // Nothing changed, or changes are still settling
+    }
+    room_status_dirty = 0;
+    taskEXIT_CRITICAL(&room_status_dirty_mux);
+
+    Room_Status_t status;
+    Room_Logic_GetStatusSnapshot(&status);
+
+    char doc[160];
+    snprintf(doc, sizeof(doc),
+             "{\"mode\":\"%s\",\"led1\":\"%s\",\"led1_brightness\":%u,"
+             "\"led2\":\"%s\",\"led2_brightness\":%u,\"ldr\":%u}",
+             Room_Logic_ModeToString(status.mode),
+             (status.led1_state == ROOM_LED_ON) ? "ON" : "OFF",
+             status.led1_brightness,
+             (status.led2_state == ROOM_LED_ON) ? "ON" : "OFF",
+             status.led2_brightness,
+             status.ldr_percentage);
+
+    // Straight to the HAL - this runs in the same task that drains the
+    // tx queue, so ordering against queued publishes is preserved
+    MQTT_PublishRetained(ROOM_TOPIC_STATUS_DOC, doc);
 }
+#endif /* ROOM_STATUS_DOC_ENABLED */
 
 // ============================================================================
 // Internal Functions
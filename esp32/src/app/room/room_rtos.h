@@ -6,6 +6,7 @@
 #include <freertos/queue.h>
 #include <freertos/semphr.h>
 #include "room_types.h"
+#include "../common/msg_pool.h"
 
 // Task priorities
 #define ROOM_TASK_PRIORITY_HIGH     3
@@ -17,9 +18,25 @@
 #define ROOM_TASK_STACK_SIZE_MEDIUM 3072
 #define ROOM_TASK_STACK_SIZE_SMALL  2048
 
+// Core affinity: protocol-facing work shares core 0 with the WiFi
+// stack, control/sensor loops own core 1
+#define ROOM_TASK_CORE_PROTOCOL     0
+#define ROOM_TASK_CORE_CONTROL      1
+
+// LDR sample period - also the "ldr" job period when the cooperative
+// scheduler owns the poll
+#define ROOM_SENSOR_PERIOD_MS       5000
+
 // Queue sizes
 #define ROOM_MQTT_QUEUE_SIZE        10
 
+// Message pool: the tx queue carries pointers into this fixed pool
+// instead of copying Room_MQTTMessage_t (~194 bytes) by value. Sized to
+// cover the queue full plus in-flight messages being built or drained.
+// (Inbound traffic no longer draws on the pool - commands travel as
+// 2-byte Room_Command_t values.)
+#define ROOM_MQTT_POOL_SIZE         (ROOM_MQTT_QUEUE_SIZE + 4)
+
 // Task handles
 extern TaskHandle_t room_sensor_task_handle;
 extern TaskHandle_t room_control_task_handle;
@@ -27,7 +44,7 @@ extern TaskHandle_t room_mqtt_task_handle;
 extern TaskHandle_t room_button_task_handle;
 
 // Queue handles
-extern QueueHandle_t room_mqtt_rx_queue;
+extern QueueHandle_t room_cmd_queue;
 extern QueueHandle_t room_mqtt_tx_queue;
 
 // Mutex handles
@@ -44,7 +61,8 @@ void Room_RTOS_ButtonTask(void* parameter);
 void Room_RTOS_MQTTWarrper(void );
 // Queue management
 bool Room_RTOS_SendMQTTMessage(const Room_MQTTMessage_t* message);
-bool Room_RTOS_ReceiveMQTTMessage(Room_MQTTMessage_t* message, uint32_t timeout_ms);
+bool Room_RTOS_SendCommand(const Room_Command_t* cmd);
+void Room_RTOS_GetMsgPoolStats(MsgPoolStats_t* out);
 
 // Status publishing
 void Room_RTOS_PublishLEDStatus(Room_LED_t led);
@@ -55,6 +55,21 @@ typedef struct {
     uint16_t length;
 } Room_MQTTMessage_t;
 
+// Inbound command, fully decoded at the MQTT callback: the dispatch
+// table resolves the topic to this enum and the payload parses to a
+// value, so nothing downstream stores topic strings or re-parses
+typedef enum {
+    ROOM_CMD_SET_MODE = 0,      // value: Room_Mode_t
+    ROOM_CMD_SET_LED1,          // value: Room_LED_State_t
+    ROOM_CMD_SET_LED2,          // value: Room_LED_State_t
+    ROOM_CMD_SET_AUTODIM        // value: Room_AutoDimMode_t
+} Room_Command_Type_t;
+
+typedef struct {
+    uint8_t type;               // Room_Command_Type_t
+    uint8_t value;              // Decoded payload, meaning per type
+} Room_Command_t;
+
 
 typedef enum {
     RFID_EVENT_CARD_DETECTED,
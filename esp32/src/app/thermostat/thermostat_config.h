@@ -1,6 +1,8 @@
 #ifndef THERMOSTAT_CONFIG_H
 #define THERMOSTAT_CONFIG_H
 
+#include "app_cfg.h"  // LOG_LEVEL_* constants cap the debug macros below
+
 // ==================== DEBUG CONFIGURATION ====================
 #define DEBUG_ENABLED           1 // Set to 0 to disable all debug output
 #define DEBUG_TEMP_SENSOR       1  // Debug temperature sensor task
@@ -9,15 +11,25 @@
 #define DEBUG_MQTT              1  // Debug MQTT task
 #define DEBUG_WIFI              1  // Debug WiFi task
 #define DEBUG_STACK_MONITOR     0  // Monitor stack usage
-#define DEBUG_TIMING            0  // Show timing information
+#define DEBUG_TIMING            1  // Per-task runtime profiler (esp_timer)
 #define DEBUG_QUEUE_STATUS      0  // Monitor queue status
 #define DEBUG_HUM_SENSOR        1  // Debug temperature sensor task
 
 // Stack monitoring interval (ms)
 #define STACK_MONITOR_INTERVAL_MS  10000
 
+// Profiler publish interval (ms) - one JSON document per task on
+// MQTT_TOPIC_DIAG_TASKS, ingested by the Telegraf/InfluxDB stack
+#define PROFILER_PUBLISH_MS        30000
+
+// Heap monitor publish interval (ms) - free/min-free/largest-block plus
+// room message-pool usage on MQTT_TOPIC_DIAG_HEAP
+#define HEAP_MONITOR_PUBLISH_MS    60000
+
 // ==================== DEBUG MACROS ====================
-#if DEBUG_ENABLED
+// Capped by LOG_LEVEL_GLOBAL so -DLOG_LEVEL_GLOBAL=0 release builds
+// strip these sites along with the LOG_E/W/I/D ones (see app_log.h)
+#if DEBUG_ENABLED && LOG_LEVEL_GLOBAL >= LOG_LEVEL_DEBUG
     #define DEBUG_PRINT(module, fmt, ...) \
         do { \
             if (DEBUG_##module) { \
@@ -53,6 +65,12 @@
 
 #define TARGET_TEMP_THRESHOLD  1   // degrees Celsius
 
+// Pre-first-sample settle time at task start. The DHT22 cache task and
+// the MQ5 warm-up gate handle their own sensor readiness, so this only
+// needs to cover ADC/rail settling - short enough that the first
+// reading publishes within ~500 ms of boot
+#define BOOT_SENSOR_SETTLE_MS  250
+
 // Fan state thresholds
 #define FAN_MEDIUM_THRESHOLD_HIGH    1.0f   // Switch to medium when delta >= this
 #define FAN_MEDIUM_THRESHOLD_LOW     1.0f   // Switch to low when delta < this
@@ -60,6 +78,33 @@
 #define FAN_HIGH_THRESHOLD_LOW       3.0f   // Switch to medium when delta < this
 /////////////////
 
+// ==================== FAN PID CONTROL ====================
+// Continuous-PWM fan drive: a PI controller (derivative gain available
+// but zero by default - Kd on a noisy DHT reading mostly amplifies the
+// noise) replaces the four-step Fan_Logic table, so the fan glides
+// around the setpoint instead of cycling hard-on/hard-off. Set
+// FAN_PID_ENABLED to 0 to fall back to the discrete table.
+#define FAN_PID_ENABLED         1
+#define FAN_PID_KP              60.0f   // Duty counts per °C of error
+#define FAN_PID_KI              2.0f    // Duty counts per °C·s
+#define FAN_PID_KD              0.0f    // Duty counts per °C/s
+#define FAN_PID_OUT_MAX         255.0f  // Full scale of the 8-bit LEDC duty
+#define FAN_PID_DEADBAND        0.2f    // °C; inside it the output bleeds to off
+
+#define FAN_PWM_PIN             13
+#define FAN_PWM_CHANNEL         3       // Ch 0 = room dimmer, ch 2 = alarm dimmer
+
+// Status/LED side only follows the duty when it moves by at least this
+// many counts - small PID corrections stay off the speed-indicator
+// bank and out of mqttPublishQueue
+#define FAN_DUTY_REPORT_DELTA   8
+
+// Actuation layer (Fan_Actuate): a speed transition must hold at least
+// this long before AUTO may apply the next one, so a reading hovering
+// on a threshold cannot chatter the relay. Explicit commands (manual
+// speed, mode OFF) bypass the dwell.
+#define FAN_SPEED_DWELL_MS      2000
+
 #define POT_TEMP_PIN     34  // POT1 for temperature reading
 #define POT_HUMIDITY_PIN 35  // POT2 for humidity reading
 #define POT_TARGET_PIN   32  // POT3 for target temperature knob
@@ -79,19 +124,29 @@
 
 
 // ==================== STACK SIZE DEFINITIONS ====================
-#define TEMP_SENSOR_STACK_SIZE  3072
-#define USER_INPUT_STACK_SIZE   3072
+// One consolidated sensor task (temp/hum/pot/gas) replaces the old
+// temp + user-input pair - every channel reads a cached value, so one
+// 3 KB stack covers the whole list
+#define SENSORS_STACK_SIZE      3072
 #define FAN_CONTROL_STACK_SIZE  3072
 #define MQTT_STACK_SIZE         4096
 #define WIFI_STACK_SIZE         4096
 
 // ==================== TASK PRIORITY DEFINITIONS ====================
-#define TEMP_SENSOR_PRIORITY    3
-#define USER_INPUT_PRIORITY     2
+#define SENSORS_PRIORITY        3
 #define FAN_CONTROL_PRIORITY    2
 #define MQTT_PRIORITY           1
 #define WIFI_PRIORITY           1
 
+// ==================== TASK CORE AFFINITY ====================
+// Protocol tasks share core 0 with the WiFi/LwIP stack; control and
+// sensor tasks own core 1 so the 100 ms loops never contend with
+// network bursts
+#define SENSORS_CORE            1
+#define FAN_CONTROL_CORE        1
+#define MQTT_CORE               0
+#define WIFI_CORE               0
+
 // Event bits
 #define TEMP_UPDATED_BIT      (1 << 0)
 #define TARGET_UPDATED_BIT    (1 << 1)
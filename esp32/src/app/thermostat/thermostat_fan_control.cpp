@@ -7,10 +7,13 @@
 #include "../../hal/sensors/hal_mq5/hal_mq5.h"
 #include "../../hal/sensors/hal_dht/hal_dht.h"
 #include "../../hal/hal_led/hal_led.h"
+#include "../../hal/hal_pwm/hal_pwm.h"
 #include "../../hal/communication/hal_mqtt/hal_mqtt.h"
+#include "../../drivers/driver_gpio/driver_gpio.h"
 
 #include "thermostat_config.h"
 #include "thermostat_types.h"
+#include "thermostat_pub_ring.h"
 
 
 static int pot_raw_value = 0 ; 
@@ -60,7 +63,11 @@ void Thermostat_Init_Hardware(void)
     LED_OFF(LED_LOW_SPEED);
     LED_OFF(LED_MED_SPEED);
     LED_OFF(LED_HIGH_SPEED);
-    
+
+#if FAN_PID_ENABLED
+    Fan_PID_Init();
+#endif
+
     Serial.println("Thermostat Hardware initialized");
 }
 
@@ -146,40 +153,85 @@ float Thermostat_GetTargetTemp(void)
 
 void updateLEDs(Fan_Speed_t speed)
 {
-    // Turn on appropriate LED based on fan speed
-    g_status.fan_speed = speed ; 
+    // Speed-indicator bank: all three pins fold into one constant mask,
+    // and the whole bank updates in two register writes instead of three
+    // digitalWrite round trips through the Arduino pin-mapping layer
+    const uint32_t bank = GPIO_PIN_MASK(LED_LOW_SPEED) |
+                          GPIO_PIN_MASK(LED_MED_SPEED) |
+                          GPIO_PIN_MASK(LED_HIGH_SPEED);
+    uint32_t on = 0;
+
+    g_status.fan_speed = speed ;
     switch (g_status.fan_speed)
     {
         case FAN_SPEED_LOW:
-            LED_OFF(LED_MED_SPEED);
-            LED_OFF(LED_HIGH_SPEED);
-            LED_ON(LED_LOW_SPEED);
+            on = GPIO_PIN_MASK(LED_LOW_SPEED);
             break;
         case FAN_SPEED_MEDIUM:
-            LED_ON(LED_MED_SPEED);
-            LED_OFF(LED_HIGH_SPEED);
-            LED_OFF(LED_LOW_SPEED);
+            on = GPIO_PIN_MASK(LED_MED_SPEED);
             break;
         case FAN_SPEED_HIGH:
-            LED_OFF(LED_MED_SPEED);
-            LED_ON(LED_HIGH_SPEED);
-            LED_OFF(LED_LOW_SPEED);
+            on = GPIO_PIN_MASK(LED_HIGH_SPEED);
             break;
         case FAN_SPEED_OFF:
         default:
-            break;
+            return;  // Leave the bank as-is, matching the old behavior
     }
+
+    GPIO_WriteMask(on, bank & ~on);
+}
+
+// ==================== FAN ACTUATION LAYER ====================
+// Every speed transition funnels through Fan_Actuate: same-value
+// requests are dropped before they touch the PWM, LED bank or the
+// publish ring, and AUTO transitions must respect a minimum dwell so a
+// reading hovering on a threshold cannot chatter the hardware.
+
+static Fan_Speed_t  g_actuatedSpeed   = FAN_SPEED_OFF;
+static unsigned long g_lastTransitionMs = 0;
+
+bool Fan_Actuate(Fan_Speed_t speed, bool force)
+{
+    if (speed == g_actuatedSpeed) {
+        return false;  // Idempotent - nothing to write, nothing to publish
+    }
+
+    unsigned long now = millis();
+    if (!force && g_lastTransitionMs != 0 &&
+        now - g_lastTransitionMs < FAN_SPEED_DWELL_MS) {
+        // Still dwelling on the previous transition - the control
+        // logic will ask again next cycle if it still wants this
+        return false;
+    }
+
+    g_lastTransitionMs = now;
+    g_actuatedSpeed = speed;
+    g_status.fan_speed = speed;
+    updateLEDs(speed);
+
+    // Exactly one status publish per real transition
+    mqtt_pub_msg_t msg;
+    msg.type = MQTT_PUB_FAN;
+    msg.value = (float)speed;
+    PubRing_Push(&msg);
+    return true;
 }
 
 void Thermostat_SetFanSpeed(Fan_Speed_t speed)
 {
     if (g_status.mode == THERMOSTAT_MODE_MANUAL)
     {
-        g_status.fan_speed = speed;
+        // Explicit command - no dwell, but still idempotent
+        if (!Fan_Actuate(speed, true)) {
+            return;
+        }
         Serial.print("[DEBUG] Thermostat_SetFanSpeed() -> ");
         Serial.println(speed);
-        updateLEDs(speed);
-
+#if FAN_PID_ENABLED
+        // Manual mode drives the PWM at the bucket's full step - the
+        // PID only owns the duty in AUTO
+        PWM_Write(FAN_PWM_CHANNEL, (uint8_t)(speed * 85));
+#endif
 
     }
 }
@@ -207,23 +259,133 @@ Thermostat_Status_t Thermostat_GetStatus(void)
 void Fan_Logic (float target_temp, float current_temp)
 {
         float diff = abs(current_temp - target_temp);
+        Fan_Speed_t desired;
 
         if (diff <= 0.5) {
-            g_status.fan_speed = FAN_SPEED_OFF;
-            updateLEDs(FAN_SPEED_OFF);
-
+            desired = FAN_SPEED_OFF;
         } else if (diff <= 1.5) {
-            g_status.fan_speed = FAN_SPEED_LOW;
-            updateLEDs(FAN_SPEED_LOW);
+            desired = FAN_SPEED_LOW;
         } else if (diff <= 3.0) {
-            g_status.fan_speed = FAN_SPEED_MEDIUM;
-            updateLEDs(FAN_SPEED_MEDIUM);
-
+            desired = FAN_SPEED_MEDIUM;
         } else {
-            g_status.fan_speed = FAN_SPEED_HIGH;
-            updateLEDs(FAN_SPEED_HIGH);
-
+            desired = FAN_SPEED_HIGH;
         }
 
+        // Dwell-gated: a fresh transition holds FAN_SPEED_DWELL_MS
+        // before the table may move the speed again
+        Fan_Actuate(desired, false);
+
+
+}
+
+#if FAN_PID_ENABLED
+// ==================== PID FAN CONTROL ====================
+// Continuous replacement for the Fan_Logic step table. The error is
+// the distance from setpoint (the fan cannot change direction, so the
+// sign of the delta is irrelevant, same as Fan_Logic's abs(diff)) and
+// the output is an 8-bit LEDC duty. Anti-windup is conditional
+// integration: the integrator freezes while the output is pinned at
+// full scale, so a long pull-down does not bank hours of error that
+// would hold the fan on after the room catches up.
+
+static float g_pidIntegral    = 0.0f;
+static float g_pidPrevError   = 0.0f;
+static unsigned long g_pidLastMs = 0;
+static uint8_t g_fanDuty      = 0;    // Last duty written to the PWM
+static uint8_t g_reportedDuty = 0;    // Last duty reflected in LEDs/status
+
+/**
+ * @brief Map a PWM duty onto the discrete Fan_Speed_t buckets
+ * @note Keeps the speed-indicator LEDs and the MQTT status schema
+ *       working unchanged on top of the continuous output.
+ */
+static Fan_Speed_t dutyToSpeed(uint8_t duty)
+{
+    if (duty == 0)   return FAN_SPEED_OFF;
+    if (duty <= 85)  return FAN_SPEED_LOW;
+    if (duty <= 170) return FAN_SPEED_MEDIUM;
+    return FAN_SPEED_HIGH;
+}
+
+void Fan_PID_Init(void)
+{
+    PWM_Init(FAN_PWM_CHANNEL, FAN_PWM_PIN, PWM_FREQ, PWM_RESOLUTION);
+    Serial.println("Fan PID initialized (PWM drive)");
+}
+
+void Fan_PID_Reset(void)
+{
+    g_pidIntegral  = 0.0f;
+    g_pidPrevError = 0.0f;
+    g_pidLastMs    = 0;
+    g_fanDuty      = 0;
+    g_reportedDuty = 0;
+    PWM_Write(FAN_PWM_CHANNEL, 0);
+}
+
+uint8_t Fan_PID_GetDuty(void)
+{
+    return g_fanDuty;
+}
 
-}
\ No newline at end of file
+void Fan_PID_Logic(float target_temp, float current_temp)
+{
+    unsigned long now = millis();
+    float dt = (g_pidLastMs == 0) ? (LOGIC_UPDATE_RATE_MS / 1000.0f)
+                                  : (now - g_pidLastMs) / 1000.0f;
+    g_pidLastMs = now;
+    // The control task is event-driven, so dt varies; clamp it so a
+    // long quiet stretch cannot inject one giant integral step
+    if (dt < 0.05f) dt = 0.05f;
+    if (dt > 10.0f) dt = 10.0f;
+
+    float error = fabsf(current_temp - target_temp);
+    if (error <= FAN_PID_DEADBAND) {
+        // Inside the deadband: no proportional drive, and the
+        // integrator bleeds off so the fan ramps down to rest instead
+        // of idling forever on banked error
+        error = 0.0f;
+        g_pidIntegral *= 0.8f;
+    }
+
+    float p = FAN_PID_KP * error;
+    float d = 0.0f;
+    if (FAN_PID_KD != 0.0f) {  // Folded out when the gain is zero
+        d = FAN_PID_KD * (error - g_pidPrevError) / dt;
+    }
+    g_pidPrevError = error;
+
+    // Conditional integration (anti-windup): only accumulate while the
+    // unsaturated output is below full scale
+    float unsat = p + FAN_PID_KI * g_pidIntegral + d;
+    if (unsat < FAN_PID_OUT_MAX) {
+        g_pidIntegral += error * dt;
+    }
+
+    float out = p + FAN_PID_KI * g_pidIntegral + d;
+    if (out < 0.0f) out = 0.0f;
+    if (out > FAN_PID_OUT_MAX) out = FAN_PID_OUT_MAX;
+
+    uint8_t duty = (uint8_t)(out + 0.5f);
+    if (duty != g_fanDuty) {
+        g_fanDuty = duty;
+        PWM_Write(FAN_PWM_CHANNEL, duty);
+    }
+
+    // The status side (LED bank, g_status.fan_speed and with it the
+    // MQTT publishes) only follows the duty when it moves by a real
+    // amount or crosses a speed bucket - small PID corrections stay
+    // silent, which is the point of the continuous drive
+    int delta = (int)duty - (int)g_reportedDuty;
+    if (delta < 0) delta = -delta;
+    Fan_Speed_t bucket = dutyToSpeed(duty);
+    if (delta >= FAN_DUTY_REPORT_DELTA || bucket != g_status.fan_speed) {
+        g_reportedDuty = duty;
+        // Bucket transitions go through the actuation layer - dwell
+        // gated and published once, same as the discrete table
+        Fan_Actuate(bucket, false);
+        Serial.print("[DEBUG] Fan PID duty: ");
+        Serial.println(duty);
+    }
+}
+#endif // FAN_PID_ENABLED
\ No newline at end of file
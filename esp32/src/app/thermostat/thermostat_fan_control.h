@@ -24,6 +24,19 @@ void Thermostat_StoreTemp(float temp);
 float Thermostat_GetTemp(void);
 
 void Fan_Logic (float target_temp, float current_temp);
+
+// Actuation layer: idempotent, dwell-gated speed transitions. Returns
+// true only when the speed actually changed (PWM/LEDs/status written,
+// one MQTT_PUB_FAN pushed). force bypasses the dwell for explicit
+// commands.
+bool Fan_Actuate(Fan_Speed_t speed, bool force);
+
+// PID fan drive (FAN_PID_ENABLED in thermostat_config.h). Continuous
+// PWM output with anti-windup; Fan_Logic stays as the discrete fallback.
+void Fan_PID_Init(void);
+void Fan_PID_Reset(void);
+void Fan_PID_Logic(float target_temp, float current_temp);
+uint8_t Fan_PID_GetDuty(void);
 Thermostat_Status_t Thermostat_GetStatus(void);
 void Thermostat_PublishData(void);
 
@@ -0,0 +1,85 @@
+#include <Arduino.h>
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+#include "thermostat_pub_ring.h"
+#include "thermostat_rtos.h"
+
+// ==================== RING STORAGE ====================
+// head: next slot to write (producers), tail: next slot to read (consumer).
+// Indices are free-running uint32_t and masked on access, so head - tail
+// is always the fill level even across wrap-around.
+static mqtt_pub_msg_t g_ring[PUB_RING_SIZE];
+static volatile uint32_t g_head = 0;
+static volatile uint32_t g_tail = 0;
+static volatile uint32_t g_dropped = 0;
+
+// Spinlock guarding the producer-side slot claim (several tasks produce).
+// No blocking and no scheduler call happen while it is held.
+static portMUX_TYPE g_ringMux = portMUX_INITIALIZER_UNLOCKED;
+
+#define PUB_RING_MASK  (PUB_RING_SIZE - 1)
+
+void PubRing_Init(void)
+{
+    g_head = 0;
+    g_tail = 0;
+    g_dropped = 0;
+}
+
+bool PubRing_Push(const mqtt_pub_msg_t* msg)
+{
+    if (msg == NULL) {
+        return false;
+    }
+
+    taskENTER_CRITICAL(&g_ringMux);
+
+    // Overwrite-oldest: when full, advance tail so the consumer skips
+    // the entry we are about to clobber, and count the drop.
+    if ((g_head - g_tail) >= PUB_RING_SIZE) {
+        g_tail++;
+        g_dropped++;
+    }
+
+    g_ring[g_head & PUB_RING_MASK] = *msg;
+    g_head++;
+
+    taskEXIT_CRITICAL(&g_ringMux);
+
+    // Outside the critical section: wake the consumer so it can idle
+    // on a long notification wait instead of a short poll
+    Thermostat_MqttKick();
+
+    return true;
+}
+
+bool PubRing_Pop(mqtt_pub_msg_t* msg)
+{
+    if (msg == NULL) {
+        return false;
+    }
+
+    taskENTER_CRITICAL(&g_ringMux);
+
+    if (g_head == g_tail) {
+        taskEXIT_CRITICAL(&g_ringMux);
+        return false;  // Empty
+    }
+
+    *msg = g_ring[g_tail & PUB_RING_MASK];
+    g_tail++;
+
+    taskEXIT_CRITICAL(&g_ringMux);
+
+    return true;
+}
+
+uint32_t PubRing_Count(void)
+{
+    return g_head - g_tail;
+}
+
+uint32_t PubRing_DroppedCount(void)
+{
+    return g_dropped;
+}
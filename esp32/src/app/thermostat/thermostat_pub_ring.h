@@ -0,0 +1,49 @@
+#ifndef THERMOSTAT_PUB_RING_H
+#define THERMOSTAT_PUB_RING_H
+
+#include <stdint.h>
+#include <stdbool.h>
+#include "../../hal/communication/hal_mqtt/hal_mqtt.h"
+
+// Ring capacity - must be a power of two (index masking)
+#define PUB_RING_SIZE  256
+
+/**
+ * @brief Initialize the publish ring (clears indices and drop counter)
+ */
+void PubRing_Init(void);
+
+/**
+ * @brief Push a message into the ring - never blocks
+ * @param msg Message to copy into the ring
+ * @return true always (when full the oldest entry is overwritten)
+ *
+ * @note Producer side: sensor tasks. Slot claim is done inside a short
+ *       critical section (a few instructions) because more than one task
+ *       produces; there is no waiting and no kernel call on this path.
+ */
+bool PubRing_Push(const mqtt_pub_msg_t* msg);
+
+/**
+ * @brief Pop the oldest message from the ring - never blocks
+ * @param msg Output message
+ * @return true if a message was read, false if the ring is empty
+ *
+ * @note Consumer side: Task_Mqtt, plus Task_Wifi's store-forward
+ *       divert while Task_Mqtt is suspended during a WiFi outage -
+ *       never both at once, and the pop is guarded by the ring's
+ *       critical section either way
+ */
+bool PubRing_Pop(mqtt_pub_msg_t* msg);
+
+/**
+ * @brief Number of messages currently waiting in the ring
+ */
+uint32_t PubRing_Count(void);
+
+/**
+ * @brief Number of messages overwritten because the ring was full
+ */
+uint32_t PubRing_DroppedCount(void);
+
+#endif // THERMOSTAT_PUB_RING_H
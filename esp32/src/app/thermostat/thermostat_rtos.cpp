@@ -1,13 +1,24 @@
+#include "esp_timer.h"
 #include "thermostat_rtos.h"
 #include "thermostat_config.h"
 #include "thermostat_types.h"
 #include "thermostat_fan_control.h"
+#include "thermostat_pub_ring.h"
+#include "thermostat_store_forward.h"
+#include "../common/report_policy.h"
+#include "../common/blackbox.h"
+#include "../common/boot_bench.h"
+#include "../common/sensor_history.h"
+#include "../common/app_config.h"
+#include "../common/scheduler.h"
+#include "../common/instrument.h"
 
 #include "../../hal/sensors/hal_mq5/hal_mq5.h"
 #include "../../hal/communication/hal_wifi/hal_wifi.h"
 #include "../../hal/communication/hal_mqtt/hal_mqtt.h"
 #include "../../hal/sensors/hal_dht/hal_dht.h"
 #include "../../hal/sensors/hal_potentiometer/hal_potentiometer.h"
+#include "../../hal/sensors/SensorH/sensor_framework.h"
 #include "../../app_cfg.h"
 #include "../room/room_rtos.h"
 // ==================== NAMING CONVENTIONS ====================
@@ -22,25 +33,39 @@
 
 
 // ==================== TASK HANDLES ====================
-TaskHandle_t tempSensorTaskHandle   = NULL;
-TaskHandle_t userInputTaskHandle    = NULL;
+TaskHandle_t sensorsTaskHandle      = NULL;
 TaskHandle_t fanControlTaskHandle   = NULL;
 TaskHandle_t mqttPublishTaskHandle  = NULL;
 TaskHandle_t wifiTaskHandle         = NULL;
 
+// Static task storage: stacks and TCBs live in .bss instead of the
+// heap, so task creation cannot fail at boot from fragmentation, and
+// every task is pinned (cores in thermostat_config.h - protocol on
+// core 0 with WiFi, control/sensor on core 1)
+#if SCHEDULER_ENABLED == STD_OFF
+// The sensor list runs as a scheduler job when the executor is enabled -
+// this stack only exists for the dedicated-task fallback
+static StaticTask_t sensorsTCB;
+static StackType_t  sensorsStack[SENSORS_STACK_SIZE];
+#endif
+static StaticTask_t fanControlTCB;
+static StackType_t  fanControlStack[FAN_CONTROL_STACK_SIZE];
+static StaticTask_t mqttTCB;
+static StackType_t  mqttStack[MQTT_STACK_SIZE];
+static StaticTask_t wifiTCB;
+static StackType_t  wifiStack[WIFI_STACK_SIZE];
+
 // ==================== GLOBAL VARIABLES ====================
 Thermostat_Status_t thermostat_values;
 
 // ==================== RTOS OBJECTS ====================
 EventGroupHandle_t thermostatEventGroup = NULL;
-QueueHandle_t mqttPublishQueue = NULL;
 SemaphoreHandle_t wifiConnectedSem = NULL;
 
 // ==================== DEBUG STATISTICS ====================
 #if DEBUG_ENABLED
 
-TaskDebugStats_t g_tempSensorStats = {0};
-TaskDebugStats_t g_userInputStats = {0};
+TaskDebugStats_t g_sensorsStats = {0};
 TaskDebugStats_t g_fanControlStats = {0};
 TaskDebugStats_t g_mqttStats = {0};
 TaskDebugStats_t g_wifiStats = {0};
@@ -64,8 +89,7 @@ void Debug_PrintStackUsage(const char* taskName, TaskHandle_t handle, TaskDebugS
 
 void Debug_PrintAllStackUsage(void) {
     Serial.println("\n========== STACK USAGE REPORT ==========");
-    Debug_PrintStackUsage("TempSensor", tempSensorTaskHandle, &g_tempSensorStats);
-    Debug_PrintStackUsage("UserInput", userInputTaskHandle, &g_userInputStats);
+    Debug_PrintStackUsage("Sensors", sensorsTaskHandle, &g_sensorsStats);
     Debug_PrintStackUsage("FanControl", fanControlTaskHandle, &g_fanControlStats);
     Debug_PrintStackUsage("MQTT", mqttPublishTaskHandle, &g_mqttStats);
     Debug_PrintStackUsage("WiFi", wifiTaskHandle, &g_wifiStats);
@@ -75,15 +99,192 @@ void Debug_PrintAllStackUsage(void) {
 
 #if DEBUG_QUEUE_STATUS
 void Debug_PrintQueueStatus(void) {
-    if (mqttPublishQueue != NULL) {
-        UBaseType_t messagesWaiting = uxQueueMessagesWaiting(mqttPublishQueue);
-        UBaseType_t spacesAvailable = uxQueueSpacesAvailable(mqttPublishQueue);
-        Serial.printf("[QUEUE] MQTT Queue: %u/%u messages\n", 
-                     messagesWaiting, messagesWaiting + spacesAvailable);
+    Serial.printf("[QUEUE] MQTT Ring: %u/%u messages (dropped: %u)\n",
+                 PubRing_Count(), PUB_RING_SIZE, PubRing_DroppedCount());
+}
+#endif
+
+// ==================== TASK PROFILER ====================
+#if DEBUG_TIMING
+// esp_timer-based per-task profiling: each loop wraps its work in
+// PROFILE_EXEC_BEGIN/END and its blocking call in PROFILE_WAIT, all in
+// microseconds. Counters have a single writer (the owning task); the
+// publisher only reads, so a rare torn 64-bit read costs one odd sample.
+
+static inline void Profile_RecordExec(TaskDebugStats_t* stats, int64_t startUs) {
+    int64_t elapsed = esp_timer_get_time() - startUs;
+    stats->totalExecUs += (uint64_t)elapsed;
+    if ((uint32_t)elapsed > stats->maxExecUs) {
+        stats->maxExecUs = (uint32_t)elapsed;
+#if BLACKBOX_ENABLED == STD_ON
+        // A new worst case is exactly the breadcrumb worth keeping
+        Blackbox_Record(stats->taskId, BB_EV_EXEC_SPIKE,
+                        (uint16_t)(elapsed / 1000));
+#endif
+    }
+}
+
+static inline void Profile_RecordWait(TaskDebugStats_t* stats, int64_t startUs) {
+    int64_t elapsed = esp_timer_get_time() - startUs;
+    stats->totalWaitUs += (uint64_t)elapsed;
+    if ((uint32_t)elapsed > stats->maxWaitUs) {
+        stats->maxWaitUs = (uint32_t)elapsed;
+    }
+}
+
+#define PROFILE_EXEC_BEGIN()      int64_t profStartUs = esp_timer_get_time()
+#define PROFILE_EXEC_END(stats)   Profile_RecordExec(stats, profStartUs)
+#define PROFILE_WAIT(stats, call)                       \
+    do {                                                \
+        int64_t profWaitUs = esp_timer_get_time();      \
+        call;                                           \
+        Profile_RecordWait(stats, profWaitUs);          \
+    } while (0)
+
+/**
+ * @brief Publish one task's profiler counters as a JSON document
+ *
+ * One message per task keeps each payload well under PubSubClient's
+ * default packet limit; Telegraf ingests them as separate points on
+ * the same measurement.
+ */
+static void Profile_PublishTask(const char* name, TaskHandle_t handle,
+                                TaskDebugStats_t* stats, uint64_t windowUs) {
+    char json[192];
+
+    uint64_t execDelta = stats->totalExecUs - stats->prevExecUs;
+    stats->prevExecUs = stats->totalExecUs;
+
+    // CPU share of the publish window, in tenths of a percent
+    uint32_t cpuPermille = 0;
+    if (windowUs > 0) {
+        cpuPermille = (uint32_t)((execDelta * 1000ULL) / windowUs);
+    }
+
+    UBaseType_t stackRemaining = 0;
+    if (handle != NULL) {
+        stackRemaining = uxTaskGetStackHighWaterMark(handle);
+    }
+
+    snprintf(json, sizeof(json),
+             "{\"task\":\"%s\",\"runs\":%lu,"
+             "\"exec_us\":%llu,\"max_exec_us\":%lu,"
+             "\"wait_us\":%llu,\"max_wait_us\":%lu,"
+             "\"cpu_pct\":%lu.%lu,\"stack_free\":%u}",
+             name,
+             (unsigned long)stats->taskRunCount,
+             (unsigned long long)stats->totalExecUs,
+             (unsigned long)stats->maxExecUs,
+             (unsigned long long)stats->totalWaitUs,
+             (unsigned long)stats->maxWaitUs,
+             (unsigned long)(cpuPermille / 10),
+             (unsigned long)(cpuPermille % 10),
+             (unsigned)(stackRemaining * sizeof(StackType_t)));
+
+    MQTT_Publish(MQTT_TOPIC_DIAG_TASKS, json);
+}
+
+/**
+ * @brief Periodic profiler publish - called from Task_Mqtt while connected
+ */
+static void Profile_PublishAll(void) {
+    static int64_t lastPublishUs = 0;
+
+    int64_t nowUs = esp_timer_get_time();
+    uint64_t windowUs = (uint64_t)(nowUs - lastPublishUs);
+    if (lastPublishUs != 0 && windowUs < (uint64_t)PROFILER_PUBLISH_MS * 1000ULL) {
+        return;
     }
+    lastPublishUs = nowUs;
+
+#if SCHEDULER_ENABLED == STD_OFF
+    // The sensor list runs as a scheduler job; the executor tracks its timing
+    Profile_PublishTask("Sensors",    sensorsTaskHandle,     &g_sensorsStats,    windowUs);
+#endif
+    Profile_PublishTask("FanControl", fanControlTaskHandle,  &g_fanControlStats, windowUs);
+    Profile_PublishTask("MQTT",       mqttPublishTaskHandle, &g_mqttStats,       windowUs);
+    Profile_PublishTask("WiFi",       wifiTaskHandle,        &g_wifiStats,       windowUs);
 }
+#else
+#define PROFILE_EXEC_BEGIN()
+#define PROFILE_EXEC_END(stats)
+#define PROFILE_WAIT(stats, call) call
 #endif
 
+// ==================== HEAP MONITOR ====================
+/**
+ * @brief Publish heap and message-pool health on the diagnostics topic
+ *
+ * Fragmentation shows up as largest_block shrinking while free stays
+ * flat - the signature of the slow allocation deaths we previously only
+ * discovered when a device stopped answering. Rate limited internally;
+ * called from Task_Mqtt while connected.
+ */
+static void Debug_PublishHeapStats(void) {
+    static uint32_t lastPublishMs = 0;
+
+    uint32_t now = millis();
+    if (lastPublishMs != 0 && now - lastPublishMs < HEAP_MONITOR_PUBLISH_MS) {
+        return;
+    }
+    lastPublishMs = now;
+
+    MsgPoolStats_t pool;
+    Room_RTOS_GetMsgPoolStats(&pool);
+
+    char json[192];
+    snprintf(json, sizeof(json),
+             "{\"free\":%u,\"min_free\":%u,\"largest_block\":%u,"
+             "\"pool_used\":%u,\"pool_high_water\":%u,\"pool_fail\":%lu}",
+             (unsigned)ESP.getFreeHeap(),
+             (unsigned)ESP.getMinFreeHeap(),
+             (unsigned)ESP.getMaxAllocHeap(),
+             (unsigned)pool.used,
+             (unsigned)pool.high_water,
+             (unsigned long)pool.alloc_fail);
+
+    MQTT_Publish(MQTT_TOPIC_DIAG_HEAP, json);
+}
+
+#if SENSOR_HISTORY_ENABLED == STD_ON
+// ==================== HISTORY AGGREGATES ====================
+/**
+ * @brief Publish per-metric min/max/mean/stddev digests
+ *
+ * One compact JSON document per metric (stays under the MQTT packet
+ * limit) covering the last SENSOR_HISTORY_SIZE raw samples - the
+ * full-resolution statistics the backend loses when report-by-exception
+ * suppresses raw publishes. Rate limited internally; called from
+ * Task_Mqtt while connected.
+ */
+static void History_PublishAggregates(void) {
+    static uint32_t lastPublishMs = 0;
+
+    uint32_t now = millis();
+    if (lastPublishMs != 0 && now - lastPublishMs < HISTORY_PUBLISH_MS) {
+        return;
+    }
+    lastPublishMs = now;
+
+    for (int m = 0; m < HISTORY_METRIC_COUNT; m++) {
+        HistoryStats_t stats;
+        if (!History_GetStats((HistoryMetric_t)m, &stats)) {
+            continue;  // Window still empty
+        }
+
+        char json[160];
+        snprintf(json, sizeof(json),
+                 "{\"m\":\"%s\",\"n\":%u,\"min\":%.2f,\"max\":%.2f,"
+                 "\"avg\":%.2f,\"sd\":%.2f}",
+                 History_MetricName((HistoryMetric_t)m),
+                 (unsigned)stats.count,
+                 stats.min, stats.max, stats.mean, stats.stddev);
+
+        MQTT_Publish(MQTT_TOPIC_AGGREGATE, json);
+    }
+}
+#endif /* SENSOR_HISTORY_ENABLED */
+
 void Debug_PrintSystemInfo(void) {
     Serial.println("\n========== SYSTEM INFORMATION ==========");
     Serial.printf("Free Heap: %u bytes\n", ESP.getFreeHeap());
@@ -123,14 +324,32 @@ void thermostatMqttFanSpeedEventSet(void) {
     }
 }
 
+void Thermostat_MqttKick(void) {
+    if (mqttPublishTaskHandle != NULL) {
+        xTaskNotifyGive(mqttPublishTaskHandle);
+    }
+}
+
 // ==================== INITIALIZATION ====================
 /**
  * @brief Initialize thermostat system and create all RTOS tasks
  * @note Call this once during system startup
  */
+// One poll body walks the compile-time sensor list - registered as a
+// scheduler job, or wrapped by Task_Sensors in the fallback build
+static void Job_SensorsPoll(void);
+
 void InitThermostat(void) {
     DEBUG_PRINT(TEMP_SENSOR, "=== Initializing Thermostat ===");
-    
+
+    #if DEBUG_TIMING && BLACKBOX_ENABLED == STD_ON
+    // Tag each stats struct so profiler breadcrumbs name their task
+    g_sensorsStats.taskId    = BB_TASK_SENSORS;
+    g_fanControlStats.taskId = BB_TASK_FAN_CONTROL;
+    g_mqttStats.taskId       = BB_TASK_MQTT;
+    g_wifiStats.taskId       = BB_TASK_WIFI;
+    #endif
+
     // Initialize hardware
     Thermostat_Init_Hardware();
     DEBUG_PRINT(TEMP_SENSOR, "✓ Hardware OK");
@@ -145,13 +364,12 @@ void InitThermostat(void) {
     // Init fan control mutex
     Thermostat_InitMutexes();
     
-    // Create MQTT publish queue
-    mqttPublishQueue = xQueueCreate(5, sizeof(mqtt_pub_msg_t));
-    if (mqttPublishQueue == NULL) {
-        Serial.println("[ERROR] MQTT queue failed!");
-        return;
-    }
-    DEBUG_PRINT(MQTT, "✓ Queue created");
+    // Init lock-free MQTT publish ring (replaces the old 5-entry queue)
+    PubRing_Init();
+    DEBUG_PRINT(MQTT, "✓ Publish ring ready (%d entries)", PUB_RING_SIZE);
+
+    // Init store-and-forward outage buffer
+    StoreForward_Init();
     
     // Create WiFi semaphore
     wifiConnectedSem = xSemaphoreCreateBinary();
@@ -161,321 +379,301 @@ void InitThermostat(void) {
     }
     DEBUG_PRINT(WIFI, "✓ Semaphore created");
     
-    // Create tasks
-    BaseType_t result;
-    
-    result = xTaskCreate(
-        Task_TemperatureSensor,
-        "TempSensor",
-        TEMP_SENSOR_STACK_SIZE,
-        NULL,
-        TEMP_SENSOR_PRIORITY,
-        &tempSensorTaskHandle
-    );
-    if (result != pdPASS) {
-        Serial.println("[ERROR] Failed to create TempSensor task!");
-        return;
+    // Create tasks - static storage, pinned cores
+#if SCHEDULER_ENABLED == STD_ON
+    // Every sensor is a tiny non-blocking poll against a cached value
+    // (DHT refresh task, ADC engine, MQ5 state machine) - the whole
+    // list shares the executor task instead of pinning dedicated
+    // stacks to sleep on
+    {
+#if CONFIG_CACHE_ENABLED == STD_ON
+        const uint32_t input_rate_ms = Config_Get()->input_sample_ms;
+#else
+        const uint32_t input_rate_ms = INPUT_SAMPLE_RATE_MS;
+#endif
+        Scheduler_AddJob("sensors", input_rate_ms, Job_SensorsPoll);
+        DEBUG_PRINT(TEMP_SENSOR, "Sensor list registered as one scheduler job");
     }
-    DEBUG_PRINT(TEMP_SENSOR, "Task created (Stack: %d, Priority: %d)", 
-                TEMP_SENSOR_STACK_SIZE, TEMP_SENSOR_PRIORITY);
-    
-    result = xTaskCreate(
-        Task_UserInput,
-        "UserInput",
-        USER_INPUT_STACK_SIZE,
+#else
+    sensorsTaskHandle = xTaskCreateStaticPinnedToCore(
+        Task_Sensors,
+        "Sensors",
+        SENSORS_STACK_SIZE,
         NULL,
-        USER_INPUT_PRIORITY,
-        &userInputTaskHandle
+        SENSORS_PRIORITY,
+        sensorsStack,
+        &sensorsTCB,
+        SENSORS_CORE
     );
-    if (result != pdPASS) {
-        Serial.println("[ERROR] Failed to create UserInput task!");
+    if (sensorsTaskHandle == NULL) {
+        Serial.println("[ERROR] Failed to create Sensors task!");
         return;
     }
-    DEBUG_PRINT(USER_INPUT, "Task created (Stack: %d, Priority: %d)", 
-                USER_INPUT_STACK_SIZE, USER_INPUT_PRIORITY);
-    
-    result = xTaskCreate(
+    DEBUG_PRINT(TEMP_SENSOR, "Task created (Stack: %d, Priority: %d, Core: %d)",
+                SENSORS_STACK_SIZE, SENSORS_PRIORITY, SENSORS_CORE);
+#endif
+
+    fanControlTaskHandle = xTaskCreateStaticPinnedToCore(
         Task_FanControl,
         "FanControl",
         FAN_CONTROL_STACK_SIZE,
         NULL,
         FAN_CONTROL_PRIORITY,
-        &fanControlTaskHandle
+        fanControlStack,
+        &fanControlTCB,
+        FAN_CONTROL_CORE
     );
-    if (result != pdPASS) {
+    if (fanControlTaskHandle == NULL) {
         Serial.println("[ERROR] Failed to create FanControl task!");
         return;
     }
-    DEBUG_PRINT(FAN_CONTROL, "Task created (Stack: %d, Priority: %d)", 
-                FAN_CONTROL_STACK_SIZE, FAN_CONTROL_PRIORITY);
-    
-    result = xTaskCreate(
+    DEBUG_PRINT(FAN_CONTROL, "Task created (Stack: %d, Priority: %d, Core: %d)",
+                FAN_CONTROL_STACK_SIZE, FAN_CONTROL_PRIORITY, FAN_CONTROL_CORE);
+
+    mqttPublishTaskHandle = xTaskCreateStaticPinnedToCore(
         Task_Mqtt,
         "MqttPublish",
         MQTT_STACK_SIZE,
         NULL,
         MQTT_PRIORITY,
-        &mqttPublishTaskHandle
+        mqttStack,
+        &mqttTCB,
+        MQTT_CORE
     );
-    if (result != pdPASS) {
+    if (mqttPublishTaskHandle == NULL) {
         Serial.println("[ERROR] Failed to create MQTT task!");
         return;
     }
-    DEBUG_PRINT(MQTT, "Task created (Stack: %d, Priority: %d)", 
-                MQTT_STACK_SIZE, MQTT_PRIORITY);
-    
-    result = xTaskCreate(
+    DEBUG_PRINT(MQTT, "Task created (Stack: %d, Priority: %d, Core: %d)",
+                MQTT_STACK_SIZE, MQTT_PRIORITY, MQTT_CORE);
+
+    wifiTaskHandle = xTaskCreateStaticPinnedToCore(
         Task_Wifi,
         "Wifi_Task",
         WIFI_STACK_SIZE,
         NULL,
         WIFI_PRIORITY,
-        &wifiTaskHandle
+        wifiStack,
+        &wifiTCB,
+        WIFI_CORE
     );
-    if (result != pdPASS) {
+    if (wifiTaskHandle == NULL) {
         Serial.println("[ERROR] Failed to create WiFi task!");
         return;
     }
-    DEBUG_PRINT(WIFI, "Task created (Stack: %d, Priority: %d)", 
-                WIFI_STACK_SIZE, WIFI_PRIORITY);
-    
+    DEBUG_PRINT(WIFI, "Task created (Stack: %d, Priority: %d, Core: %d)",
+                WIFI_STACK_SIZE, WIFI_PRIORITY, WIFI_CORE);
+
     Serial.println("[INIT] ✓ All tasks ready\n");
 }
 
 // ==================== TASKS ====================
 
-/**
- * @brief Task: Read temperature sensor periodically
- * @param pvParameters Unused
- */
-void Task_TemperatureSensor(void* pvParameters) {
 
-    (void)pvParameters;
+// ==================== COMPILE-TIME SENSOR LIST ====================
+// The whole thermostat sensor set as sensor_framework.h adopters:
+// acquisition, warm-up gating, filtering and report-by-exception all
+// resolve statically, and the hooks below are all that is
+// sensor-specific. Every sample() reads a cached/non-blocking source
+// (DHT refresh task, ADC engine, MQ5 state machine), so one wake per
+// period services all channels in lock-step. A new sensor (CO2,
+// occupancy) is one more struct plus a type-list entry.
 
-    float temperature     = INVALID_TEMP_VALUE;
-    float humidity        = INVALID_HUMDITY_VALUE;   ///ReadHumiditySensor
-    float last_temp       = INVALID_TEMP_VALUE;
-    float last_humidity   = INVALID_HUMDITY_VALUE;
+struct TempSensor : sensorh::Sensor<TempSensor> {
+    static const char* name() { return "temp"; }
+    // Lock-free read of the hal_dht background cache - the refresh
+    // task owns the 5 ms bit-banged sensor transaction
+    static float sample() { return ReadTemperatureSensor(); }
+    static const ReportPolicy_t& policy() {
+#if CONFIG_CACHE_ENABLED == STD_ON
+        static const ReportPolicy_t p =
+            { Config_Get()->temp_deadband, REPORT_TEMP_MIN_MS, REPORT_TEMP_HEARTBEAT_MS };
+#else
+        static const ReportPolicy_t p =
+            { REPORT_TEMP_DEADBAND, REPORT_TEMP_MIN_MS, REPORT_TEMP_HEARTBEAT_MS };
+#endif
+        return p;
+    }
+    static void onSample(float temperature) {
+        DEBUG_PRINT(TEMP_SENSOR, "[%u] Temp=%.2f°C",
+                    g_sensorsStats.taskRunCount, temperature);
+#if SENSOR_HISTORY_ENABLED == STD_ON
+        // Every raw sample feeds the history window, published or not
+        History_Add(HISTORY_TEMP, temperature);
+#endif
+    }
+    static void onReport(float temperature) {
+        Thermostat_StoreTemp(temperature);
 
-    mqtt_pub_msg_t msg;
-    
-    #if DEBUG_TIMING
-    uint32_t startTime = 0;
-    uint32_t executionTime = 0;
-    #endif
-    
-    DEBUG_PRINT(TEMP_SENSOR, "Started");
-    vTaskDelay(pdMS_TO_TICKS(1000));
-    
-    while (1) {
-        #if DEBUG_TIMING
-        startTime = millis();
-        #endif
-        
-        #if DEBUG_ENABLED
-        g_tempSensorStats.taskRunCount++;
-        g_tempSensorStats.lastRunTime = millis();
-        #endif
-        
-        // Read sensor (simulated with random for testing)
-        temperature = ReadTemperatureSensor(); // Random 15-35°C
-        humidity    = ReadHumiditySensor   ();
-        
-        DEBUG_PRINT(TEMP_SENSOR, "[%u] Temp=%.2f°C", g_tempSensorStats.taskRunCount, temperature);
-        
-        // Check if temperature changed significantly
-        if (fabs(temperature - last_temp) >= TARGET_TEMP_THRESHOLD) {
-            Thermostat_StoreTemp(temperature);
-            last_temp = temperature;
-            
-            // Prepare MQTT message
-            msg.type  = MQTT_PUB_TEMP;
-            msg.value = temperature;
-            
-            // Send to queue
-            if (xQueueSend(mqttPublishQueue, &msg, pdMS_TO_TICKS(100)) == pdPASS) {
-                DEBUG_PRINT(TEMP_SENSOR, "→ MQTT Queue");
-            } else {
-                DEBUG_PRINT(TEMP_SENSOR, "✗ Queue FULL");
-            }
-            
-            // Signal fan control
-            xEventGroupSetBits(thermostatEventGroup, TEMP_UPDATED_BIT);
-        }
+        mqtt_pub_msg_t msg;
+        msg.type  = MQTT_PUB_TEMP;
+        msg.value = temperature;
+        PubRing_Push(&msg);  // Never blocks
+        DEBUG_PRINT(TEMP_SENSOR, "→ MQTT Ring");
 
-        if (fabs(humidity - last_humidity) >= TARGET_TEMP_THRESHOLD) {
-            Thermostat_StoreTemp(temperature);
-            last_humidity = humidity;
-            
-            // Prepare MQTT message
-            msg.type = MQTT_PUB_HUM;
-            msg.value = humidity;
-            
-            // Send to queue
-            if (xQueueSend(mqttPublishQueue, &msg, pdMS_TO_TICKS(100)) == pdPASS) {
-                DEBUG_PRINT(HUM_SENSOR, "→ MQTT Queue");
-            } else {
-                DEBUG_PRINT(HUM_SENSOR, "✗ Queue FULL");
-            }
-            
-        }    
-        #if DEBUG_STACK_MONITOR
-        static uint32_t lastStackCheck = 0;
-        if (millis() - lastStackCheck > STACK_MONITOR_INTERVAL_MS) {
-            Debug_PrintStackUsage("TempSensor", tempSensorTaskHandle, &g_tempSensorStats);
-            lastStackCheck = millis();
-        }
-        #endif
-        
-        vTaskDelay(pdMS_TO_TICKS(TEMP_SENSOR_SAMPLE_RATE_MS));
+        // Signal fan control
+        xEventGroupSetBits(thermostatEventGroup, TEMP_UPDATED_BIT);
     }
-}
+};
 
+struct HumSensor : sensorh::Sensor<HumSensor> {
+    static const char* name() { return "hum"; }
+    static float sample() { return ReadHumiditySensor(); }
+    static const ReportPolicy_t& policy() {
+#if CONFIG_CACHE_ENABLED == STD_ON
+        static const ReportPolicy_t p =
+            { Config_Get()->hum_deadband, REPORT_HUM_MIN_MS, REPORT_HUM_HEARTBEAT_MS };
+#else
+        static const ReportPolicy_t p =
+            { REPORT_HUM_DEADBAND, REPORT_HUM_MIN_MS, REPORT_HUM_HEARTBEAT_MS };
+#endif
+        return p;
+    }
+    static void onSample(float humidity) {
+#if SENSOR_HISTORY_ENABLED == STD_ON
+        History_Add(HISTORY_HUMIDITY, humidity);
+#else
+        (void)humidity;
+#endif
+    }
+    static void onReport(float humidity) {
+        mqtt_pub_msg_t msg;
+        msg.type  = MQTT_PUB_HUM;
+        msg.value = humidity;
+        PubRing_Push(&msg);  // Never blocks
+        DEBUG_PRINT(HUM_SENSOR, "→ MQTT Ring");
+    }
+};
 
+struct PotSensor : sensorh::Sensor<PotSensor> {
+    static const char* name() { return "pot"; }
+    static float sample() {
+        POT_main();
+        return (float)POT_value_Getter();
+    }
+    static float convert(float raw) { return mapPotToTemp((uint16_t)raw); }
+    static const ReportPolicy_t& policy() {
+        // Deadband only - the knob has no heartbeat, silence just
+        // means nobody touched it
+        static const ReportPolicy_t p =
+            { TARGET_TEMP_THRESHOLD, 0, 0xFFFFFFFFu };
+        return p;
+    }
+    static void onSample(float target_temp) {
+        DEBUG_PRINT(USER_INPUT, "[%u] Pot → %.1f°C",
+                    g_sensorsStats.taskRunCount, target_temp);
+    }
+    static void onReport(float target_temp) {
+        Thermostat_SetTargetTemp(target_temp);
 
+        mqtt_pub_msg_t msg;
+        msg.type = MQTT_PUB_TARGET;
+        msg.value = target_temp;
+        PubRing_Push(&msg);  // Never blocks
+        DEBUG_PRINT(USER_INPUT, "→ MQTT Ring");
 
+        // Signal fan control
+        xEventGroupSetBits(thermostatEventGroup, TARGET_UPDATED_BIT);
+    }
+};
 
-/**
- * @brief Task: Read user input (potentiometer) for target temperature
- * @param pvParameters Unused
- */
-void Task_GasSensor(void* pvParameters) {
-    (void)pvParameters;
-    
-    float gas_value = 0;
-    float last_gas_value = INVALID_TEMP_VALUE;
-    mqtt_pub_msg_t msg;
-    
-    #if DEBUG_TIMING
-    uint32_t startTime = 0;
-    uint32_t executionTime = 0;
-    #endif
-    
-    DEBUG_PRINT(USER_INPUT, "Started");
-    vTaskDelay(pdMS_TO_TICKS(1500));
-    
-    while (1) {
-        #if DEBUG_TIMING
-        startTime = millis();
-        #endif
-        
-        #if DEBUG_ENABLED
-        g_userInputStats.taskRunCount++;
-        g_userInputStats.lastRunTime = millis();
-        #endif
-        
-        // Read potentiometer
+struct GasSensor : sensorh::Sensor<GasSensor> {
+    static const char* name() { return "gas"; }
+    static bool ready() {
         MQ5_1_main();
-        gas_value = MQ5_1_value();
-        
-        
-        // Check if target changed significantly
-        if (fabs(gas_value - last_gas_value) >= TARGET_TEMP_THRESHOLD) {
-            last_gas_value = gas_value;
-            
-            // Prepare MQTT message
-            msg.type = MQTT_PUB_TARGET;
-            msg.value = gas_value;
-            
-            // Send to queue
-            if (xQueueSend(mqttPublishQueue, &msg, pdMS_TO_TICKS(100)) == pdPASS) {
-                DEBUG_PRINT(USER_INPUT, "→ MQTT Queue");
-            } else {
-                DEBUG_PRINT(USER_INPUT, "✗ Queue FULL");
-            }
-            
-            // Signal fan control
-            xEventGroupSetBits(thermostatEventGroup, TARGET_UPDATED_BIT);
-        }
-        
-
-        
-        #if DEBUG_STACK_MONITOR
-        static uint32_t lastStackCheck = 0;
-        if (millis() - lastStackCheck > STACK_MONITOR_INTERVAL_MS) {
-            Debug_PrintStackUsage("UserInput", userInputTaskHandle, &g_userInputStats);
-            lastStackCheck = millis();
-        }
-        #endif
-        
-        vTaskDelay(pdMS_TO_TICKS(INPUT_SAMPLE_RATE_MS));
+        // Heater warming / baseline calibrating - readings are junk.
+        // Holding publishes here is what kills the boot-time storm
+        // the fleet showed after every power event.
+        return MQ5_1_ready();
     }
-}
+    static float sample() { return MQ5_1_value(); }
+    static const ReportPolicy_t& policy() {
+#if CONFIG_CACHE_ENABLED == STD_ON
+        static const ReportPolicy_t p =
+            { Config_Get()->gas_deadband, REPORT_GAS_MIN_MS, REPORT_GAS_HEARTBEAT_MS };
+#else
+        static const ReportPolicy_t p =
+            { REPORT_GAS_DEADBAND, REPORT_GAS_MIN_MS, REPORT_GAS_HEARTBEAT_MS };
+#endif
+        return p;
+    }
+    static void onSample(float v) {
+#if SENSOR_HISTORY_ENABLED == STD_ON
+        History_Add(HISTORY_GAS, v);
+#else
+        (void)v;
+#endif
+    }
+    static void onReport(float v) {
+        mqtt_pub_msg_t msg;
+        msg.type = MQTT_PUB_TARGET;
+        msg.value = v;
+        PubRing_Push(&msg);  // Never blocks
+        DEBUG_PRINT(USER_INPUT, "→ MQTT Ring");
 
+        // Signal fan control
+        xEventGroupSetBits(thermostatEventGroup, TARGET_UPDATED_BIT);
+    }
+};
 
+// The whole set one poll walks; extend here, not with new plumbing
+using ThermostatSensors = sensorh::SensorList<TempSensor, HumSensor,
+                                              PotSensor, GasSensor>;
 
+static void Job_SensorsPoll(void)
+{
+    INSTR_SCOPE("thermostat.sensors");
+    #if DEBUG_ENABLED
+    g_sensorsStats.taskRunCount++;
+    g_sensorsStats.lastRunTime = millis();
+    #endif
 
+    ThermostatSensors::pollAll(millis());
+}
 
+#if SCHEDULER_ENABLED == STD_OFF
 /**
- * @brief Task: Read user input (potentiometer) for target temperature
- * @param pvParameters Unused
+ * @brief Task: Consolidated sensor polling (fallback build)
+ *
+ * One wake per sample period services the whole compile-time list -
+ * replaces the three near-identical temp/input/gas tasks and their
+ * stacks, and locks the sample phases to a single cadence instead of
+ * letting them drift across independent delays.
  */
-void Task_UserInput(void* pvParameters) {
+void Task_Sensors(void* pvParameters) {
     (void)pvParameters;
-    
-    int pot_value = 0;
-    float target_temp = INVALID_TEMP_VALUE;
-    float last_target_temp = INVALID_TEMP_VALUE;
-    mqtt_pub_msg_t msg;
-    
-    #if DEBUG_TIMING
-    uint32_t startTime = 0;
-    uint32_t executionTime = 0;
+
+#if CONFIG_CACHE_ENABLED == STD_ON
+    const uint32_t sample_rate_ms = Config_Get()->input_sample_ms;
+#else
+    const uint32_t sample_rate_ms = INPUT_SAMPLE_RATE_MS;
+#endif
+
+    DEBUG_PRINT(TEMP_SENSOR, "Started");
+    #if BLACKBOX_ENABLED == STD_ON
+    Blackbox_Record(BB_TASK_SENSORS, BB_EV_TASK_START, 0);
     #endif
-    
-    DEBUG_PRINT(USER_INPUT, "Started");
-    vTaskDelay(pdMS_TO_TICKS(1500));
-    
+    vTaskDelay(pdMS_TO_TICKS(BOOT_SENSOR_SETTLE_MS));
+
     while (1) {
-        #if DEBUG_TIMING
-        startTime = millis();
-        #endif
-        
-        #if DEBUG_ENABLED
-        g_userInputStats.taskRunCount++;
-        g_userInputStats.lastRunTime = millis();
-        #endif
-        
-        // Read potentiometer
-        POT_main();
-        pot_value = POT_value_Getter();
-        target_temp = mapPotToTemp(pot_value);
-        
-        DEBUG_PRINT(USER_INPUT, "[%u] ADC=%d → %.1f°C", g_userInputStats.taskRunCount, pot_value, target_temp);
-        
-        // Check if target changed significantly
-        if (fabs(target_temp - last_target_temp) >= TARGET_TEMP_THRESHOLD) {
-            Thermostat_SetTargetTemp(target_temp);
-            last_target_temp = target_temp;
-            
-            // Prepare MQTT message
-            msg.type = MQTT_PUB_TARGET;
-            msg.value = target_temp;
-            
-            // Send to queue
-            if (xQueueSend(mqttPublishQueue, &msg, pdMS_TO_TICKS(100)) == pdPASS) {
-                DEBUG_PRINT(USER_INPUT, "→ MQTT Queue");
-            } else {
-                DEBUG_PRINT(USER_INPUT, "✗ Queue FULL");
-            }
-            
-            // Signal fan control
-            xEventGroupSetBits(thermostatEventGroup, TARGET_UPDATED_BIT);
-        }
-        
+        PROFILE_EXEC_BEGIN();
+
+        Job_SensorsPoll();
 
-        
         #if DEBUG_STACK_MONITOR
         static uint32_t lastStackCheck = 0;
         if (millis() - lastStackCheck > STACK_MONITOR_INTERVAL_MS) {
-            Debug_PrintStackUsage("UserInput", userInputTaskHandle, &g_userInputStats);
+            Debug_PrintStackUsage("Sensors", sensorsTaskHandle, &g_sensorsStats);
             lastStackCheck = millis();
         }
         #endif
-        
-        vTaskDelay(pdMS_TO_TICKS(INPUT_SAMPLE_RATE_MS));
+
+        PROFILE_EXEC_END(&g_sensorsStats);
+        PROFILE_WAIT(&g_sensorsStats,
+                     vTaskDelay(pdMS_TO_TICKS(sample_rate_ms)));
     }
 }
+#endif /* SCHEDULER_ENABLED == STD_OFF */
 
 /**
  * @brief Task: Control fan based on temperature difference
@@ -493,6 +691,9 @@ void Task_FanControl(void* pvParameters) {
     Fan_Speed_t manual_fan_speed = FAN_SPEED_OFF;
     
     DEBUG_PRINT(FAN_CONTROL, "Started");
+    #if BLACKBOX_ENABLED == STD_ON
+    Blackbox_Record(BB_TASK_FAN_CONTROL, BB_EV_TASK_START, 0);
+    #endif
     
     while (1) {
         #if DEBUG_ENABLED
@@ -501,15 +702,19 @@ void Task_FanControl(void* pvParameters) {
         #endif
         
         // Wait for any relevant event
-        EventBits_t bits = xEventGroupWaitBits(
-            thermostatEventGroup,
-            TEMP_UPDATED_BIT | TARGET_UPDATED_BIT | TARGET_FROM_MQTT_BIT | 
-            MODE_UPDATED_BIT | FAN_SPEED_UPDATED_BIT,
-            pdTRUE,    // Clear bits after reading
-            pdFALSE,   // Wait for ANY bit (not all)
-            portMAX_DELAY
-        );
-        
+        EventBits_t bits;
+        PROFILE_WAIT(&g_fanControlStats,
+            bits = xEventGroupWaitBits(
+                thermostatEventGroup,
+                TEMP_UPDATED_BIT | TARGET_UPDATED_BIT | TARGET_FROM_MQTT_BIT |
+                MODE_UPDATED_BIT | FAN_SPEED_UPDATED_BIT,
+                pdTRUE,    // Clear bits after reading
+                pdFALSE,   // Wait for ANY bit (not all)
+                portMAX_DELAY
+            ));
+
+        PROFILE_EXEC_BEGIN();
+
         // Process temperature update
         if (bits & TEMP_UPDATED_BIT) {
             current_temp = Thermostat_GetTemp();
@@ -538,6 +743,11 @@ void Task_FanControl(void* pvParameters) {
                                    (current_mode == THERMOSTAT_MODE_AUTO) ? "AUTO" :
                                    (current_mode == THERMOSTAT_MODE_MANUAL) ? "MANUAL" : "UNKNOWN";
             DEBUG_PRINT(FAN_CONTROL, "Mode: %s", mode_str);
+            #if FAN_PID_ENABLED
+            // Controller state from the previous mode is meaningless
+            // in the new one - start the PWM from rest
+            Fan_PID_Reset();
+            #endif
         }
         
         // Process manual fan speed update (from MQTT)
@@ -555,18 +765,28 @@ void Task_FanControl(void* pvParameters) {
         
         switch (current_mode) {
             case THERMOSTAT_MODE_OFF:
-                // Turn off fan
-                DEBUG_PRINT(FAN_CONTROL, "[%u] Mode=OFF → Fan OFF", g_fanControlStats.taskRunCount);
-                Thermostat_SetFanSpeed(FAN_SPEED_OFF);
+                // Actuation layer makes this idempotent - the PWM and
+                // status only see the actual OFF transition, not every
+                // event-group wake while the mode stays OFF
+                if (Fan_Actuate(FAN_SPEED_OFF, true)) {
+                    DEBUG_PRINT(FAN_CONTROL, "[%u] Mode=OFF → Fan OFF", g_fanControlStats.taskRunCount);
+                    #if FAN_PID_ENABLED
+                    Fan_PID_Reset();  // Duty to zero, integrator cleared
+                    #endif
+                }
                 break;
             
             case THERMOSTAT_MODE_AUTO:
                 // Run automatic logic based on temperature difference
                 if (temp_valid && target_valid) {
                     float diff = target_temp - current_temp;
-                    DEBUG_PRINT(FAN_CONTROL, "[%u] Mode=AUTO, Δ=%.2f°C → Auto Logic", 
+                    DEBUG_PRINT(FAN_CONTROL, "[%u] Mode=AUTO, Δ=%.2f°C → Auto Logic",
                                g_fanControlStats.taskRunCount, diff);
+                    #if FAN_PID_ENABLED
+                    Fan_PID_Logic(target_temp, current_temp);
+                    #else
                     Fan_Logic(target_temp, current_temp);
+                    #endif
                 } else {
                     DEBUG_PRINT(FAN_CONTROL, "[%u] Mode=AUTO but missing data (temp=%d, target=%d)",
                                g_fanControlStats.taskRunCount, temp_valid, target_valid);
@@ -593,6 +813,8 @@ void Task_FanControl(void* pvParameters) {
             lastStackCheck = millis();
         }
         #endif
+
+        PROFILE_EXEC_END(&g_fanControlStats);
     }
 }
 
@@ -602,19 +824,28 @@ void Task_FanControl(void* pvParameters) {
  */
 void Task_Mqtt(void *pvParameters) {
     mqtt_pub_msg_t msg;
-    char payload[16];
-    
+    char payload[128];
+
+    // Latest value per reading type, collected while draining the queue
+    float batch_values[MQTT_PUB_TYPE_COUNT];
+    bool  batch_pending[MQTT_PUB_TYPE_COUNT];
+
     DEBUG_PRINT(MQTT, "Started - Waiting WiFi");
+    #if BLACKBOX_ENABLED == STD_ON
+    Blackbox_Record(BB_TASK_MQTT, BB_EV_TASK_START, 0);
+    #endif
     
     xSemaphoreTake(wifiConnectedSem, portMAX_DELAY);
     DEBUG_PRINT(MQTT, "✓ WiFi ready");
     
     for (;;) {
+        PROFILE_EXEC_BEGIN();
+
         #if DEBUG_ENABLED
         g_mqttStats.taskRunCount++;
         g_mqttStats.lastRunTime = millis();
         #endif
-        
+
         if (WIFI_IsConnected() && mqttInitialized) {
             // Keep alive
             MQTT_Loop();
@@ -628,34 +859,133 @@ void Task_Mqtt(void *pvParameters) {
 
             Room_RTOS_MQTTWarrper();
 
-            // Check queue
-            if (xQueueReceive(mqttPublishQueue, &msg, pdMS_TO_TICKS(200)) == pdTRUE) {
-                switch (msg.type) {
-                    case MQTT_PUB_TEMP:
-                        snprintf(payload, sizeof(payload), "%.2f", msg.value);
-                        MQTT_Publish(MQTT_TOPIC_TEMP, payload);
-                        DEBUG_PRINT(MQTT, "Pub: temp=%s", payload);
-                        break;
-                    
-                    case MQTT_PUB_TARGET:
-                        snprintf(payload, sizeof(payload), "%.1f", msg.value);
-                        MQTT_Publish(MQTT_TOPIC_TARGET, payload);
-                        DEBUG_PRINT(MQTT, "Pub: target=%s", payload);
-                        break;
-
-                    case MQTT_PUB_HUM:
-                        snprintf(payload, sizeof(payload), "%.1f", msg.value);
-                        MQTT_Publish(MQTT_TOPIC_HUMIDITY, payload);
-                        DEBUG_PRINT(MQTT, "Pub: humidity=%s", payload);
-                        break;
-
-                    default:
+            static bool sf_diverting = false;
+            if (!MQTT_IsConnected()) {
+                // Broker down but WiFi up - divert telemetry into the
+                // store-and-forward buffer so nothing is lost
+                while (PubRing_Pop(&msg)) {
+                    StoreForward_Store(&msg);
+                }
+                #if BLACKBOX_ENABLED == STD_ON
+                if (!sf_diverting) {
+                    Blackbox_Record(BB_TASK_MQTT, BB_EV_SF_DIVERT,
+                                    (uint16_t)StoreForward_Count());
+                }
+                #endif
+                sf_diverting = true;
+                PROFILE_EXEC_END(&g_mqttStats);
+                PROFILE_WAIT(&g_mqttStats,
+                    ulTaskNotifyTake(pdTRUE, pdMS_TO_TICKS(MQTT_IDLE_SERVICE_MS)));
+                continue;
+            }
+
+            // Back online - replay anything buffered during the outage
+            if (StoreForward_Count() > 0) {
+                DEBUG_PRINT(MQTT, "Replaying %u stored records", StoreForward_Count());
+                StoreForward_Replay();
+            }
+
+            // Drain the whole queue and coalesce readings into one publish.
+            // Keeping only the latest value per type means a temp+humidity
+            // update costs a single broker round trip instead of one each.
+            memset(batch_pending, 0, sizeof(batch_pending));
+
+            if (PubRing_Pop(&msg)) {
+                do {
+                    if (msg.type < MQTT_PUB_TYPE_COUNT) {
+                        batch_values[msg.type]  = msg.value;
+                        batch_pending[msg.type] = true;
+                    } else {
                         DEBUG_PRINT(MQTT, "✗ Unknown type=%d", msg.type);
-                        break;
+                    }
+                } while (PubRing_Pop(&msg));
+
+                // Build single JSON payload from whatever is pending
+                size_t len = 0;
+                len += snprintf(payload + len, sizeof(payload) - len, "{");
+
+                if (batch_pending[MQTT_PUB_TEMP]) {
+                    len += snprintf(payload + len, sizeof(payload) - len,
+                                    "\"temperature\":%.2f,", batch_values[MQTT_PUB_TEMP]);
+                }
+                if (batch_pending[MQTT_PUB_TARGET]) {
+                    len += snprintf(payload + len, sizeof(payload) - len,
+                                    "\"target_temp\":%.1f,", batch_values[MQTT_PUB_TARGET]);
+                }
+                if (batch_pending[MQTT_PUB_HUM]) {
+                    len += snprintf(payload + len, sizeof(payload) - len,
+                                    "\"humidity\":%.1f,", batch_values[MQTT_PUB_HUM]);
                 }
+                if (batch_pending[MQTT_PUB_FAN]) {
+                    len += snprintf(payload + len, sizeof(payload) - len,
+                                    "\"fan_speed\":%.0f,", batch_values[MQTT_PUB_FAN]);
+                }
+
+                // Replace trailing comma with closing brace
+                if (len > 1 && payload[len - 1] == ',') {
+                    payload[len - 1] = '}';
+                } else {
+                    len += snprintf(payload + len, sizeof(payload) - len, "}");
+                }
+
+                MQTT_Publish(MQTT_TOPIC_TELEMETRY, payload);
+                DEBUG_PRINT(MQTT, "Pub batch: %s", payload);
+
+#if MQTT_BINARY_TELEMETRY == STD_ON
+                // Parallel packed publish: one fixed-point record per
+                // pending field, concatenated into a single message.
+                // 12 bytes per reading vs ~30+ of JSON, and the backend
+                // memcpy's instead of parsing floats.
+                mqtt_bin_record_t records[MQTT_PUB_TYPE_COUNT];
+                size_t rec_count = 0;
+                uint32_t now_ms = millis();
+
+                for (int t = 0; t < MQTT_PUB_TYPE_COUNT; t++) {
+                    if (!batch_pending[t]) {
+                        continue;
+                    }
+                    records[rec_count].version      = TELEMETRY_BIN_VERSION;
+                    records[rec_count].device_id    = TELEMETRY_DEVICE_ID;
+                    records[rec_count].field        = (uint8_t)t;
+                    records[rec_count].value_x100   = (int32_t)lroundf(batch_values[t] * 100.0f);
+                    records[rec_count].timestamp_ms = now_ms;
+                    rec_count++;
+                }
+
+                MQTT_PublishBinary(MQTT_TOPIC_TELEMETRY_BIN,
+                                   (const uint8_t*)records,
+                                   rec_count * sizeof(mqtt_bin_record_t));
+#endif
             }
+
+            sf_diverting = false;
+
+            #if DEBUG_TIMING
+            // Profiler surface for Telegraf - rate limited internally
+            Profile_PublishAll();
+            #endif
+
+            Debug_PublishHeapStats();
+
+            // Retained liveness heartbeat - rate limited internally
+            MQTT_PresenceService();
+
+            #if SENSOR_HISTORY_ENABLED == STD_ON
+            // Per-metric statistics digest - rate limited internally
+            History_PublishAggregates();
+            #endif
+
+            #if BLACKBOX_ENABLED == STD_ON
+            // One-shot postmortem from the previous boot
+            Blackbox_PublishBootReport();
+            #endif
+
+            #if BOOT_BENCH_ENABLED == STD_ON
+            // One-shot hot-path timings from this boot
+            BootBench_PublishReport();
+            #endif
         }
-        
+
         #if DEBUG_STACK_MONITOR
         static uint32_t lastStackCheck = 0;
         if (millis() - lastStackCheck > STACK_MONITOR_INTERVAL_MS) {
@@ -664,8 +994,13 @@ void Task_Mqtt(void *pvParameters) {
             lastStackCheck = millis();
         }
         #endif
-        
-        vTaskDelay(pdMS_TO_TICKS(200));
+
+        PROFILE_EXEC_END(&g_mqttStats);
+        // Sleep until a producer kicks us (Thermostat_MqttKick) or the
+        // keepalive cadence expires - the long blocked stretch is what
+        // lets the power manager drop into light sleep
+        PROFILE_WAIT(&g_mqttStats,
+            ulTaskNotifyTake(pdTRUE, pdMS_TO_TICKS(MQTT_IDLE_SERVICE_MS)));
     }
 }
 
@@ -677,18 +1012,26 @@ void Task_Wifi(void *pvParameters) {
     static bool wasConnected = false;
     
     DEBUG_PRINT(WIFI, "Started");
+    #if BLACKBOX_ENABLED == STD_ON
+    Blackbox_Record(BB_TASK_WIFI, BB_EV_TASK_START, 0);
+    #endif
     
     for (;;) {
+        PROFILE_EXEC_BEGIN();
+
         #if DEBUG_ENABLED
         g_wifiStats.taskRunCount++;
         g_wifiStats.lastRunTime = millis();
         #endif
-        
+
         bool connected = WIFI_IsConnected();
         
         if (connected) {
             if (!wasConnected) {
                 DEBUG_PRINT(WIFI, "✓ Connected");
+                #if BLACKBOX_ENABLED == STD_ON
+                Blackbox_Record(BB_TASK_WIFI, BB_EV_WIFI_UP, 0);
+                #endif
                 
                 if (mqttPublishTaskHandle != NULL) {
                     xSemaphoreGive(wifiConnectedSem);
@@ -699,14 +1042,29 @@ void Task_Wifi(void *pvParameters) {
         } else {
             if (wasConnected) {
                 DEBUG_PRINT(WIFI, "✗ Disconnected");
+                #if BLACKBOX_ENABLED == STD_ON
+                Blackbox_Record(BB_TASK_WIFI, BB_EV_WIFI_DOWN, 0);
+                #endif
                 
                 if (mqttPublishTaskHandle != NULL) {
                     vTaskSuspend(mqttPublishTaskHandle);
                 }
                 wasConnected = false;
             }
+
+            // Task_Mqtt is suspended for the whole outage, so its
+            // broker-down divert never runs here. Drain the ring into
+            // the RTC-backed store-forward buffer each pass instead:
+            // the replay keeps the full sample history, where the
+            // batch drain on resume would coalesce it to the latest
+            // value per type. Safe to pop from this task - the only
+            // other consumer is the task we just suspended.
+            mqtt_pub_msg_t sf_msg;
+            while (PubRing_Pop(&sf_msg)) {
+                StoreForward_Store(&sf_msg);
+            }
         }
-        
+
         WIFI_Process();
         
         #if DEBUG_STACK_MONITOR
@@ -717,7 +1075,8 @@ void Task_Wifi(void *pvParameters) {
             lastStackCheck = millis();
         }
         #endif
-        
-        vTaskDelay(pdMS_TO_TICKS(100));
+
+        PROFILE_EXEC_END(&g_wifiStats);
+        PROFILE_WAIT(&g_wifiStats, vTaskDelay(pdMS_TO_TICKS(WIFI_MONITOR_IDLE_MS)));
     }
 }
\ No newline at end of file
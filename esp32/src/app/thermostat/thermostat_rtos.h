@@ -12,10 +12,18 @@
 void InitThermostat();
 
 // ======= Task Prototypes =======
-void Task_TemperatureSensor(void* pvParameters);
-void Task_UserInput(void* pvParameters);
+void Task_Sensors(void* pvParameters);
 void Task_FanControl(void* pvParameters);
 void Task_Mqtt(void* pvParameters);
 void Task_Wifi(void* pvParameters);
 
+/**
+ * @brief Wake Task_Mqtt ahead of its idle timeout
+ * @note Producers (PubRing_Push, the room tx queue) call this after
+ *       enqueueing, so the service loop can idle for a full
+ *       MQTT_IDLE_SERVICE_MS - long enough for light sleep - without
+ *       adding publish latency.
+ */
+void Thermostat_MqttKick(void);
+
 #endif
@@ -0,0 +1,111 @@
+#include <Arduino.h>
+#include "thermostat_store_forward.h"
+#include "thermostat_config.h"
+#include "../../app_cfg.h"
+
+// ==================== RTC-RAM BACKED RING ====================
+// Kept in RTC slow memory so buffered telemetry survives a soft reset
+// or deep sleep during a long outage. A magic word guards against
+// replaying uninitialized memory after a cold boot.
+#define STORE_FORWARD_MAGIC  0x53464D51UL  // "SFMQ"
+
+RTC_NOINIT_ATTR static StoreForward_Record_t g_sfRing[STORE_FORWARD_SIZE];
+RTC_NOINIT_ATTR static uint32_t g_sfHead;
+RTC_NOINIT_ATTR static uint32_t g_sfTail;
+RTC_NOINIT_ATTR static uint32_t g_sfMagic;
+
+// Keep replay batches under PubSubClient's default packet limit
+#define SF_BATCH_PAYLOAD_MAX  220
+
+static const char* SF_TypeName(mqtt_pub_type_t type)
+{
+    switch (type) {
+        case MQTT_PUB_TEMP:   return "temperature";
+        case MQTT_PUB_TARGET: return "target_temp";
+        case MQTT_PUB_HUM:    return "humidity";
+        default:              return "unknown";
+    }
+}
+
+void StoreForward_Init(void)
+{
+    if (g_sfMagic != STORE_FORWARD_MAGIC ||
+        g_sfHead - g_sfTail > STORE_FORWARD_SIZE) {
+        // Cold boot or corrupt image - start clean
+        g_sfHead = 0;
+        g_sfTail = 0;
+        g_sfMagic = STORE_FORWARD_MAGIC;
+        DEBUG_PRINT(MQTT, "Store-forward: cleared");
+    } else if (g_sfHead != g_sfTail) {
+        DEBUG_PRINT(MQTT, "Store-forward: %u records survived reset",
+                    g_sfHead - g_sfTail);
+    }
+}
+
+void StoreForward_Store(const mqtt_pub_msg_t* msg)
+{
+    if (msg == NULL) {
+        return;
+    }
+
+    // Overwrite-oldest when full
+    if (g_sfHead - g_sfTail >= STORE_FORWARD_SIZE) {
+        g_sfTail++;
+    }
+
+    StoreForward_Record_t* rec = &g_sfRing[g_sfHead % STORE_FORWARD_SIZE];
+    rec->type = msg->type;
+    rec->value = msg->value;
+    rec->timestamp_ms = millis();
+    g_sfHead++;
+}
+
+void StoreForward_Replay(void)
+{
+    char payload[256];
+    size_t len;
+
+    while (g_sfTail != g_sfHead) {
+
+        // Broker dropped again mid-replay - keep the rest for later
+        if (!MQTT_IsConnected()) {
+            return;
+        }
+
+        // Pack as many records as fit into one JSON array batch
+        len = 0;
+        len += snprintf(payload + len, sizeof(payload) - len, "[");
+
+        while (g_sfTail != g_sfHead && len < SF_BATCH_PAYLOAD_MAX) {
+            StoreForward_Record_t* rec = &g_sfRing[g_sfTail % STORE_FORWARD_SIZE];
+            int written = snprintf(payload + len, sizeof(payload) - len,
+                                   "{\"t\":%u,\"m\":\"%s\",\"v\":%.2f},",
+                                   rec->timestamp_ms, SF_TypeName(rec->type),
+                                   rec->value);
+            // snprintf returns the would-have-written length: a record
+            // that didn't fit must not advance len past the buffer (or
+            // consume the record) - close this batch and retry it next
+            if (written < 0 || (size_t)written >= sizeof(payload) - len) {
+                payload[len] = '\0';
+                break;
+            }
+            len += (size_t)written;
+            g_sfTail++;
+        }
+
+        // Replace trailing comma with closing bracket
+        if (len > 1 && payload[len - 1] == ',') {
+            payload[len - 1] = ']';
+        } else {
+            len += snprintf(payload + len, sizeof(payload) - len, "]");
+        }
+
+        MQTT_Publish(MQTT_TOPIC_BACKFILL, payload);
+        DEBUG_PRINT(MQTT, "Replay batch: %s", payload);
+    }
+}
+
+uint32_t StoreForward_Count(void)
+{
+    return g_sfHead - g_sfTail;
+}
@@ -0,0 +1,47 @@
+#ifndef THERMOSTAT_STORE_FORWARD_H
+#define THERMOSTAT_STORE_FORWARD_H
+
+#include <stdint.h>
+#include <stdbool.h>
+#include "../../hal/communication/hal_mqtt/hal_mqtt.h"
+
+// Store-and-forward capacity - RTC slow memory backed, survives resets
+#define STORE_FORWARD_SIZE   256
+
+// Timestamped telemetry record held during an outage
+typedef struct {
+    mqtt_pub_type_t type;
+    float value;
+    uint32_t timestamp_ms;   // millis() at capture time
+} StoreForward_Record_t;
+
+/**
+ * @brief Initialize the store-and-forward ring
+ * @note Validates the RTC-RAM image and clears it if corrupt, so stale
+ *       garbage is not replayed after a cold boot
+ */
+void StoreForward_Init(void);
+
+/**
+ * @brief Absorb a telemetry message while WiFi/broker is down
+ * @param msg Message that could not be published
+ * @note Overwrites the oldest record when full
+ */
+void StoreForward_Store(const mqtt_pub_msg_t* msg);
+
+/**
+ * @brief Replay all buffered records to the broker after reconnect
+ *
+ * Records are published in batches as JSON arrays on the backfill topic,
+ * each entry carrying its capture timestamp so the dashboard can place
+ * it correctly. Consumed records are removed; stops early if a publish
+ * fails (broker dropped again) so nothing is lost.
+ */
+void StoreForward_Replay(void);
+
+/**
+ * @brief Number of records currently buffered
+ */
+uint32_t StoreForward_Count(void);
+
+#endif // THERMOSTAT_STORE_FORWARD_H
@@ -33,6 +33,17 @@ typedef struct {
     uint32_t taskRunCount;
     uint32_t lastRunTime;
     uint32_t minStackRemaining;
+#if DEBUG_TIMING
+    // Profiler counters, microseconds via esp_timer (see the
+    // PROFILE_* macros in thermostat_rtos.cpp). Single writer: the
+    // task that owns the struct.
+    uint8_t  taskId;          // Blackbox_Task_t id for breadcrumbs
+    uint64_t totalExecUs;     // Cumulative work time across all runs
+    uint32_t maxExecUs;       // Worst single run
+    uint64_t totalWaitUs;     // Cumulative time blocked (event/delay)
+    uint32_t maxWaitUs;       // Longest single block
+    uint64_t prevExecUs;      // Snapshot at last publish, for CPU share
+#endif
 } TaskDebugStats_t;
 
 #endif
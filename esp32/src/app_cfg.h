@@ -54,6 +54,18 @@
 #define UART_TX_PIN         17
 #define UART_RX_PIN         16
 
+/* IDF uart driver backing (see driver_uart.cpp): interrupt-fed RX/TX
+ * ring buffers plus '\n' pattern detection, so line-oriented input
+ * arrives as whole frames with no per-byte polling */
+#define UART_RX_RING_SIZE           1024
+#define UART_TX_RING_SIZE           1024
+#define UART_EVENT_QUEUE_LEN        16
+#define UART_PATTERN_QUEUE_LEN      8
+#define UART_FRAME_MAX              128     // Longest line delivered whole
+#define UART_FRAME_QUEUE_LEN        8
+#define UART_EVENT_TASK_STACK_SIZE  2560
+#define UART_EVENT_TASK_PRIORITY    2
+
 
 /* =========================
  * SPI Configuration
@@ -141,9 +153,21 @@
 #define DHT22_PIN           14
 #define DHT22_TYPE         DHT22
 
+/* DHT22 background refresh cache (see hal_dht.cpp) */
+#define DHT22_CACHE_REFRESH_MS   2000   // Sensor max sample rate is 0.5 Hz
+#define DHT22_CACHE_MAX_AGE_MS   10000  // Reads older than this count as failed
+#define DHT22_TASK_STACK_SIZE    2048
+#define DHT22_TASK_PRIORITY      1
+
 #define MQ5_PIN             33
 #define LDR_PIN             35
 
+/* MQ5 warm-up gating (see hal_mq5.cpp): heater stabilization window,
+ * then a clean-air baseline average; readings before MQ5_1_ready() are
+ * junk and the gas sensor holds its publishes until then */
+#define MQ5_WARMUP_MS       120000
+#define MQ5_CALIBRATION_MS  30000
+
 
 #define ADC_MIN_RAW 0
 #define ADC_MAX_RAW 4095
@@ -157,12 +181,30 @@
 #define ADC_RESOLUTION 12
 #define LDR_SAMPLE_COUNT 5
 
+/* ADC sampler engine (see SensorH.cpp): one task polls all registered
+ * analog channels and EMA-filters per channel */
+#define ADC_ENGINE_ENABLED          STD_ON
+#define ADC_ENGINE_MAX_CHANNELS     4
+#define ADC_ENGINE_SAMPLE_MS        10      // Per-channel sampling cadence
+#define ADC_ENGINE_EMA_SHIFT        3       // Filter alpha = 1/8
+#define ADC_ENGINE_TASK_STACK_SIZE  2048
+#define ADC_ENGINE_TASK_PRIORITY    1
+
 /* =========================
  * WiFi Configuration
  * ========================= */
 #define WIFI_SSID           "maha"
 #define WIFI_PASSWORD       "000000000"
 
+/* Fast reconnect: rejoin the last AP by BSSID/channel cached in RTC
+ * memory, skipping the channel scan (see hal_wifi.cpp). Optional static
+ * addressing additionally skips DHCP for sub-second recovery. */
+#define WIFI_FAST_RECONNECT     STD_ON
+#define WIFI_STATIC_IP_ENABLED  STD_OFF
+#define WIFI_STATIC_IP          "192.168.1.101"
+#define WIFI_STATIC_GATEWAY     "192.168.1.1"
+#define WIFI_STATIC_SUBNET      "255.255.255.0"
+
 
 /* =========================
  * MQTT Configuration
@@ -170,29 +212,61 @@
 #define MQTT_BROKER         "mqtt.saddevastator.qzz.io"
 #define MQTT_PORT           1883
 #define MQTT_RECONNECT_MS   5000
+
+/* Async backend: event-driven esp-mqtt (ships with the Arduino core)
+ * instead of polling PubSubClient from Task_Mqtt. Inbound commands
+ * dispatch as packets arrive on the client's own task; publishes enqueue
+ * to its outbox instead of blocking on the socket (see hal_mqtt.cpp) */
+#define MQTT_ASYNC_ENABLED  STD_ON
+#define MQTT_ASYNC_QOS      1       // Subscriptions
+
+/* Per-topic publish policy (see the policy table in hal_mqtt.cpp):
+ * topics not listed there publish at this QoS, unretained. Critical
+ * events and status topics override it in the table */
+#define MQTT_DEFAULT_QOS    0
+
+/* Presence: an LWT registered at connect flips the retained presence
+ * document to offline when the broker loses us, and a compact retained
+ * heartbeat (uptime/heap/min-heap) refreshes it at this period - the
+ * dashboard learns about a dead node from the broker, not from stale
+ * telemetry */
+#define PRESENCE_HEARTBEAT_MS   60000
+
+/* Report-by-exception policies (see app/common/report_policy.h):
+ * deadband = minimum change worth a publish, min = rate limit,
+ * heartbeat = max silence before an unchanged value goes out anyway */
+#define REPORT_TEMP_DEADBAND        0.5f    // °C
+#define REPORT_TEMP_MIN_MS          2000
+#define REPORT_TEMP_HEARTBEAT_MS    60000
+#define REPORT_HUM_DEADBAND         2.0f    // %RH
+#define REPORT_HUM_MIN_MS           2000
+#define REPORT_HUM_HEARTBEAT_MS     60000
+#define REPORT_GAS_DEADBAND         5.0f    // Mapped 0-255 units
+#define REPORT_GAS_MIN_MS           1000
+#define REPORT_GAS_HEARTBEAT_MS     30000   // Safety metric - tighter heartbeat
+#define REPORT_LDR_DEADBAND         3.0f    // Light percent
+#define REPORT_LDR_MIN_MS           1000
+#define REPORT_LDR_HEARTBEAT_MS     60000
+
+/* On-device history rings (see app/common/sensor_history.cpp): every
+ * raw sample lands in a per-metric window with incremental aggregates;
+ * a compact min/max/mean/stddev digest goes out periodically so the
+ * backend keeps full-resolution statistics without the raw stream */
+#define SENSOR_HISTORY_ENABLED  STD_ON
+#define SENSOR_HISTORY_SIZE     60      // Samples per metric window
+#define HISTORY_PUBLISH_MS      60000   // Aggregate digest interval
+
+/* Binary telemetry capability: when STD_ON, packed fixed-point records
+ * (mqtt_bin_record_t in hal_mqtt.h) are published on the parallel
+ * topic alongside the ASCII payloads the dashboard already consumes */
+#define MQTT_BINARY_TELEMETRY   STD_ON
+#define TELEMETRY_BIN_VERSION   1
+#define TELEMETRY_DEVICE_ID     101     // Room number
 /* =========================
  * MQTT Topics
  * ========================= */
-// MQTT Topics
-
-#define ROOM_TOPIC_LED1_CTRL    "hotel/room101/led1/control"
-#define ROOM_TOPIC_LED2_CTRL    "hotel/room101/led2/control"
-#define ROOM_TOPIC_LED1_STATUS  "room/led1/status"
-#define ROOM_TOPIC_LED2_STATUS  "room/led2/status"
-#define ROOM_TOPIC_LDR_RAW      "room/ldr/raw"
-#define ROOM_TOPIC_LDR_PERCENT  "room/ldr/percentage"
-#define ROOM_TOPIC_MODE_CTRL    "room/mode/control"      // Set mode: AUTO/MANUAL/OFF
-#define ROOM_TOPIC_MODE_STATUS  "room/mode/status"       // Current mode status
-#define ROOM_TOPIC_AUTO_DIM     "room/auto_dim/control"  // Deprecated - use mode instead
-
-#define MQTT_TOPIC_TEMP         "hotel/101/telemetry/temperature"
-#define MQTT_TOPIC_HUMIDITY     "hotel/101/telemetry/humidity	"
-#define MQTT_TOPIC_TARGET       "hotel/101/control/target_temp"
-#define MQTT_TOPIC_HEATING      "home/thermostat/heating"
-#define MQTT_TOPIC_LUMINOSITY   "hotel/101/telemetry/luminosity"
-#define MQTT_TOPIC_GAS          "home/thermostat/gas"
-#define MQTT_TOPIC_CONTROL      "hotel/101/control/mode"
-#define MQTT_TOPIC_SET_SPEED    "hotel/101/control/fan_speed"
+/* Built from ROOM_ID_STR at compile time (or from NVS at boot) -
+ * see mqtt_topics.h, included at the end of this file */
 
 
 
@@ -214,10 +288,98 @@
  * ========================= */
 #define SERIAL_BAUD_RATE    115200
 
+/* Cooperative scheduler (see app/common/scheduler.cpp): the tiny
+ * periodic polls (pot, gas, LDR) run as jobs on one executor task
+ * instead of each holding a dedicated stack to sleep between reads */
+#define SCHEDULER_ENABLED           STD_ON
+#define SCHEDULER_MAX_JOBS          8
+#define SCHEDULER_TASK_STACK_SIZE   4096
+#define SCHEDULER_TASK_PRIORITY     2
+#define SCHEDULER_TASK_CORE         1   // With the other control loops
+#define SCHEDULER_IDLE_MS           100 // Max sleep when nothing is due
+
+/* Runtime config cache (see app/common/app_config.cpp): one packed NVS
+ * blob read at boot into a read-mostly struct, defaults seeded from the
+ * macros above; per-site overrides arrive as "key=value" on the
+ * config/set topic and commit to NVS only when a field changed */
+#define CONFIG_CACHE_ENABLED    STD_ON
+
+/* Crash black box (see app/common/blackbox.cpp): event ring in RTC
+ * noinit memory, published with the reset reason after every reboot */
+#define BLACKBOX_ENABLED        STD_ON
+#define BLACKBOX_RING_SIZE      16
+#define BLACKBOX_PUBLISH_COUNT  8   // Newest events included in the report
+
+/* Per-boot self-calibration benchmark (see app/common/boot_bench.cpp):
+ * representative hot-path operations timed once at boot, published with
+ * the firmware version on diag/bench so Grafana can alert on
+ * per-version regressions fleet-wide */
+#define BOOT_BENCH_ENABLED      STD_ON
+#define BOOT_BENCH_ITERATIONS   256
+
+/* Firmware identity stamped into diagnostics reports - bump on release
+ * so the fleet dashboards can group numbers per rollout */
+#define FW_VERSION              "1.0.0"
+
+/* Leveled logging (see app/common/app_log.h): LOG_E/W/I/D sites compile
+ * against these integer levels, so anything below the effective level
+ * costs zero cycles and its format string never reaches flash. Build a
+ * release image with -DLOG_LEVEL_GLOBAL=0 (see `make log-audit` in the
+ * repo root) and the UART cost disappears from the message hot path. */
+#define LOG_LEVEL_OFF           0
+#define LOG_LEVEL_ERROR         1
+#define LOG_LEVEL_WARN          2
+#define LOG_LEVEL_INFO          3
+#define LOG_LEVEL_DEBUG         4
+
+#ifndef LOG_LEVEL_GLOBAL
+#define LOG_LEVEL_GLOBAL        LOG_LEVEL_DEBUG
+#endif
+
+/* Per-module ceilings - the effective level is the lower of the global
+ * cap and the module's own. MQTT defaults to DEBUG to match the output
+ * the polled backend produced before the sites were leveled. */
+#define LOG_LEVEL_MQTT          LOG_LEVEL_DEBUG
+#define LOG_LEVEL_WIFI          LOG_LEVEL_INFO
+#define LOG_LEVEL_ROOM          LOG_LEVEL_INFO
+#define LOG_LEVEL_SENSOR        LOG_LEVEL_INFO
+#define LOG_LEVEL_RFID          LOG_LEVEL_INFO
+#define LOG_LEVEL_CORE          LOG_LEVEL_INFO
+
+/* Deferred logging ring (see app/common/log_ring.cpp): hot paths queue
+ * compact binary records instead of blocking on the UART; a low-priority
+ * task formats and prints them */
+#define LOG_RING_ENABLED            STD_ON
+#define LOG_RING_SIZE               32
+#define LOG_RING_STR_MAX            48      // Per-record string payload
+#define LOG_RING_TASK_STACK_SIZE    2560
+#define LOG_RING_TASK_PRIORITY      1
+#define LOG_RING_DRAIN_TIMEOUT_MS   250
+
+/* Scope instrumentation (see app/common/instrument.h): INSTR_SCOPE /
+ * INSTR_COUNT at any site, zero bytes and zero cycles when disabled */
+#define INSTRUMENT_ENABLED          STD_ON
+#define INSTR_REPORT_MS             30000   // Serial report interval
+
+/* Power management (see app/common/power_mgr.cpp): DFS between the two
+ * frequencies, automatic light sleep in idle when the core supports
+ * tickless idle, WiFi modem-sleep negotiated with the AP. Interrupt
+ * sources (buttons, RFID IRQ) wake from light sleep, so tap latency is
+ * unchanged; the service loops below set how long the CPU may idle */
+#define POWER_MGR_ENABLED       STD_ON
+#define POWER_CPU_MAX_MHZ       240
+#define POWER_CPU_MIN_MHZ       80
+#define POWER_LIGHT_SLEEP       STD_ON
+#define MQTT_IDLE_SERVICE_MS    1000    // Keepalive cadence when no telemetry pends
+#define WIFI_MONITOR_IDLE_MS    1000    // Link-state poll when nothing changed
+
 
 /* =========================
  * SMS
  * ========================= */
 #define SMS_RECIPIENT "+201120076894"
 
+/* Topic builder - needs STD_ON/STD_OFF, so it comes last */
+#include "mqtt_topics.h"
+
 #endif /* APP_CFG_H */
\ No newline at end of file
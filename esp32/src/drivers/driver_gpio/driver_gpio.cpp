@@ -4,6 +4,7 @@
  */
 
 #include <Arduino.h>
+#include "soc/gpio_struct.h"
 #include "driver_gpio.h"
 #include "../../app_cfg.h"
 
@@ -82,9 +83,44 @@ void GPIO_TogglePin(uint8_t pinNumber) {
     int currentState = digitalRead(pinNumber);
     int newState = !currentState;
     digitalWrite(pinNumber, newState);
-    GPIO_DEBUG_LOG(String("GPIO Pin ") + String(pinNumber) + 
-                   String(" toggled: ") + String(currentState) + 
+    GPIO_DEBUG_LOG(String("GPIO Pin ") + String(pinNumber) +
+                   String(" toggled: ") + String(currentState) +
                    String(" -> ") + String(newState));
 #endif
 }
 
+/**
+ * @brief Set and clear multiple output pins in two register writes
+ * @note IRAM so it stays callable while flash cache is disabled; the
+ *       write-1-to-set/clear registers need no read-modify-write, so
+ *       no masking race with other tasks or ISRs
+ */
+void IRAM_ATTR GPIO_WriteMask(uint32_t set_mask, uint32_t clear_mask) {
+#if GPIO_ENABLED == STD_ON
+    GPIO.out_w1ts = set_mask;
+    GPIO.out_w1tc = clear_mask;
+#endif
+}
+
+/**
+ * @brief Read multiple input pins in one register access
+ */
+uint32_t IRAM_ATTR GPIO_ReadMask(uint32_t mask) {
+#if GPIO_ENABLED == STD_ON
+    return GPIO.in & mask;
+#else
+    return 0;
+#endif
+}
+
+/**
+ * @brief Attach an ISR to the falling edge of a GPIO pin
+ */
+void GPIO_AttachInterruptFalling(uint8_t pinNumber, void (*isr)(void)) {
+#if GPIO_ENABLED == STD_ON
+    attachInterrupt(digitalPinToInterrupt(pinNumber), isr, FALLING);
+    GPIO_DEBUG_LOG(String("GPIO Pin ") + String(pinNumber) +
+                   String(" falling-edge interrupt attached"));
+#endif
+}
+
@@ -76,4 +76,39 @@ GPIO_State_t GPIO_ReadPin(uint8_t pinNumber);
  */
 void GPIO_TogglePin(uint8_t pinNumber);
 
+/**
+ * @brief Attach an ISR to the falling edge of a GPIO pin
+ * @param pinNumber Pin number to watch
+ * @param isr Interrupt handler (must be ISR-safe, e.g. ARDUINO_ISR_ATTR)
+ */
+void GPIO_AttachInterruptFalling(uint8_t pinNumber, void (*isr)(void));
+
+// ==================== BULK (MASK) OPERATIONS ====================
+
+/**
+ * @brief Pin-to-mask mapping for the bulk operations below
+ * @note Resolves to a constant when the pin number is a constant, so
+ *       multi-pin masks fold at compile time. Covers the GPIO0-31 bank
+ *       only (GPIO32+ live in separate out1/in1 registers); every pin
+ *       on this board is below 32.
+ */
+#define GPIO_PIN_MASK(pinNumber)  (1UL << (pinNumber))
+
+/**
+ * @brief Set and clear multiple output pins in two register writes
+ * @param set_mask Pins to drive HIGH (GPIO.out_w1ts)
+ * @param clear_mask Pins to drive LOW (GPIO.out_w1tc)
+ * @note ISR-safe: direct register access, no Arduino pin mapping and
+ *       no debug logging. Pins must already be configured as outputs.
+ */
+void GPIO_WriteMask(uint32_t set_mask, uint32_t clear_mask);
+
+/**
+ * @brief Read multiple input pins in one register access
+ * @param mask Pins of interest (build with GPIO_PIN_MASK)
+ * @return GPIO.in levels, masked - nonzero bit means the pin is HIGH
+ * @note ISR-safe, same caveats as GPIO_WriteMask
+ */
+uint32_t GPIO_ReadMask(uint32_t mask);
+
 #endif // DRIVER_GPIO_H
\ No newline at end of file
@@ -1,7 +1,7 @@
 #include "Arduino.h"
+#include "driver/uart.h"
 #include "../../app_cfg.h"
 #include "driver_uart.h"
-//#include <String.h>
 
 #if UART_DEBUG == STD_ON
 #define DEBUG_PRINTLN(var) Serial.println(var)
@@ -9,45 +9,207 @@
 #define DEBUG_PRINTLN(var)
 #endif
 
+// Port table - a zero baud rate means the slot is unused
 static UART_t UART[UART_MAXLENGH] = {{UART_BAUD_RATE, UART_FRAME_LENGTH, UART_TX_PIN, UART_RX_PIN}};
-static HardwareSerial myserial[UART_MAXLENGH] = {Serial1, Serial2};
+
+// UARTN_t index -> hardware controller (UART0 stays the console)
+static const uart_port_t s_portMap[UART_MAXLENGH] = {UART_NUM_1, UART_NUM_2};
+
+/**
+ * @brief One assembled line, queued by the event task
+ */
+typedef struct {
+    uint16_t len;
+    char data[UART_FRAME_MAX];
+} UART_Frame_t;
+
+static QueueHandle_t s_eventQueue[UART_MAXLENGH];
+static QueueHandle_t s_frameQueue[UART_MAXLENGH];
+static uint32_t s_frameDrops[UART_MAXLENGH];
+
+/**
+ * @brief Task: turn uart driver events into whole-line frames
+ *
+ * The IDF driver's interrupt handler moves bytes into its RX ring
+ * buffer on its own; this task only wakes on events. On a '\n' pattern
+ * hit it pulls the finished line out of the ring in one read and queues
+ * it; on overflow it resets the ring and starts clean rather than
+ * delivering torn frames.
+ */
+static void UART_EventTask(void* arg)
+{
+    uint32_t idx = (uint32_t)arg;
+    uart_port_t port = s_portMap[idx];
+    uart_event_t event;
+    UART_Frame_t frame;
+
+    for (;;) {
+        if (xQueueReceive(s_eventQueue[idx], &event, portMAX_DELAY) != pdTRUE) {
+            continue;
+        }
+
+        switch (event.type) {
+            case UART_PATTERN_DET: {
+                int pos = uart_pattern_pop_pos(port);
+                if (pos < 0) {
+                    // Pattern position queue overflowed - resync
+                    uart_flush_input(port);
+                    uart_pattern_queue_reset(port, UART_PATTERN_QUEUE_LEN);
+                    break;
+                }
+
+                // Whole line (terminator included) in a single ring read
+                int to_read = pos + 1;
+                int copy = to_read;
+                if (copy > (int)sizeof(frame.data) - 1) {
+                    copy = sizeof(frame.data) - 1;
+                }
+                int got = uart_read_bytes(port, (uint8_t*)frame.data, copy,
+                                          pdMS_TO_TICKS(20));
+                if (got <= 0) break;
+
+                // Discard the tail of an oversized line
+                while (to_read > got) {
+                    uint8_t scratch[32];
+                    int chunk = to_read - got;
+                    if (chunk > (int)sizeof(scratch)) chunk = sizeof(scratch);
+                    int n = uart_read_bytes(port, scratch, chunk, pdMS_TO_TICKS(20));
+                    if (n <= 0) break;
+                    got += n;
+                }
+
+                // Strip the line ending and terminate
+                uint16_t len = (uint16_t)copy;
+                while (len > 0 && (frame.data[len - 1] == '\n' ||
+                                   frame.data[len - 1] == '\r')) {
+                    len--;
+                }
+                frame.data[len] = '\0';
+                frame.len = len;
+
+                if (len > 0 &&
+                    xQueueSend(s_frameQueue[idx], &frame, 0) != pdTRUE) {
+                    s_frameDrops[idx]++;  // Consumer is behind - drop newest
+                }
+                break;
+            }
+
+            case UART_FIFO_OVF:
+            case UART_BUFFER_FULL:
+                // Input outran the ring - flush and resync on the next line
+                uart_flush_input(port);
+                xQueueReset(s_eventQueue[idx]);
+                uart_pattern_queue_reset(port, UART_PATTERN_QUEUE_LEN);
+                break;
+
+            default:
+                break;
+        }
+    }
+}
 
 void UART_Init(void)
 {
 #if UART_ENABLED == STD_ON
-    for (uint8_t i; i < UART_MAXLENGH; i++)
+    for (uint8_t i = 0; i < UART_MAXLENGH; i++)
     {
-        myserial[i].begin(UART[i].buadRate, UART[i].FrameLength, UART[i].RXPin, UART[i].TXPin);
+        if (UART[i].buadRate == 0) continue;  // Slot not configured
+
+        uart_port_t port = s_portMap[i];
+
+        uart_config_t cfg = {};
+        cfg.baud_rate  = (int)UART[i].buadRate;
+        cfg.data_bits  = UART_DATA_8_BITS;   // 8N1 (UART_FRAME_LENGTH)
+        cfg.parity     = UART_PARITY_DISABLE;
+        cfg.stop_bits  = UART_STOP_BITS_1;
+        cfg.flow_ctrl  = UART_HW_FLOWCTRL_DISABLE;
+        cfg.source_clk = UART_SCLK_APB;
+
+        if (uart_driver_install(port, UART_RX_RING_SIZE, UART_TX_RING_SIZE,
+                                UART_EVENT_QUEUE_LEN, &s_eventQueue[i], 0) != ESP_OK) {
+            Serial.printf("[ERROR] UART%u driver install failed\n", i);
+            continue;
+        }
+        uart_param_config(port, &cfg);
+        uart_set_pin(port, UART[i].TXPin, UART[i].RXPin,
+                     UART_PIN_NO_CHANGE, UART_PIN_NO_CHANGE);
+
+        // Line-oriented input: interrupt on '\n' so the event task only
+        // wakes once per frame, not once per byte
+        uart_enable_pattern_det_baud_intr(port, '\n', 1, 9, 0, 0);
+        uart_pattern_queue_reset(port, UART_PATTERN_QUEUE_LEN);
+
+        s_frameQueue[i] = xQueueCreate(UART_FRAME_QUEUE_LEN, sizeof(UART_Frame_t));
+        if (s_frameQueue[i] == NULL) {
+            Serial.printf("[ERROR] UART%u frame queue create failed\n", i);
+            uart_driver_delete(port);
+            continue;
+        }
+
+        char name[12];
+        snprintf(name, sizeof(name), "UartEvt%u", i);
+        xTaskCreate(UART_EventTask, name, UART_EVENT_TASK_STACK_SIZE,
+                    (void*)(uint32_t)i, UART_EVENT_TASK_PRIORITY, NULL);
+
         DEBUG_PRINTLN("UART" + String(i) + " initialize");
     }
 #endif
 }
 
-void UART_Send_Data(UARTN_t uart_n, String payload)
+bool UART_ReadFrame(UARTN_t uart_n, char* frame, size_t max_len, size_t* out_len)
 {
 #if UART_ENABLED == STD_ON
-    if (myserial[uart_n].available())
-    {
-        myserial[uart_n].println(payload);
-        DEBUG_PRINTLN("UART send" + String(payload));
+    if (uart_n >= UART_MAXLENGH || s_frameQueue[uart_n] == NULL ||
+        frame == NULL || max_len == 0) {
+        return false;
+    }
+
+    UART_Frame_t f;
+    if (xQueueReceive(s_frameQueue[uart_n], &f, 0) != pdTRUE) {
+        return false;
     }
+
+    size_t len = f.len;
+    if (len >= max_len) len = max_len - 1;
+    memcpy(frame, f.data, len);
+    frame[len] = '\0';
+    if (out_len != NULL) *out_len = len;
+    return true;
+#else
+    return false;
 #endif
 }
-void UART_Receive_Data(UARTN_t uart_n, String &payload)
+
+size_t UART_Write(UARTN_t uart_n, const uint8_t* data, size_t length)
 {
 #if UART_ENABLED == STD_ON
-    if (myserial[uart_n].available())
-    {
-        Serial1.print(payload);
-        payload = myserial[uart_n].readStringUntil('\n');
-        DEBUG_PRINTLN("UART receive" + String(payload));
+    if (uart_n >= UART_MAXLENGH || s_frameQueue[uart_n] == NULL) {
+        return 0;
     }
+    int written = uart_write_bytes(s_portMap[uart_n], (const char*)data, length);
+    return (written < 0) ? 0 : (size_t)written;
+#else
+    return 0;
 #endif
 }
 
+void UART_Send_Data(UARTN_t uart_n, String payload)
+{
+#if UART_ENABLED == STD_ON
+    UART_Write(uart_n, (const uint8_t*)payload.c_str(), payload.length());
+    UART_Write(uart_n, (const uint8_t*)"\r\n", 2);
+    DEBUG_PRINTLN("UART send" + String(payload));
+#endif
+}
 
-
-void UART_getSerial(HardwareSerial&serial,UARTN_t uart)
+void UART_Receive_Data(UARTN_t uart_n, String &payload)
 {
-    serial = myserial[uart];
+#if UART_ENABLED == STD_ON
+    char line[UART_FRAME_MAX];
+    if (UART_ReadFrame(uart_n, line, sizeof(line), NULL))
+    {
+        payload = line;
+        DEBUG_PRINTLN("UART receive" + String(payload));
+    }
+#endif
 }
@@ -1,7 +1,10 @@
 #ifndef DRIVER_UART_H
 #define DRIVER_UART_H
 
+#include <Arduino.h>
 #include <stdint.h>
+#include <stddef.h>
+#include <stdbool.h>
 
 typedef enum
 {
@@ -19,8 +22,34 @@ typedef struct
 } UART_t;
 
 void UART_Init(void);
+
+/**
+ * @brief Fetch the next complete line received on a port, if any
+ *
+ * Frames are assembled off the caller's back: the IDF uart driver fills
+ * its interrupt-fed RX ring buffer, the pattern-detection interrupt
+ * fires on '\n', and the driver's event task moves the finished line
+ * into a frame queue. This call is non-blocking and never returns a
+ * partial frame, so 115200+ baud input survives without per-byte polls.
+ *
+ * @param uart_n Port
+ * @param frame Destination - null-terminated, trailing newline stripped
+ * @param max_len Destination capacity (longer frames are truncated)
+ * @param out_len Copied frame length (optional, may be NULL)
+ * @return true if a frame was available
+ */
+bool UART_ReadFrame(UARTN_t uart_n, char* frame, size_t max_len, size_t* out_len);
+
+/**
+ * @brief Queue bytes for transmission
+ * @return Bytes accepted into the TX ring buffer
+ * @note Copies into the driver's ring and returns - the UART interrupt
+ *       drains it, so callers never block on the wire
+ */
+size_t UART_Write(UARTN_t uart_n, const uint8_t* data, size_t length);
+
+/* Legacy String API - thin wrappers over UART_Write/UART_ReadFrame */
 void UART_Receive_Data(UARTN_t uart_n, String &payload);
 void UART_Send_Data(UARTN_t uart_n, String payload);
-void UART_getSerial(HardwareSerial*serial,UARTN_t uart);
 
-#endif
\ No newline at end of file
+#endif
@@ -7,12 +7,27 @@
 #include "../../../app/room/room_types.h"
 #include "../../../app/room/room_logic.h"
 #include "../../../app/room/room_rtos.h"
+#include "../../sensors/hal_rfid/hal_rfid.h"
+#include "../../../app/common/log_ring.h"
+#include "../../../app/common/app_config.h"
+#include "../../../app/common/app_log.h"
 #include "helpers.h"
 
+#if MQTT_ASYNC_ENABLED == STD_ON
+// Event-driven backend on ESP-IDF's esp-mqtt (bundled with the Arduino
+// core). The client runs its own task: inbound messages dispatch as the
+// packet arrives and publishes enqueue to an outbox instead of blocking
+// the caller on the socket.
+#include "mqtt_client.h"
+
+static esp_mqtt_client_handle_t g_asyncClient = NULL;
+static volatile bool g_asyncConnected = false;
+static bool g_asyncStarted = false;
+static char g_brokerUri[64];
+#else
 static WiFiClient wifiClient;
 static PubSubClient mqttClient(wifiClient);
-
-
+#endif
 
 static const char* g_broker;
 static int g_port;
@@ -53,6 +68,7 @@ static Fan_Speed_t ParseFanSpeed(const char* speed_str) {
 
 
 
+#if MQTT_ASYNC_ENABLED == STD_OFF
 static void MQTT_Reconnect(void);
 
 static void mqttCallback(char* topic, byte* payload, unsigned int length)
@@ -73,21 +89,248 @@ static void mqttCallback(char* topic, byte* payload, unsigned int length)
             thermostatMqttEventSet(); /// in mqtt.cpp
         }
 
-        Serial.print("New target temp from MQTT: ");
-        Serial.println(newTarget);
+        LOG_I(MQTT, "New target temp from MQTT: %.2f", newTarget);
+    }
+}
+#endif /* MQTT_ASYNC_ENABLED == STD_OFF */
+
+
+
+// ============================================================================
+// Topic handlers - one per subscribed topic, dispatched via table below
+// ============================================================================
+
+static void Handler_TargetTemp(const char* message)
+{
+    // Set target temperature from MQTT
+    float target = atof(message);
+    if (target >= 15.0f && target <= 35.0f) {  // Validate range
+        Thermostat_SetTargetTemp(target);
+        thermostatMqttEventSet();  // Trigger fan control update
+        LOG_I(MQTT, "Target temp set to: %.1f°C", target);
+    } else {
+        LOG_W(MQTT, "Invalid target temp: %.1f°C", target);
+    }
+}
+
+static void Handler_ThermostatMode(const char* message)
+{
+    // Set thermostat mode from MQTT
+    Thermostat_Mode_t mode = ParseMode(message);
+    Thermostat_SetMode(mode);
+    thermostatMqttModeEventSet();  // Trigger fan control update
+
+    const char* mode_name = (mode == THERMOSTAT_MODE_OFF) ? "OFF" :
+                            (mode == THERMOSTAT_MODE_AUTO) ? "AUTO" :
+                            (mode == THERMOSTAT_MODE_MANUAL) ? "MANUAL" : "UNKNOWN";
+    LOG_I(MQTT, "Thermostat mode set to: %s", mode_name);
+}
+
+static void Handler_FanSpeed(const char* message)
+{
+    // Set manual fan speed from MQTT (only works in MANUAL mode)
+    Fan_Speed_t speed = ParseFanSpeed(message);
+
+    Thermostat_Mode_t current_mode = Thermostat_GetMode();
+    if (current_mode == THERMOSTAT_MODE_MANUAL) {
+        Thermostat_SetFanSpeed(speed);
+        thermostatMqttFanSpeedEventSet();  // Trigger fan control update
+
+        const char* speed_name = (speed == FAN_SPEED_OFF) ? "OFF" :
+                                 (speed == FAN_SPEED_LOW) ? "LOW" :
+                                 (speed == FAN_SPEED_MEDIUM) ? "MEDIUM" :
+                                 (speed == FAN_SPEED_HIGH) ? "HIGH" : "UNKNOWN";
+        LOG_I(MQTT, "Fan speed set to: %s", speed_name);
+    } else {
+        LOG_W(MQTT, "Cannot set fan speed - not in MANUAL mode (current: %d)", current_mode);
+    }
+}
+
+static void Handler_RoomMode(const char* message)
+{
+    // Decode once here; the room task gets a two-byte command, not a
+    // topic string, and publishes its own status confirmation
+    Room_Mode_t room_mode = Room_Logic_ParseMode(message);
+    if (room_mode != 0xFF) {  // Valid mode
+        Room_Command_t cmd = { ROOM_CMD_SET_MODE, (uint8_t)room_mode };
+        if (!Room_RTOS_SendCommand(&cmd)) {
+            LOG_W(MQTT, "Room command queue full - mode dropped");
+        }
+    } else {
+        LOG_W(MQTT, "Invalid room mode: %s", message);
+    }
+}
+
+static void Handler_RoomLED(Room_LED_t led, const char* message)
+{
+    // Parse here, act on the room task. The MANUAL-mode gate lives in
+    // the command drain, where mode can't change under the check.
+    Room_LED_State_t state = Room_Logic_ParseLEDState(message);
+    if (state != 0xFF) {  // Valid state
+        Room_Command_t cmd = {
+            (uint8_t)((led == ROOM_LED_1) ? ROOM_CMD_SET_LED1 : ROOM_CMD_SET_LED2),
+            (uint8_t)state
+        };
+        if (!Room_RTOS_SendCommand(&cmd)) {
+            LOG_W(MQTT, "Room command queue full - LED%d dropped", led + 1);
+        }
+    } else {
+        LOG_W(MQTT, "Invalid LED%d command: %s", led + 1, message);
+    }
+}
+
+static void Handler_RoomLED1(const char* message) { Handler_RoomLED(ROOM_LED_1, message); }
+static void Handler_RoomLED2(const char* message) { Handler_RoomLED(ROOM_LED_2, message); }
+
+static void Handler_AutoDim(const char* message)
+{
+    // Deprecated: Auto-dim control (maps to room mode)
+    Room_AutoDimMode_t autodim_mode = Room_Logic_ParseAutoDimMode(message);
+    if (autodim_mode != 0xFF) {  // Valid mode
+        Room_Command_t cmd = { ROOM_CMD_SET_AUTODIM, (uint8_t)autodim_mode };
+        if (!Room_RTOS_SendCommand(&cmd)) {
+            LOG_W(MQTT, "Room command queue full - auto-dim dropped");
+        }
+    } else {
+        LOG_W(MQTT, "Invalid auto-dim command: %s", message);
+    }
+}
+
+static void Handler_AuthLoad(const char* message)
+{
+    // Front-desk card list push. Payload is comma-separated UID strings;
+    // a leading '+' appends to the current list (for chunked pushes)
+    // instead of replacing it.
+    if (message[0] == '+') {
+        const char* list = message + 1;
+        while (*list != '\0') {
+            char entry[RFID_UID_STR_LEN];
+            size_t len = 0;
+            while (*list != '\0' && *list != ',' && len < sizeof(entry) - 1) {
+                entry[len++] = *list++;
+            }
+            entry[len] = '\0';
+            if (len > 0) RFID_Auth_AddFromString(entry);
+            if (*list == ',') list++;
+        }
+        LOG_I(MQTT, "Card list appended (now %u cards)", RFID_Auth_Count());
+    } else {
+        RFID_Auth_BulkLoad(message);
+    }
+}
+
+static void Handler_ConfigSet(const char* message)
+{
+#if CONFIG_CACHE_ENABLED == STD_ON
+    // Per-site tuning push. Payload is "key=value"; the cache commits
+    // to NVS only when the field actually changed.
+    const char* eq = strchr(message, '=');
+    if (eq == NULL || eq == message) {
+        LOG_W(MQTT, "Bad config payload: %s", message);
+        return;
+    }
+
+    char key[16];
+    size_t klen = (size_t)(eq - message);
+    if (klen >= sizeof(key)) klen = sizeof(key) - 1;
+    memcpy(key, message, klen);
+    key[klen] = '\0';
+
+    if (Config_Apply(key, eq + 1)) {
+        Config_Commit();
+        LOG_I(MQTT, "Config %s updated", key);
+    } else {
+        LOG_W(MQTT, "Unknown config key: %s", key);
     }
+#else
+    (void)message;
+#endif
 }
 
+// ============================================================================
+// Topic dispatch table - binary searched, sorted once at MQTT_Init
+// ============================================================================
+
+typedef void (*mqtt_topic_handler_t)(const char* message);
+
+typedef struct {
+    const char* topic;
+    mqtt_topic_handler_t handler;
+} mqtt_dispatch_entry_t;
 
+static mqtt_dispatch_entry_t g_dispatchTable[] = {
+    { MQTT_TOPIC_TARGET,    Handler_TargetTemp },
+    { MQTT_TOPIC_CONTROL,   Handler_ThermostatMode },
+    { MQTT_TOPIC_SET_SPEED, Handler_FanSpeed },
+    { ROOM_TOPIC_MODE_CTRL, Handler_RoomMode },
+    { ROOM_TOPIC_LED1_CTRL, Handler_RoomLED1 },
+    { ROOM_TOPIC_LED2_CTRL, Handler_RoomLED2 },
+    { ROOM_TOPIC_AUTO_DIM,  Handler_AutoDim },
+    { ROOM_TOPIC_AUTH_LOAD, Handler_AuthLoad },
+    { ROOM_TOPIC_CONFIG_SET, Handler_ConfigSet },
+};
+
+#define MQTT_DISPATCH_COUNT  (sizeof(g_dispatchTable) / sizeof(g_dispatchTable[0]))
+
+/**
+ * @brief Sort the dispatch table by topic so lookups can binary search
+ * @note Called once from MQTT_Init - insertion sort is fine at this size
+ */
+static void MQTT_SortDispatchTable(void)
+{
+    for (size_t i = 1; i < MQTT_DISPATCH_COUNT; i++) {
+        mqtt_dispatch_entry_t key = g_dispatchTable[i];
+        size_t j = i;
+        while (j > 0 && strcmp(g_dispatchTable[j - 1].topic, key.topic) > 0) {
+            g_dispatchTable[j] = g_dispatchTable[j - 1];
+            j--;
+        }
+        g_dispatchTable[j] = key;
+    }
+}
+
+/**
+ * @brief Binary search the dispatch table for a topic
+ * @return Handler pointer or NULL if the topic is unknown
+ */
+static mqtt_topic_handler_t MQTT_FindHandler(const char* topic)
+{
+    int lo = 0;
+    int hi = (int)MQTT_DISPATCH_COUNT - 1;
+
+    while (lo <= hi) {
+        int mid = (lo + hi) / 2;
+        int cmp = strcmp(topic, g_dispatchTable[mid].topic);
+
+        if (cmp == 0) return g_dispatchTable[mid].handler;
+        if (cmp < 0)  hi = mid - 1;
+        else          lo = mid + 1;
+    }
+
+    return NULL;
+}
+
+#if BOOT_BENCH_ENABLED == STD_ON
+bool MQTT_BenchLookup(const char* topic)
+{
+    static bool sorted = false;
+    if (!sorted) {
+        MQTT_SortDispatchTable();
+        sorted = true;
+    }
+    return MQTT_FindHandler(topic) != NULL;
+}
+#endif
 
 /**
  * @brief MQTT message callback - Called when message is received
  * @param topic The topic the message was received on
  * @param payload The message payload (NOT null-terminated!)
  * @param length Length of the payload
- * 
- * @note This is typically called from the MQTT library's callback
- *       Add this to your PubSubClient or MQTT library callback
+ *
+ * @note Runs on the network task inside PubSubClient - dispatch is a
+ *       binary search over the sorted topic table, so cost stays O(log n)
+ *       as per-room topics are added instead of a linear strcmp chain
  */
 void MQTT_MessageCallback(char* topic, uint8_t* payload, unsigned int length) {
     // Create null-terminated string from payload
@@ -97,151 +340,343 @@ void MQTT_MessageCallback(char* topic, uint8_t* payload, unsigned int length) {
     }
     memcpy(message, payload, length);
     message[length] = '\0';
-    
-    Serial.printf("[MQTT RX] Topic: %s, Payload: %s\n", topic, message);
-    
-    // ========================================================================
-    // THERMOSTAT TOPICS
-    // ========================================================================
-    
-    if (strcmp(topic, MQTT_TOPIC_TARGET) == 0) {
-        // Set target temperature from MQTT
-        float target = atof(message);
-        if (target >= 15.0f && target <= 35.0f) {  // Validate range
-            Thermostat_SetTargetTemp(target);
-            thermostatMqttEventSet();  // Trigger fan control update
-            Serial.printf("[MQTT] Target temp set to: %.1f°C\n", target);
-        } else {
-            Serial.printf("[MQTT] Invalid target temp: %.1f°C\n", target);
+
+#if LOG_RING_ENABLED == STD_ON
+    // Deferred: this runs on the network task - no blocking UART here
+    char rx_line[LOG_RING_STR_MAX];
+    snprintf(rx_line, sizeof(rx_line), "%s=%s", topic, message);
+    LogRing_LogStr(LOG_FMT_MQTT_RX, rx_line, 0);
+#else
+    LOG_D(MQTT, "RX Topic: %s, Payload: %s", topic, message);
+#endif
+
+    mqtt_topic_handler_t handler = MQTT_FindHandler(topic);
+    if (handler != NULL) {
+        handler(message);
+    } else {
+#if LOG_RING_ENABLED == STD_ON
+        LogRing_LogStr(LOG_FMT_MQTT_UNKNOWN, topic, 0);
+#else
+        LOG_W(MQTT, "Unknown topic: %s", topic);
+#endif
+    }
+}
+
+
+
+// ============================================================================
+// Publish policy table - per-topic QoS and retain flag, sorted once at
+// MQTT_Init and binary searched like the dispatch table above. Topics
+// not listed publish at MQTT_DEFAULT_QOS, unretained: a lost LDR sample
+// is replaced by the next one, but an access event or boot report must
+// survive a flaky link, and status topics are retained so a dashboard
+// that (re)subscribes converges immediately instead of showing blanks.
+// ============================================================================
+
+// Last-will payload: the broker retains this on the presence topic the
+// moment it loses the session, flipping the heartbeat document offline
+#define MQTT_PRESENCE_OFFLINE  "{\"state\":\"offline\"}"
+
+typedef struct {
+    const char* topic;
+    uint8_t     qos;     // 0 = fire-and-forget, 1 = at-least-once
+    bool        retain;
+} mqtt_pub_policy_t;
+
+static mqtt_pub_policy_t g_pubPolicyTable[] = {
+    // Critical events - QoS1 so the broker acks them
+    { MQTT_TOPIC_DIAG_BOOT,    1, false },  // Post-crash blackbox report
+    { MQTT_TOPIC_BACKFILL,     1, false },  // Store-and-forward replay
+    { MQTT_TOPIC_GAS,          1, false },  // Safety metric
+
+    // Status topics - QoS1 and retained
+    { ROOM_TOPIC_LED1_STATUS,  1, true  },
+    { ROOM_TOPIC_LED2_STATUS,  1, true  },
+    { ROOM_TOPIC_MODE_STATUS,  1, true  },
+    { ROOM_TOPIC_STATUS_DOC,   1, true  },  // Consolidated room document
+    { MQTT_TOPIC_PRESENCE,     1, true  },  // Liveness heartbeat / LWT
+};
+
+#define MQTT_PUB_POLICY_COUNT \
+    (sizeof(g_pubPolicyTable) / sizeof(g_pubPolicyTable[0]))
+
+// Everything else: bulk telemetry treatment
+static const mqtt_pub_policy_t g_pubPolicyDefault =
+    { NULL, MQTT_DEFAULT_QOS, false };
+
+/**
+ * @brief Sort the publish policy table for binary search
+ * @note Called once from MQTT_Init, same as the dispatch table
+ */
+static void MQTT_SortPubPolicyTable(void)
+{
+    for (size_t i = 1; i < MQTT_PUB_POLICY_COUNT; i++) {
+        mqtt_pub_policy_t key = g_pubPolicyTable[i];
+        size_t j = i;
+        while (j > 0 && strcmp(g_pubPolicyTable[j - 1].topic, key.topic) > 0) {
+            g_pubPolicyTable[j] = g_pubPolicyTable[j - 1];
+            j--;
         }
+        g_pubPolicyTable[j] = key;
     }
-    else if (strcmp(topic, MQTT_TOPIC_CONTROL) == 0) {
-        // Set thermostat mode from MQTT
-        Thermostat_Mode_t mode = ParseMode(message);
-        Thermostat_SetMode(mode);
-        thermostatMqttModeEventSet();  // Trigger fan control update
-        
-        const char* mode_name = (mode == THERMOSTAT_MODE_OFF) ? "OFF" :
-                                (mode == THERMOSTAT_MODE_AUTO) ? "AUTO" :
-                                (mode == THERMOSTAT_MODE_MANUAL) ? "MANUAL" : "UNKNOWN";
-        Serial.printf("[MQTT] Thermostat mode set to: %s\n", mode_name);
-        
-        // Publish mode status confirmation
-        //MQTT_Publish(MQTT_TOPIC_MODE_STATUS, mode_name);
+}
+
+/**
+ * @brief Look up the publish policy for a topic
+ * @return Table entry, or the QoS0/unretained default for unknown topics
+ */
+static const mqtt_pub_policy_t* MQTT_FindPubPolicy(const char* topic)
+{
+    int lo = 0;
+    int hi = (int)MQTT_PUB_POLICY_COUNT - 1;
+
+    while (lo <= hi) {
+        int mid = (lo + hi) / 2;
+        int cmp = strcmp(topic, g_pubPolicyTable[mid].topic);
+
+        if (cmp == 0) return &g_pubPolicyTable[mid];
+        if (cmp < 0)  hi = mid - 1;
+        else          lo = mid + 1;
     }
-    else if (strcmp(topic, MQTT_TOPIC_SET_SPEED) == 0) {
-        // Set manual fan speed from MQTT (only works in MANUAL mode)
-        Fan_Speed_t speed = ParseFanSpeed(message);
-        
-        Thermostat_Mode_t current_mode = Thermostat_GetMode();
-        if (current_mode == THERMOSTAT_MODE_MANUAL) {
-            Thermostat_SetFanSpeed(speed);
-            thermostatMqttFanSpeedEventSet();  // Trigger fan control update
-            
-            const char* speed_name = (speed == FAN_SPEED_OFF) ? "OFF" :
-                                     (speed == FAN_SPEED_LOW) ? "LOW" :
-                                     (speed == FAN_SPEED_MEDIUM) ? "MEDIUM" :
-                                     (speed == FAN_SPEED_HIGH) ? "HIGH" : "UNKNOWN";
-            Serial.printf("[MQTT] Fan speed set to: %s\n", speed_name);
-            
-            // Publish speed status confirmation
-            //MQTT_Publish(MQTT_TOPIC_FAN_SPEED_STATUS, speed_name);
-        } else {
-            Serial.printf("[MQTT] Cannot set fan speed - not in MANUAL mode (current: %d)\n", current_mode);
+
+    return &g_pubPolicyDefault;
+}
+
+// ============================================================================
+// Backend: esp-mqtt (event-driven) or PubSubClient (polled from Task_Mqtt)
+// ============================================================================
+
+#if MQTT_ASYNC_ENABLED == STD_ON
+
+/**
+ * @brief esp-mqtt event handler - runs on the client's own task
+ *
+ * Inbound messages reuse the same dispatch path as the polled backend
+ * (MQTT_MessageCallback), so topic handlers are backend-agnostic. The
+ * topic pointer esp-mqtt hands out is not null-terminated and only
+ * valid during the callback, so it gets copied out first.
+ */
+static void MQTT_AsyncEventHandler(void* arg, esp_event_base_t base,
+                                   int32_t event_id, void* event_data)
+{
+    esp_mqtt_event_handle_t event = (esp_mqtt_event_handle_t)event_data;
+
+    switch ((esp_mqtt_event_id_t)event_id) {
+        case MQTT_EVENT_CONNECTED:
+            g_asyncConnected = true;
+            LOG_I(MQTT, "Connected");
+            // Resubscribe here so every reconnect restores the set, not
+            // just the first one Task_Mqtt happens to observe
+            MQTT_SubscribeTopics();
+            // Overwrite the retained offline document straight away
+            MQTT_PublishPresence();
+            break;
+
+        case MQTT_EVENT_DISCONNECTED:
+            g_asyncConnected = false;
+            break;
+
+        case MQTT_EVENT_DATA: {
+            if (event->topic_len == 0) {
+                break;  // Continuation fragment of an oversized message
+            }
+            char topic[TOPIC_MAX_LEN];
+            unsigned int tlen = event->topic_len;
+            if (tlen >= sizeof(topic)) tlen = sizeof(topic) - 1;
+            memcpy(topic, event->topic, tlen);
+            topic[tlen] = '\0';
+
+            MQTT_MessageCallback(topic, (uint8_t*)event->data,
+                                 (unsigned int)event->data_len);
+            break;
         }
+
+        default:
+            break;
     }
-    
-    // ========================================================================
-    // ROOM LIGHTING TOPICS
-    // ========================================================================
-    
-    else if (strcmp(topic, ROOM_TOPIC_MODE_CTRL) == 0) {
-        // Set room lighting mode from MQTT
-        Room_Mode_t room_mode = Room_Logic_ParseMode(message);
-        if (room_mode != 0xFF) {  // Valid mode
-            Room_Logic_SetMode(room_mode);
-            const char* mode_str = Room_Logic_GetModeString();
-            Serial.printf("[MQTT] Room mode set to: %s\n", mode_str);
-            
-            // Publish mode status confirmation
-            Room_RTOS_PublishModeStatus();
-        } else {
-            Serial.printf("[MQTT] Invalid room mode: %s\n", message);
-        }
+}
+
+void MQTT_Init(const char* broker, int port)
+{
+    g_broker = broker;
+    g_port = port;
+
+    MQTT_SortDispatchTable();
+    MQTT_SortPubPolicyTable();
+
+    snprintf(g_brokerUri, sizeof(g_brokerUri), "mqtt://%s:%d", broker, port);
+
+    esp_mqtt_client_config_t cfg = {};
+    cfg.uri = g_brokerUri;
+    cfg.reconnect_timeout_ms = MQTT_RECONNECT_MS;
+    // Last will: the broker marks us offline the moment the session
+    // drops, retained so late subscribers see it too
+    cfg.lwt_topic = MQTT_TOPIC_PRESENCE;
+    cfg.lwt_msg = MQTT_PRESENCE_OFFLINE;
+    cfg.lwt_qos = 1;
+    cfg.lwt_retain = 1;
+
+    g_asyncClient = esp_mqtt_client_init(&cfg);
+    if (g_asyncClient == NULL) {
+        LOG_E(MQTT, "esp-mqtt client init failed");
+        return;
     }
-    else if (strcmp(topic, ROOM_TOPIC_LED1_CTRL) == 0) {
-        // Control LED1 (only works in MANUAL mode)
-        Room_Mode_t current_room_mode = Room_Logic_GetMode();
-        
-        if (current_room_mode != ROOM_MODE_MANUAL) {
-            Serial.printf("[MQTT] Cannot control LED1 - Room mode is %s (need MANUAL)\n", 
-                         Room_Logic_GetModeString());
-            return;
-        }
-        
-        Room_LED_State_t state = Room_Logic_ParseLEDState(message);
-        if (state != 0xFF) {  // Valid state
-            Room_Logic_SetLED(ROOM_LED_1, state, ROOM_CONTROL_MQTT);
-            Serial.printf("[MQTT] LED1 set to: %s\n", state == ROOM_LED_ON ? "ON" : "OFF");
-            
-            // Publish LED status confirmation
-            Room_RTOS_PublishLEDStatus(ROOM_LED_1);
-        } else {
-            Serial.printf("[MQTT] Invalid LED1 command: %s\n", message);
+    esp_mqtt_client_register_event(g_asyncClient,
+                                   (esp_mqtt_event_id_t)ESP_EVENT_ANY_ID,
+                                   MQTT_AsyncEventHandler, NULL);
+}
+
+void MQTT_Loop(void)
+{
+    // The client owns its task - connection upkeep, keepalive and
+    // reconnect backoff all happen there. All that is left here is
+    // starting it once the network exists.
+    if (!g_asyncStarted && g_asyncClient != NULL && WIFI_IsConnected()) {
+        if (esp_mqtt_client_start(g_asyncClient) == ESP_OK) {
+            g_asyncStarted = true;
         }
     }
-    else if (strcmp(topic, ROOM_TOPIC_LED2_CTRL) == 0) {
-        // Control LED2 (only works in MANUAL mode)
-        Room_Mode_t current_room_mode = Room_Logic_GetMode();
-        
-        if (current_room_mode != ROOM_MODE_MANUAL) {
-            Serial.printf("[MQTT] Cannot control LED2 - Room mode is %s (need MANUAL)\n", 
-                         Room_Logic_GetModeString());
-            return;
-        }
-        
-        Room_LED_State_t state = Room_Logic_ParseLEDState(message);
-        if (state != 0xFF) {  // Valid state
-            Room_Logic_SetLED(ROOM_LED_2, state, ROOM_CONTROL_MQTT);
-            Serial.printf("[MQTT] LED2 set to: %s\n", state == ROOM_LED_ON ? "ON" : "OFF");
-            
-            // Publish LED status confirmation
-            Room_RTOS_PublishLEDStatus(ROOM_LED_2);
-        } else {
-            Serial.printf("[MQTT] Invalid LED2 command: %s\n", message);
-        }
+}
+
+void MQTT_SubscribeAll(void)
+{
+    // Legacy home/thermostat/* topics only ever existed on the polled
+    // backend's reconnect path - the async backend subscribes the real
+    // set from its CONNECTED event
+    MQTT_SubscribeTopics();
+}
+
+void MQTT_Publish(const char* topic, const char* payload)
+{
+    if (!g_asyncConnected)
+    {
+#if LOG_RING_ENABLED == STD_ON
+        LogRing_Log(LOG_FMT_MQTT_PUB_NOCONN, 0, 0);
+#else
+        LOG_W(MQTT, "Publish failed: Not connected");
+#endif
+        return;
     }
-    else if (strcmp(topic, ROOM_TOPIC_AUTO_DIM) == 0) {
-        // Deprecated: Auto-dim control (maps to room mode)
-        Room_AutoDimMode_t autodim_mode = Room_Logic_ParseAutoDimMode(message);
-        if (autodim_mode != 0xFF) {  // Valid mode
-            Room_Logic_SetAutoDimMode(autodim_mode);  // This maps to AUTO/MANUAL mode
-            Serial.printf("[MQTT] Auto-dim set to: %s\n", 
-                         autodim_mode == ROOM_AUTO_DIM_ENABLED ? "ENABLED" : "DISABLED");
-            
-            // Publish mode status confirmation
-            Room_RTOS_PublishModeStatus();
-        } else {
-            Serial.printf("[MQTT] Invalid auto-dim command: %s\n", message);
-        }
+
+    // Enqueue to the outbox and return - the client task does the socket
+    // write, so a slow broker never stalls the publisher. QoS and retain
+    // come from the per-topic policy table.
+    const mqtt_pub_policy_t* pol = MQTT_FindPubPolicy(topic);
+    if (esp_mqtt_client_enqueue(g_asyncClient, topic, payload, 0,
+                                pol->qos, pol->retain ? 1 : 0, true) >= 0)
+    {
+#if LOG_RING_ENABLED == STD_ON
+        char pub_line[LOG_RING_STR_MAX];
+        snprintf(pub_line, sizeof(pub_line), "%s: %s", topic, payload);
+        LogRing_LogStr(LOG_FMT_MQTT_PUB_OK, pub_line, 0);
+#else
+        LOG_D(MQTT, "Published to %s: %s", topic, payload);
+#endif
     }
-    
-    // ========================================================================
-    // UNKNOWN TOPIC
-    // ========================================================================
-    
-    else {
-        Serial.printf("[MQTT] Unknown topic: %s\n", topic);
+    else
+    {
+#if LOG_RING_ENABLED == STD_ON
+        LogRing_Log(LOG_FMT_MQTT_PUB_FAIL, 0, 0);
+#else
+        LOG_W(MQTT, "Publish failed");
+#endif
+    }
+}
+
+void MQTT_PublishRetained(const char* topic, const char* payload)
+{
+    if (!g_asyncConnected)
+    {
+#if LOG_RING_ENABLED == STD_ON
+        LogRing_Log(LOG_FMT_MQTT_PUB_NOCONN, 0, 0);
+#else
+        LOG_W(MQTT, "Publish failed: Not connected");
+#endif
+        return;
+    }
+
+    // Same outbox path as MQTT_Publish with retain forced on; QoS still
+    // comes from the per-topic policy table
+    const mqtt_pub_policy_t* pol = MQTT_FindPubPolicy(topic);
+    if (esp_mqtt_client_enqueue(g_asyncClient, topic, payload, 0,
+                                pol->qos, 1, true) >= 0)
+    {
+#if LOG_RING_ENABLED == STD_ON
+        char pub_line[LOG_RING_STR_MAX];
+        snprintf(pub_line, sizeof(pub_line), "%s: %s", topic, payload);
+        LogRing_LogStr(LOG_FMT_MQTT_PUB_OK, pub_line, 0);
+#endif
+    }
+    else
+    {
+#if LOG_RING_ENABLED == STD_ON
+        LogRing_Log(LOG_FMT_MQTT_PUB_FAIL, 0, 0);
+#else
+        LOG_W(MQTT, "Publish failed");
+#endif
     }
 }
 
+void MQTT_PublishBinary(const char* topic, const uint8_t* payload, unsigned int length)
+{
+    if (!g_asyncConnected)
+    {
+#if LOG_RING_ENABLED == STD_ON
+        LogRing_Log(LOG_FMT_MQTT_PUB_NOCONN, 0, 0);
+#else
+        LOG_W(MQTT, "Publish failed: Not connected");
+#endif
+        return;
+    }
+
+    const mqtt_pub_policy_t* pol = MQTT_FindPubPolicy(topic);
+    if (esp_mqtt_client_enqueue(g_asyncClient, topic, (const char*)payload,
+                                (int)length, pol->qos, pol->retain ? 1 : 0,
+                                true) < 0)
+    {
+#if LOG_RING_ENABLED == STD_ON
+        LogRing_Log(LOG_FMT_MQTT_BIN_FAIL, 0, 0);
+#else
+        LOG_W(MQTT, "Binary publish failed");
+#endif
+    }
+}
+
+bool MQTT_IsConnected(void)
+{
+    return g_asyncConnected;
+}
+
+void MQTT_SubscribeTopics(void)
+{
+    if (g_asyncClient == NULL) return;
+
+    esp_mqtt_client_subscribe(g_asyncClient, MQTT_TOPIC_TARGET,    MQTT_ASYNC_QOS);
+    esp_mqtt_client_subscribe(g_asyncClient, MQTT_TOPIC_TEMP,      MQTT_ASYNC_QOS);
+    esp_mqtt_client_subscribe(g_asyncClient, MQTT_TOPIC_SET_SPEED, MQTT_ASYNC_QOS);
+    esp_mqtt_client_subscribe(g_asyncClient, MQTT_TOPIC_CONTROL,   MQTT_ASYNC_QOS);
+    esp_mqtt_client_subscribe(g_asyncClient, MQTT_TOPIC_HUMIDITY,  MQTT_ASYNC_QOS);
+
+    esp_mqtt_client_subscribe(g_asyncClient, ROOM_TOPIC_MODE_CTRL, MQTT_ASYNC_QOS);
+    esp_mqtt_client_subscribe(g_asyncClient, ROOM_TOPIC_LED1_CTRL, MQTT_ASYNC_QOS);
+    esp_mqtt_client_subscribe(g_asyncClient, ROOM_TOPIC_LED2_CTRL, MQTT_ASYNC_QOS);
+    esp_mqtt_client_subscribe(g_asyncClient, ROOM_TOPIC_AUTH_LOAD, MQTT_ASYNC_QOS);
+    esp_mqtt_client_subscribe(g_asyncClient, ROOM_TOPIC_CONFIG_SET, MQTT_ASYNC_QOS);
+    // esp_mqtt_client_subscribe(g_asyncClient, ROOM_TOPIC_AUTO_DIM, MQTT_ASYNC_QOS);
+
+    LOG_I(MQTT, "Subscribed to target & control topics");
+}
 
+#else /* MQTT_ASYNC_ENABLED == STD_OFF - polled PubSubClient backend */
 
 void MQTT_Init(const char* broker, int port)
 {
     g_broker = broker;
     g_port = port;
 
+    MQTT_SortDispatchTable();
+    MQTT_SortPubPolicyTable();
+
     mqttClient.setServer(g_broker, g_port);
     mqttClient.setCallback(MQTT_MessageCallback);
 }
@@ -252,7 +687,7 @@ void MQTT_Loop(void)
     if (WIFI_IsConnected())
     {
         if (!mqttClient.connected()) MQTT_Reconnect();
-        mqttClient.loop();
+        else mqttClient.loop();
     }
 }
 
@@ -270,22 +705,88 @@ void MQTT_SubscribeAll(void)
 
 void MQTT_Publish(const char* topic, const char* payload)
 {
-    if (!WIFI_IsConnected() || !mqttClient.connected()) 
+    if (!WIFI_IsConnected() || !mqttClient.connected())
+    {
+#if LOG_RING_ENABLED == STD_ON
+        LogRing_Log(LOG_FMT_MQTT_PUB_NOCONN, 0, 0);
+#else
+        LOG_W(MQTT, "Publish failed: Not connected");
+#endif
+        return;
+    }
+
+    // PubSubClient can only send QoS0 - the policy's retain flag still
+    // applies, and QoS1 delivery needs the async backend
+    const mqtt_pub_policy_t* pol = MQTT_FindPubPolicy(topic);
+    if (mqttClient.publish(topic, payload, pol->retain))
+    {
+#if LOG_RING_ENABLED == STD_ON
+        char pub_line[LOG_RING_STR_MAX];
+        snprintf(pub_line, sizeof(pub_line), "%s: %s", topic, payload);
+        LogRing_LogStr(LOG_FMT_MQTT_PUB_OK, pub_line, 0);
+#else
+        LOG_D(MQTT, "Published to %s: %s", topic, payload);
+#endif
+    }
+    else
+    {
+#if LOG_RING_ENABLED == STD_ON
+        LogRing_Log(LOG_FMT_MQTT_PUB_FAIL, 0, 0);
+#else
+        LOG_W(MQTT, "Publish failed");
+#endif
+    }
+}
+
+void MQTT_PublishRetained(const char* topic, const char* payload)
+{
+    if (!WIFI_IsConnected() || !mqttClient.connected())
     {
-        Serial.println("MQTT publish failed: Not connected");
+#if LOG_RING_ENABLED == STD_ON
+        LogRing_Log(LOG_FMT_MQTT_PUB_NOCONN, 0, 0);
+#else
+        LOG_W(MQTT, "Publish failed: Not connected");
+#endif
         return;
     }
 
-    if (mqttClient.publish(topic, payload))
+    if (mqttClient.publish(topic, payload, true))
     {
-        Serial.print("Published to ");
-        Serial.print(topic);
-        Serial.print(": ");
-        Serial.println(payload);
+#if LOG_RING_ENABLED == STD_ON
+        char pub_line[LOG_RING_STR_MAX];
+        snprintf(pub_line, sizeof(pub_line), "%s: %s", topic, payload);
+        LogRing_LogStr(LOG_FMT_MQTT_PUB_OK, pub_line, 0);
+#endif
     }
     else
     {
-        Serial.println("MQTT publish failed");
+#if LOG_RING_ENABLED == STD_ON
+        LogRing_Log(LOG_FMT_MQTT_PUB_FAIL, 0, 0);
+#else
+        LOG_W(MQTT, "Publish failed");
+#endif
+    }
+}
+
+void MQTT_PublishBinary(const char* topic, const uint8_t* payload, unsigned int length)
+{
+    if (!WIFI_IsConnected() || !mqttClient.connected())
+    {
+#if LOG_RING_ENABLED == STD_ON
+        LogRing_Log(LOG_FMT_MQTT_PUB_NOCONN, 0, 0);
+#else
+        LOG_W(MQTT, "Publish failed: Not connected");
+#endif
+        return;
+    }
+
+    if (!mqttClient.publish(topic, payload, length))
+    {
+#if LOG_RING_ENABLED == STD_ON
+        LogRing_Log(LOG_FMT_MQTT_BIN_FAIL, 0, 0);
+#else
+        LOG_W(MQTT, "Binary publish failed");
+#endif
     }
 }
 
@@ -307,31 +808,100 @@ void MQTT_SubscribeTopics(void)
         mqttClient.subscribe(ROOM_TOPIC_MODE_CTRL);
         mqttClient.subscribe(ROOM_TOPIC_LED1_CTRL);
         mqttClient.subscribe(ROOM_TOPIC_LED2_CTRL);
+        mqttClient.subscribe(ROOM_TOPIC_AUTH_LOAD);
+        mqttClient.subscribe(ROOM_TOPIC_CONFIG_SET);
     //    mqttClient.subscribe(ROOM_TOPIC_AUTO_DIM);
 
-        Serial.println("[MQTT] Subscribed to target & control topics");
+        LOG_I(MQTT, "Subscribed to target & control topics");
     }
 }
 
 
+// Reconnect backoff limits
+#define MQTT_BACKOFF_MIN_MS   1000UL
+#define MQTT_BACKOFF_MAX_MS   30000UL
+
+static unsigned long g_lastAttemptMs = 0;
+static unsigned long g_backoffMs = MQTT_BACKOFF_MIN_MS;
+
+/**
+ * @brief Non-blocking reconnect attempt, called from MQTT_Loop
+ *
+ * Makes at most one connect attempt per call and only after the current
+ * backoff window expired, so Task_Mqtt keeps running (and telemetry keeps
+ * queuing) during a broker outage instead of spinning in delay().
+ */
 static void MQTT_Reconnect(void)
 {
-    while (!mqttClient.connected())
+    unsigned long now = millis();
+
+    // Still inside the backoff window - try again later
+    if (now - g_lastAttemptMs < g_backoffMs) {
+        return;
+    }
+    g_lastAttemptMs = now;
+
+    String id = "ESP32-" + String(random(0xffff), HEX);
+    // Register the last will with the session so the broker flips the
+    // retained presence document to offline if we die
+    if (mqttClient.connect(id.c_str(), MQTT_TOPIC_PRESENCE, 1, true,
+                           MQTT_PRESENCE_OFFLINE))
     {
-        if (!WIFI_IsConnected())
-        {
-            delay(1000); // Wait until WiFi reconnects
-            continue;
+        LOG_I(MQTT, "Reconnected");
+        MQTT_SubscribeAll();
+        MQTT_PublishPresence();  // Overwrite the retained offline doc
+        g_backoffMs = MQTT_BACKOFF_MIN_MS;  // Reset backoff on success
+    }
+    else
+    {
+        // Exponential backoff, capped
+        g_backoffMs *= 2;
+        if (g_backoffMs > MQTT_BACKOFF_MAX_MS) {
+            g_backoffMs = MQTT_BACKOFF_MAX_MS;
         }
+        LOG_W(MQTT, "Connect failed, retry in %lu ms", g_backoffMs);
+    }
+}
 
-        String id = "ESP32-" + String(random(0xffff), HEX);
-        if (mqttClient.connect(id.c_str()))
-        {
-            MQTT_SubscribeAll();
-        }
-        else
-        {
-            delay(2000);
-        }
+#endif /* MQTT_ASYNC_ENABLED */
+
+// ============================================================================
+// Presence heartbeat (shared by both backends)
+// ============================================================================
+
+/**
+ * @brief Publish the retained presence heartbeat
+ *
+ * One compact retained document on MQTT_TOPIC_PRESENCE carrying the
+ * uptime/heap figures the serial system-info dump already gathers.
+ * The LWT registered at connect overwrites it with
+ * {"state":"offline"} when the broker loses the session, so fleet
+ * liveness is event-driven instead of inferred from stale telemetry.
+ */
+void MQTT_PublishPresence(void)
+{
+    char json[128];
+    snprintf(json, sizeof(json),
+             "{\"state\":\"online\",\"uptime_s\":%lu,"
+             "\"heap\":%u,\"min_heap\":%u}",
+             (unsigned long)(millis() / 1000UL),
+             (unsigned)ESP.getFreeHeap(),
+             (unsigned)ESP.getMinFreeHeap());
+    MQTT_Publish(MQTT_TOPIC_PRESENCE, json);
+}
+
+/**
+ * @brief Rate-limited heartbeat refresh - call from the MQTT service loop
+ */
+void MQTT_PresenceService(void)
+{
+    static uint32_t lastPublishMs = 0;
+
+    uint32_t now = millis();
+    if (lastPublishMs != 0 && now - lastPublishMs < PRESENCE_HEARTBEAT_MS) {
+        return;
     }
+    lastPublishMs = now;
+
+    MQTT_PublishPresence();
 }
@@ -7,8 +7,10 @@
 typedef enum {
     MQTT_PUB_TEMP,
     MQTT_PUB_TARGET,
-    MQTT_PUB_HUM
+    MQTT_PUB_HUM,
+    MQTT_PUB_FAN,        // Fan speed bucket - pushed on real transitions only
 
+    MQTT_PUB_TYPE_COUNT  // Keep last - used for batch arrays
 } mqtt_pub_type_t;
 
 typedef struct {
@@ -16,12 +18,43 @@ typedef struct {
     float value;
 } mqtt_pub_msg_t;
 
+/**
+ * @brief Binary telemetry record (wire format, version 1)
+ *
+ * Published on MQTT_TOPIC_TELEMETRY_BIN when MQTT_BINARY_TELEMETRY is
+ * STD_ON - one packed record per pending field, concatenated into a
+ * single message. Values are fixed-point x100 (0.01 resolution covers
+ * every metric we ship), timestamps are millis() so the backend can
+ * order records from one device without parsing floats.
+ */
+typedef struct __attribute__((packed)) {
+    uint8_t  version;       // TELEMETRY_BIN_VERSION
+    uint16_t device_id;     // TELEMETRY_DEVICE_ID (room number)
+    uint8_t  field;         // mqtt_pub_type_t
+    int32_t  value_x100;    // Fixed-point value * 100
+    uint32_t timestamp_ms;  // Monotonic millis() at publish
+} mqtt_bin_record_t;
+
 void MQTT_Init(const char* broker, int port);
 void MQTT_Task_Init(void);
 void MQTT_SubscribeTopics(void);
 void MQTT_Loop(void);
 void MQTT_SubscribeAll(void);
 void MQTT_Publish(const char* topic, const char* payload);  // ← Make sure this line exists
+void MQTT_PublishRetained(const char* topic, const char* payload);
+void MQTT_PublishPresence(void);
+void MQTT_PresenceService(void);
+void MQTT_PublishBinary(const char* topic, const uint8_t* payload, unsigned int length);
 bool MQTT_IsConnected(void);
 
+#if BOOT_BENCH_ENABLED == STD_ON
+/**
+ * @brief Dispatch-table lookup for the boot benchmark
+ * @return true if the topic resolved to a handler
+ * @note Sorts the table on first use so the benchmark can run before
+ *       MQTT_Init; the sort is idempotent when MQTT_Init repeats it.
+ */
+bool MQTT_BenchLookup(const char* topic);
+#endif
+
 #endif // MQTT_H
\ No newline at end of file
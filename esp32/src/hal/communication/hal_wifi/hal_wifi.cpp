@@ -3,6 +3,7 @@
 #include "../../../app_cfg.h"
 #include "hal_wifi.h"
 #include "../hal_mqtt/hal_mqtt.h"
+#include "../../../app/common/app_config.h"
 
 #if WIFI_DEBUG == STD_ON
 #define DEBUG_PRINTLN(var) Serial.println(var)
@@ -19,7 +20,11 @@ void onWifiConnected(void)
     
     // Initialize MQTT only when WiFi is connected
     if (!mqttInitialized) {
+#if CONFIG_CACHE_ENABLED == STD_ON
+        MQTT_Init(Config_Get()->mqtt_broker, Config_Get()->mqtt_port);
+#else
         MQTT_Init(MQTT_BROKER, MQTT_PORT);
+#endif
         mqttInitialized = true;
     }
 }
@@ -32,10 +37,20 @@ void onWifiDisconnected(void)
 
 static WIFI_Config_t g_wifiCfg = {
     .ssid = WIFI_SSID,
-    .password = WIFI_SSID,
+    .password = WIFI_PASSWORD,
     .reconnect_interval_ms = 5000,
     .on_connect = NULL,  // Change these to NULL
-    .on_disconnect = NULL
+    .on_disconnect = NULL,
+    .fast_reconnect = (WIFI_FAST_RECONNECT == STD_ON),
+#if WIFI_STATIC_IP_ENABLED == STD_ON
+    .static_ip = WIFI_STATIC_IP,
+    .static_gateway = WIFI_STATIC_GATEWAY,
+    .static_subnet = WIFI_STATIC_SUBNET
+#else
+    .static_ip = NULL,
+    .static_gateway = NULL,
+    .static_subnet = NULL
+#endif
 };
 
 static WIFI_Status_t g_wifiStatus = WIFI_STATUS_DISCONNECTED;
@@ -44,6 +59,34 @@ static unsigned long g_connectStartTime = 0;
 
 #define WIFI_CONNECT_TIMEOUT_MS 15000
 
+// ==================== FAST RECONNECT CACHE ====================
+// Last known AP kept in RTC slow memory (same pattern as the
+// store-and-forward ring), so even a reset skips the channel scan.
+// A failed fast attempt clears the magic and the next try scans again.
+#define WIFI_AP_CACHE_MAGIC  0x57415043UL  // "WAPC"
+
+RTC_NOINIT_ATTR static uint8_t  g_apBssid[6];
+RTC_NOINIT_ATTR static int32_t  g_apChannel;
+RTC_NOINIT_ATTR static uint32_t g_apMagic;
+
+static bool g_fastAttempt = false;
+
+static void WIFI_CacheAP(void)
+{
+    const uint8_t *bssid = WiFi.BSSID();
+    if (bssid == NULL)
+        return;
+
+    memcpy((void *)g_apBssid, bssid, sizeof(g_apBssid));
+    g_apChannel = WiFi.channel();
+    g_apMagic = WIFI_AP_CACHE_MAGIC;
+}
+
+static void WIFI_InvalidateAPCache(void)
+{
+    g_apMagic = 0;
+}
+
 static void WIFI_StartConnection(void)
 {
     if (g_wifiCfg.ssid == NULL || g_wifiCfg.password == NULL)
@@ -56,7 +99,37 @@ static void WIFI_StartConnection(void)
     delay(100);
 
     WiFi.mode(WIFI_STA);
-    WiFi.begin(g_wifiCfg.ssid, g_wifiCfg.password);
+
+    // Static addressing skips the DHCP exchange on every (re)connect
+    if (g_wifiCfg.static_ip != NULL)
+    {
+        IPAddress ip, gateway, subnet;
+        if (ip.fromString(g_wifiCfg.static_ip) &&
+            gateway.fromString(g_wifiCfg.static_gateway) &&
+            subnet.fromString(g_wifiCfg.static_subnet))
+        {
+            WiFi.config(ip, gateway, subnet);
+        }
+        else
+        {
+            Serial.println("[ERROR] Invalid static IP config, using DHCP");
+        }
+    }
+
+    if (g_wifiCfg.fast_reconnect && g_apMagic == WIFI_AP_CACHE_MAGIC)
+    {
+        // Rejoin the cached AP directly on its known channel - no scan
+        DEBUG_PRINTLN("WiFi fast reconnect (cached BSSID/channel)");
+        WiFi.begin(g_wifiCfg.ssid, g_wifiCfg.password,
+                   g_apChannel, (const uint8_t *)g_apBssid);
+        g_fastAttempt = true;
+    }
+    else
+    {
+        WiFi.begin(g_wifiCfg.ssid, g_wifiCfg.password);
+        g_fastAttempt = false;
+    }
+
     g_wifiStatus = WIFI_STATUS_CONNECTING;
     g_connectStartTime = millis();
 }
@@ -81,9 +154,10 @@ void WIFI_Process(void)
             
             if (WiFi.status() == WL_CONNECTED) {
                 g_wifiStatus = WIFI_STATUS_CONNECTED;
+                WIFI_CacheAP();
                 Serial.print("WiFi connected! IP: ");
                 Serial.println(WiFi.localIP());
-                
+
                 if (g_wifiCfg.on_connect)
                     g_wifiCfg.on_connect();
             }
@@ -91,12 +165,22 @@ void WIFI_Process(void)
         else if (st == WL_CONNECT_FAILED ||
                  st == WL_NO_SSID_AVAIL)
         {
+            if (g_fastAttempt)
+            {
+                // Cached AP gone (rebooted router, channel change) -
+                // fall back to a full scan on the next attempt
+                WIFI_InvalidateAPCache();
+            }
             g_wifiStatus = WIFI_STATUS_DISCONNECTED;
             g_lastReconnectAttempt = millis();
         }
         else if (millis() - g_connectStartTime >= WIFI_CONNECT_TIMEOUT_MS)
         {
             DEBUG_PRINTLN("WiFi connection timeout");
+            if (g_fastAttempt)
+            {
+                WIFI_InvalidateAPCache();
+            }
             WiFi.disconnect(false, false);
             g_wifiStatus = WIFI_STATUS_DISCONNECTED;
             g_lastReconnectAttempt = millis();
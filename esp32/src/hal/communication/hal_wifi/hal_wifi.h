@@ -29,6 +29,17 @@ typedef struct
     WIFI_Callback_t on_connect;
     WIFI_Callback_t on_disconnect;
 
+    // Fast reconnect: rejoin the last AP by cached BSSID/channel
+    // (RTC memory, survives reset) instead of a full scan. Falls back
+    // to scanning automatically when the cached AP stops answering.
+    bool fast_reconnect;
+
+    // Optional static addressing - skips DHCP on every (re)connect.
+    // NULL means DHCP.
+    const char *static_ip;
+    const char *static_gateway;
+    const char *static_subnet;
+
 } WIFI_Config_t;
 
 void WIFI_Init_(const WIFI_Config_t *config);
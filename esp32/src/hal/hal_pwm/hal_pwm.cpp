@@ -16,6 +16,13 @@
     extern "C" {
         #include "esp32-hal-ledc.h"
     }
+    #include "driver/ledc.h"
+
+    // Arduino LEDC channel numbering: 0-7 high speed, 8-15 low speed
+    #define PWM_SPEED_MODE(ch)   ((ch) < 8 ? LEDC_HIGH_SPEED_MODE : LEDC_LOW_SPEED_MODE)
+    #define PWM_LEDC_CHANNEL(ch) ((ledc_channel_t)((ch) % 8))
+
+    static bool pwm_fade_installed = false;
 #endif
 
 
@@ -49,3 +56,38 @@ void PWM_SetFrequency(PWM_Channel_t channel, uint32_t frequency)
     #error "PWM not implemented for this platform"
 #endif
 }
+
+void PWM_FadeInit(void)
+{
+#if defined(ESP32)
+    // Install the LEDC fade service once; fades then run entirely in
+    // the peripheral with no CPU involvement between endpoints
+    if (!pwm_fade_installed) {
+        if (ledc_fade_func_install(0) == ESP_OK) {
+            pwm_fade_installed = true;
+        }
+    }
+#else
+    #error "PWM not implemented for this platform"
+#endif
+}
+
+void PWM_Fade(PWM_Channel_t channel, uint32_t target, uint32_t fade_ms)
+{
+#if defined(ESP32)
+    if (!pwm_fade_installed) {
+        // Fade service unavailable - fall back to an immediate write
+        ledcWrite(channel, target);
+        return;
+    }
+
+    ledc_mode_t mode = PWM_SPEED_MODE(channel);
+    ledc_channel_t ch = PWM_LEDC_CHANNEL(channel);
+
+    // A new fade command supersedes any fade still in progress
+    ledc_set_fade_with_time(mode, ch, target, fade_ms);
+    ledc_fade_start(mode, ch, LEDC_FADE_NO_WAIT);
+#else
+    #error "PWM not implemented for this platform"
+#endif
+}
@@ -10,6 +10,8 @@ typedef uint8_t PWM_Channel_t;
 void PWM_Init(PWM_Channel_t channel, uint8_t pin, uint32_t frequency, uint8_t resolution);
 void PWM_Write(PWM_Channel_t channel, uint8_t value);
 void PWM_SetFrequency(PWM_Channel_t channel, uint32_t frequency);
+void PWM_FadeInit(void);
+void PWM_Fade(PWM_Channel_t channel, uint32_t target, uint32_t fade_ms);
 
 #endif // HAL_PWM_H
 
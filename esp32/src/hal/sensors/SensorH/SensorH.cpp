@@ -8,6 +8,100 @@
 #define DEBUG_PRINTLN(var)
 #endif
 
+/* =========================
+ * ADC Sampler Engine
+ * =========================
+ * LDR, MQ5 and potentiometer each did blocking analogRead calls from
+ * their own tasks, serializing on the single ADC. The engine moves all
+ * sampling onto one low-priority task instead: it polls every
+ * registered channel on a fixed cadence, folds each reading into a
+ * per-channel EMA, and SensorH_GetFiltered() is a plain array read.
+ * Channels register themselves through SensorH_Init. (The continuous-
+ * DMA driver would cycle the channels in hardware, but its API only
+ * exists in Arduino core 3.x and the pinned espressif32 platform
+ * ships core 2.x.)
+ */
+#if ADC_ENGINE_ENABLED == STD_ON
+
+typedef struct
+{
+    uint8_t  pin;
+    uint16_t ema;        // Filtered value, alpha = 1/2^ADC_ENGINE_EMA_SHIFT
+    bool     primed;     // EMA seeded with the first sample
+} AdcEngineChannel_t;
+
+static AdcEngineChannel_t s_channels[ADC_ENGINE_MAX_CHANNELS];
+static uint8_t            s_channelCount = 0;
+static TaskHandle_t       adcEngineTaskHandle = NULL;
+
+/**
+ * @brief Task: sample every registered channel and fold into its EMA
+ *
+ * One read per channel per tick; the EMA across ticks is what tames
+ * the noisy LDR divider, and at ADC_ENGINE_SAMPLE_MS cadence it still
+ * oversamples far beyond what the consumers poll at.
+ */
+static void Task_AdcEngine(void* pvParameters)
+{
+    (void)pvParameters;
+
+    while (1) {
+        for (uint8_t c = 0; c < s_channelCount; c++) {
+            uint16_t sample = (uint16_t)analogRead(s_channels[c].pin);
+            if (!s_channels[c].primed) {
+                s_channels[c].ema = sample;
+                s_channels[c].primed = true;
+            } else {
+                s_channels[c].ema += ((int16_t)(sample - s_channels[c].ema))
+                                     >> ADC_ENGINE_EMA_SHIFT;
+            }
+        }
+        vTaskDelay(pdMS_TO_TICKS(ADC_ENGINE_SAMPLE_MS));
+    }
+}
+
+/**
+ * @brief Register a channel with the engine (idempotent per pin)
+ *
+ * The first registration also creates the sampler task; later ones
+ * just extend the channel table it walks.
+ */
+static void AdcEngine_AddChannel(uint8_t pin)
+{
+    for (uint8_t i = 0; i < s_channelCount; i++) {
+        if (s_channels[i].pin == pin) {
+            return;
+        }
+    }
+    if (s_channelCount >= ADC_ENGINE_MAX_CHANNELS) {
+        Serial.println("[ERROR] ADC engine channel table full!");
+        return;
+    }
+
+    s_channels[s_channelCount].pin = pin;
+    s_channels[s_channelCount].ema = 0;
+    s_channels[s_channelCount].primed = false;
+    s_channelCount++;
+
+    if (adcEngineTaskHandle == NULL) {
+        BaseType_t result = xTaskCreate(
+            Task_AdcEngine,
+            "AdcEngine",
+            ADC_ENGINE_TASK_STACK_SIZE,
+            NULL,
+            ADC_ENGINE_TASK_PRIORITY,
+            &adcEngineTaskHandle
+        );
+        if (result != pdPASS) {
+            Serial.println("[ERROR] Failed to create ADC engine task!");
+            return;
+        }
+    }
+
+    DEBUG_PRINTLN("ADC engine sampling " + String(s_channelCount) + " channel(s)");
+}
+#endif /* ADC_ENGINE_ENABLED */
+
 void SensorH_Init( SensorH_t  *config)
 {
 #if SENSORH_ENABLED == STD_ON
@@ -17,6 +111,10 @@ void SensorH_Init( SensorH_t  *config)
     DEBUG_PRINTLN("Resolution: " + String(config->resolution));
     analogReadResolution(config->resolution);
 
+#if ADC_ENGINE_ENABLED == STD_ON
+    AdcEngine_AddChannel(config->channel);
+#endif
+
 #endif
 }
 
@@ -27,4 +125,21 @@ uint32_t SensorH_ReadValue(uint8_t channel)
     DEBUG_PRINTLN("Read Value from channel " + String(channel) + ": " + String(rawValue));
     return rawValue;
 #endif
-}
\ No newline at end of file
+}
+
+uint16_t SensorH_GetFiltered(uint8_t channel)
+{
+#if SENSORH_ENABLED == STD_ON
+#if ADC_ENGINE_ENABLED == STD_ON
+    for (uint8_t i = 0; i < s_channelCount; i++) {
+        if (s_channels[i].pin == channel && s_channels[i].primed) {
+            return s_channels[i].ema;
+        }
+    }
+#endif
+    // Engine disabled or channel not sampled yet - one-shot fallback
+    return (uint16_t)SensorH_ReadValue(channel);
+#else
+    return 0;
+#endif
+}
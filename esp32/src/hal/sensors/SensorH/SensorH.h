@@ -10,5 +10,6 @@ typedef struct
 
 void SensorH_Init( SensorH_t *config);
 uint32_t SensorH_ReadValue(uint8_t channel);
+uint16_t SensorH_GetFiltered(uint8_t channel);
 
 #endif
\ No newline at end of file
@@ -0,0 +1,109 @@
+#ifndef SENSOR_FRAMEWORK_H
+#define SENSOR_FRAMEWORK_H
+
+#include <stdint.h>
+#include "../../../app_cfg.h"
+#include "../../../app/common/report_policy.h"
+
+/*
+ * Compile-time sensor framework (CRTP) on top of the SensorH layer.
+ *
+ * Each sensor is a struct deriving from Sensor<Itself> and provides
+ * static members - no objects, no vtables, every hook resolves at
+ * compile time and inlines into the poll loop:
+ *
+ *   static const char*  name();            diagnostic label
+ *   static float        sample();          raw acquisition (HAL call)
+ *   static const ReportPolicy_t& policy(); deadband/rate/heartbeat
+ *   static void         onReport(float);   fires when the policy says so
+ *
+ * Optional (the base supplies defaults the sensor may shadow):
+ *
+ *   static bool   ready();                 warm-up gate (default true)
+ *   static float  convert(float raw);      unit mapping (default identity)
+ *   static void   onSample(float);         every poll - history feeds
+ *   kEmaShift                              extra smoothing, 0 = off
+ *                                          (analog pins are already
+ *                                          EMA-filtered by the ADC
+ *                                          engine in SensorH.cpp)
+ *
+ * SensorList<...> walks a type list, so one scheduler job services the
+ * whole set. Adding a sensor (CO2, occupancy) is one struct plus one
+ * type-list entry - no new task, stack or queue plumbing.
+ */
+
+namespace sensorh {
+
+template <typename Derived>
+struct Sensor {
+    // Defaults - a sensor shadows the ones it needs
+    static constexpr uint8_t kEmaShift = 0;
+
+    static bool ready() { return true; }
+    static float convert(float raw) { return raw; }
+    static void onSample(float) {}
+
+    /**
+     * @brief Last filtered value seen by poll()
+     * @note Function-static so each sensor type gets its own slot
+     *       without out-of-line template member definitions.
+     */
+    static float& value() {
+        static float v = 0.0f;
+        return v;
+    }
+
+    /**
+     * @brief One acquisition cycle: sample, convert, filter, report
+     */
+    static void poll(uint32_t now_ms) {
+        if (!Derived::ready()) {
+            return;  // Warming up / calibrating - readings are junk
+        }
+
+        float v = Derived::convert(Derived::sample());
+
+        if (Derived::kEmaShift > 0) {
+            static bool primed = false;
+            float& f = value();
+            if (!primed) {
+                f = v;
+                primed = true;
+            } else {
+                f += (v - f) / (float)(1u << Derived::kEmaShift);
+            }
+            v = f;
+        } else {
+            value() = v;
+        }
+
+        Derived::onSample(v);
+
+        static ReportState_t state = {};
+        if (Report_ShouldPublish(&Derived::policy(), &state, v, now_ms)) {
+            Derived::onReport(v);
+        }
+    }
+};
+
+// Compile-time sensor list - recursion unrolls at compile time into a
+// flat sequence of inlined poll() calls
+template <typename... Sensors>
+struct SensorList;
+
+template <>
+struct SensorList<> {
+    static void pollAll(uint32_t) {}
+};
+
+template <typename First, typename... Rest>
+struct SensorList<First, Rest...> {
+    static void pollAll(uint32_t now_ms) {
+        First::poll(now_ms);
+        SensorList<Rest...>::pollAll(now_ms);
+    }
+};
+
+}  // namespace sensorh
+
+#endif /* SENSOR_FRAMEWORK_H */
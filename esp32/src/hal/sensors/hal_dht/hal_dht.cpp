@@ -3,23 +3,96 @@
 #include "../../../app_cfg.h"
 #include "hal_dht.h"
 
-#if DHT22_DEBUG == STD_ON
+#if DHT22_DEBUG == STD_ON && LOG_LEVEL_GLOBAL >= LOG_LEVEL_DEBUG
 #define DEBUG_PRINTLN(var) Serial.println(var)
 #else
 #define DEBUG_PRINTLN(var)
 #endif
 
-static double temp = 0.0;
-
 // Declare DHT object globally (outside function)
 #if DHT22_ENABLED==STD_ON
 DHT dht22(DHT22_PIN, DHT22);
+
+/* =========================
+ * Read Cache
+ * =========================
+ * The DHT22 bit-bangs its wire protocol with interrupts disabled for
+ * ~5 ms per read and cannot be sampled faster than 0.5 Hz. Every
+ * caller used to pay that cost (twice - temperature and humidity were
+ * separate reads). A background task now refreshes both values in one
+ * sensor transaction and the Read* functions just return the cached
+ * pair - no locking needed, each field is a single aligned 32-bit
+ * volatile write/read.
+ */
+static volatile float    s_cachedTempC    = 0.0f;
+static volatile float    s_cachedTempF    = 0.0f;
+static volatile float    s_cachedHumidity = 0.0f;
+static volatile uint32_t s_cacheTimeMs    = 0;
+static volatile bool     s_cacheValid     = false;
+
+static TaskHandle_t dhtTaskHandle = NULL;
+
+/**
+ * @brief Task: Refresh the DHT22 cache periodically
+ *
+ * readTemperature() triggers the sensor transaction; the library
+ * serves readTemperature(true) and readHumidity() from the same
+ * sample, so the pair is always consistent.
+ */
+static void Task_DHT22Refresh(void* pvParameters) {
+    (void)pvParameters;
+
+    while (1) {
+        float tempc = dht22.readTemperature();
+        float tempf = dht22.readTemperature(true);
+        float humi  = dht22.readHumidity();
+
+        if (isnan(tempc) || isnan(humi)) {
+            Serial.println("[ERROR] DHT22 refresh failed!");
+        } else {
+            s_cachedTempC    = tempc;
+            s_cachedTempF    = tempf;
+            s_cachedHumidity = humi;
+            s_cacheTimeMs    = millis();
+            s_cacheValid     = true;
+
+            DEBUG_PRINTLN("[SENSOR] DHT22 cache: " + String(tempc) +
+                          " °C / " + String(humi) + "%");
+        }
+
+        vTaskDelay(pdMS_TO_TICKS(DHT22_CACHE_REFRESH_MS));
+    }
+}
+
+/**
+ * @brief Check that the cache holds a recent reading
+ */
+static bool DHT22_CacheFresh(void) {
+    if (!s_cacheValid) {
+        return false;
+    }
+    return (millis() - s_cacheTimeMs) < DHT22_CACHE_MAX_AGE_MS;
+}
 #endif
 
 void DHT22_INIT(void)
 {
 #if DHT22_ENABLED==STD_ON
   dht22.begin();
+
+  if (dhtTaskHandle == NULL) {
+      BaseType_t result = xTaskCreate(
+          Task_DHT22Refresh,
+          "DHT22Refresh",
+          DHT22_TASK_STACK_SIZE,
+          NULL,
+          DHT22_TASK_PRIORITY,
+          &dhtTaskHandle
+      );
+      if (result != pdPASS) {
+          Serial.println("[ERROR] Failed to create DHT22 refresh task!");
+      }
+  }
 #endif
 }
 
@@ -27,55 +100,32 @@ void DHT22_INIT(void)
 float ReadTemperatureSensor() {
 
   #if DHT22_ENABLED==STD_ON
-  float tempc = dht22.readTemperature(); // Returns temperature in Celsius
-  
-  // Check if reading failed
-  if (isnan(tempc)) {
+  // Lock-free cache read - the refresh task owns the sensor
+  if (!DHT22_CacheFresh()) {
     Serial.println("[ERROR] Failed to read temperatureF!");
     return 0.0;  // Return default value on error
   }
-  else{
-  Serial.print("[SENSOR] TemperatureF: ");
-  Serial.print(tempc);
-  Serial.println(" °C");
-}
-  return tempc;
+  return s_cachedTempC;
   #endif
 }
 
 float ReadTemperatureSensorF() {
   #if DHT22_ENABLED==STD_ON
-  float tempf = dht22.readTemperature(true);  // Returns temperature in Celsius
-  
-  // Check if reading failed
-  if (isnan(tempf)) {
+  if (!DHT22_CacheFresh()) {
     Serial.println("[ERROR] Failed to read temperature!");
     return 0.0;  // Return default value on error
   }
-  else{
-  Serial.print("[SENSOR] Temperature: ");
-  Serial.print(tempf);
-  Serial.println(" °F");
-}
-  return tempf;
+  return s_cachedTempF;
 #endif
 }
 
 
 float ReadHumiditySensor() {
   #if DHT22_ENABLED==STD_ON
-  float humi = dht22.readHumidity(); // Returns temperature in Celsius
-  
-  // Check if reading failed
-  if (isnan(humi)) {
+  if (!DHT22_CacheFresh()) {
     Serial.println("[ERROR] Failed to read Humidity!");
     return 0.0;  // Return default value on error
   }
-  else{
-  Serial.print("[SENSOR] humidity: ");
-  Serial.print(humi);
-  Serial.println("%");
-}
-  return humi;
+  return s_cachedHumidity;
   #endif
-}
\ No newline at end of file
+}
@@ -33,7 +33,8 @@ void LDR_1_main(void)
     if (millis() - lastReadTime >= READ_INTERVAL) {
         lastReadTime = millis();
         
-        rawLdrValue = SensorH_ReadValue(config.channel);
+        // Non-blocking: the ADC engine samples the channel in DMA mode
+        rawLdrValue = SensorH_GetFiltered(config.channel);
         rawLdrValue = constrain(rawLdrValue, ADC_MIN_RAW, ADC_MAX_RAW);
         
         // Map to percentage (0-100%) or keep raw value
@@ -58,12 +59,18 @@ uint16_t LDR_1_getRawValue(void)
 
 uint16_t LDR_1_getAveragedValue(void)
 {
+#if ADC_ENGINE_ENABLED == STD_ON
+    // The engine samples continuously and EMA-filters across reads -
+    // far more oversampling than the old 5x blocking loop
+    return SensorH_GetFiltered(config.channel);
+#else
     uint32_t sum = 0;
     for (uint8_t i = 0; i < LDR_SAMPLE_COUNT; i++) {
         sum += SensorH_ReadValue(config.channel);
         delay(10);
     }
     return sum / LDR_SAMPLE_COUNT;
+#endif
 }
 
 float LDR_1_calculateLux(void)
@@ -3,7 +3,7 @@
 #include "../SensorH/SensorH.h"
 #include "hal_mq5.h"
 
-#if MQ5_1_DEBUG == STD_ON
+#if MQ5_1_DEBUG == STD_ON && LOG_LEVEL_GLOBAL >= LOG_LEVEL_DEBUG
 #define DEBUG_PRINTLN(var) Serial.println(var)
 #define DEBUG_PRINT(var) Serial.print(var)
 #else
@@ -16,10 +16,23 @@ static  SensorH_t config = {MQ5_PIN, ADC_RESOLUTION};
 
 static uint16_t MQ5_value;
 static uint16_t outputValue;
+
+// Warm-up state machine. Filtering itself lives in the ADC engine
+// (SensorH folds every DMA frame into the channel EMA); this layer only
+// decides when that filtered value is trustworthy.
+static MQ5_State_t s_state = MQ5_STATE_WARMING;
+static unsigned long s_initMs;
+static unsigned long s_calibStartMs;
+static uint32_t s_calibSum;
+static uint16_t s_calibCount;
+static uint16_t s_baseline;
+
 void MQ5_1_init(void)
 {
 #if MQ5_1_ENABLED == STD_ON
     SensorH_Init(&config);
+    s_initMs = millis();
+    s_state = MQ5_STATE_WARMING;
 #endif
 }
 
@@ -28,15 +41,42 @@ void MQ5_1_main(void)
 #if  MQ5_1_ENABLED == STD_ON
     static unsigned long lastReadTime = 0;
     const unsigned long READ_INTERVAL = 1000;
-    
+
     if (millis() - lastReadTime >= READ_INTERVAL) {
         lastReadTime = millis();
-        MQ5_value = SensorH_ReadValue(config.channel);
+        // Non-blocking: the ADC engine samples the channel in DMA mode
+        MQ5_value = SensorH_GetFiltered(config.channel);
         MQ5_value = constrain(MQ5_value, MQ5_MIN_RAW, MQ5_MAX_RAW);
-        outputValue = map(MQ5_value, MQ5_MIN_RAW, MQ5_MAX_RAW, 
+        outputValue = map(MQ5_value, MQ5_MIN_RAW, MQ5_MAX_RAW,
                   MQ5_MIN_MAPPED, MQ5_MAX_MAPPED);
-        DEBUG_PRINT("MQ5 Value: ");
-        DEBUG_PRINTLN(outputValue);
+
+        switch (s_state) {
+            case MQ5_STATE_WARMING:
+                if (millis() - s_initMs >= MQ5_WARMUP_MS) {
+                    s_state = MQ5_STATE_CALIBRATING;
+                    s_calibStartMs = millis();
+                    s_calibSum = 0;
+                    s_calibCount = 0;
+                    DEBUG_PRINTLN("MQ5: heater warm, calibrating baseline");
+                }
+                break;
+
+            case MQ5_STATE_CALIBRATING:
+                s_calibSum += outputValue;
+                s_calibCount++;
+                if (millis() - s_calibStartMs >= MQ5_CALIBRATION_MS) {
+                    s_baseline = (uint16_t)(s_calibSum / s_calibCount);
+                    s_state = MQ5_STATE_READY;
+                    DEBUG_PRINT("MQ5: ready, baseline = ");
+                    DEBUG_PRINTLN(s_baseline);
+                }
+                break;
+
+            case MQ5_STATE_READY:
+                DEBUG_PRINT("MQ5 Value: ");
+                DEBUG_PRINTLN(outputValue);
+                break;
+        }
     }
 #endif
 }
@@ -48,4 +88,23 @@ uint16_t MQ5_1_value(void)
     #else
     return 0xFFFF;  // Indicate error if MQ5_1 is disabled
 #endif
-}
\ No newline at end of file
+}
+
+MQ5_State_t MQ5_1_state(void)
+{
+    return s_state;
+}
+
+bool MQ5_1_ready(void)
+{
+#if MQ5_1_ENABLED == STD_ON
+    return s_state == MQ5_STATE_READY;
+#else
+    return false;
+#endif
+}
+
+uint16_t MQ5_1_baseline(void)
+{
+    return s_baseline;
+}
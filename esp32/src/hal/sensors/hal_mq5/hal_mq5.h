@@ -1,9 +1,32 @@
 #ifndef HAL_MQ5_H
 #define HAL_MQ5_H
 
+/**
+ * @brief MQ5 readiness state machine
+ *
+ * The MQ5 heater needs minutes to stabilize after power-on and the raw
+ * signal drifts the whole time, so readings are gated: WARMING until the
+ * heater window elapses, CALIBRATING while a clean-air baseline is
+ * averaged, READY after that. Consumers should not publish (or alarm on)
+ * values before MQ5_1_ready() returns true.
+ */
+typedef enum {
+    MQ5_STATE_WARMING,      // Heater stabilizing - readings are junk
+    MQ5_STATE_CALIBRATING,  // Averaging the clean-air baseline
+    MQ5_STATE_READY         // Baseline set, values are meaningful
+} MQ5_State_t;
+
 void MQ5_1_init(void);
 void MQ5_1_main(void);
 
 uint16_t MQ5_1_value(void);
 
+MQ5_State_t MQ5_1_state(void);
+bool MQ5_1_ready(void);
+
+/**
+ * @brief Clean-air baseline in mapped units (valid once READY)
+ */
+uint16_t MQ5_1_baseline(void);
+
 #endif
@@ -26,7 +26,8 @@ void POT_init(void)
 void POT_main(void)
 {
 #if POT_ENABLED == STD_ON
-    pot_value = SensorH_ReadValue(config.channel);
+    // Non-blocking: the ADC engine samples the channel in DMA mode
+    pot_value = SensorH_GetFiltered(config.channel);
     DEBUG_PRINT("POT Value: ");
     DEBUG_PRINTLN(pot_value);
     delay(1000);
@@ -1,10 +1,11 @@
 #include <Arduino.h>
 #include <SPI.h>
 #include <MFRC522.h>
+#include "../../../app_cfg.h"
 #include "hal_rfid.h"
 
 
-#if MQ5_1_DEBUG == STD_ON
+#if MQ5_1_DEBUG == STD_ON && LOG_LEVEL_GLOBAL >= LOG_LEVEL_DEBUG
 #define DEBUG_PRINTLN(var) Serial.println(var)
 #define DEBUG_PRINT(var) Serial.print(var)
 #else
@@ -20,23 +21,22 @@ MFRC522 mfrc522(RFID_SS_PIN, RFID_RST_PIN);
 
 
 
-static String uid_to_string(byte *buffer, byte bufferSize)
+// Format UID bytes as "AA:BB:CC:..." directly into a caller buffer.
+// No heap allocation - this runs on every card scan.
+static void uid_to_cstr(char *out, size_t outSize, const byte *buffer, byte bufferSize)
 {
 #if  RFID_ENABLED == STD_ON
-    String result = "";
-    
-    for (byte i = 0; i < bufferSize; i++) {
-        if (buffer[i] < 0x10) {
-            result += "0";
-        }
-        result += String(buffer[i], HEX);
-        if (i < bufferSize - 1) {
-            result += ":";  // Use colon separator for readability
-        }
+    size_t len = 0;
+
+    if (out == NULL || outSize == 0) {
+        return;
+    }
+    out[0] = '\0';
+
+    for (byte i = 0; i < bufferSize && len + 3 < outSize; i++) {
+        len += snprintf(out + len, outSize - len,
+                        (i < bufferSize - 1) ? "%02X:" : "%02X", buffer[i]);
     }
-    
-    result.toUpperCase();
-    return result;
     #endif
 }
 
@@ -45,15 +45,161 @@ static bool compare_uid(byte *uid1, byte size1, byte *uid2, byte size2)
 {
     #if  RFID_ENABLED == STD_ON
     if (size1 != size2) return false;
-    
+
     for (byte i = 0; i < size1; i++) {
         if (uid1[i] != uid2[i]) return false;
     }
-    
+
     return true;
     #endif
 }
 
+/* ==================== Authorized-Card Table ==================== */
+// Fixed sorted array of binary UIDs, binary searched on every tap so
+// door-open latency stays flat as the front desk grows the list.
+
+static RFID_AuthUID_t g_authTable[RFID_AUTH_MAX];
+static uint16_t g_authCount = 0;
+
+// Factory defaults loaded at init until the front desk pushes a list
+static const RFID_AuthUID_t g_defaultAuth[] = {
+    { {0x04, 0x86, 0x46, 0x52, 0x71, 0x40, 0x80}, 7 },  // Card 1
+    { {0x59, 0x52, 0x67, 0xD9},                   4 },  // Card 2
+};
+
+// Total order: size first, then lexicographic bytes
+static int auth_uid_cmp(const byte *uid1, byte size1, const byte *uid2, byte size2)
+{
+    if (size1 != size2) {
+        return (int)size1 - (int)size2;
+    }
+    return memcmp(uid1, uid2, size1);
+}
+
+// Binary search for a UID; returns index or -1
+static int auth_find(const byte *uid, byte size)
+{
+    int lo = 0;
+    int hi = (int)g_authCount - 1;
+
+    while (lo <= hi) {
+        int mid = (lo + hi) / 2;
+        int cmp = auth_uid_cmp(uid, size, g_authTable[mid].uid, g_authTable[mid].size);
+
+        if (cmp == 0) return mid;
+        if (cmp < 0)  hi = mid - 1;
+        else          lo = mid + 1;
+    }
+
+    return -1;
+}
+
+// Parse "AA:BB:CC" (or "AABBCC") into raw bytes; returns byte count or 0
+static byte auth_parse_uid(const char *uidStr, byte *out)
+{
+    byte count = 0;
+
+    while (*uidStr != '\0' && count < RFID_UID_MAX_BYTES) {
+        if (*uidStr == ':') {
+            uidStr++;
+            continue;
+        }
+
+        char hex[3] = { uidStr[0], uidStr[1], '\0' };
+        if (!isxdigit((int)hex[0]) || !isxdigit((int)hex[1])) {
+            return 0;  // Malformed
+        }
+
+        out[count++] = (byte)strtoul(hex, NULL, 16);
+        uidStr += 2;
+    }
+
+    return count;
+}
+
+void RFID_Auth_Clear(void)
+{
+    g_authCount = 0;
+}
+
+bool RFID_Auth_Add(const byte *uid, byte size)
+{
+    if (uid == NULL || size == 0 || size > RFID_UID_MAX_BYTES ||
+        g_authCount >= RFID_AUTH_MAX) {
+        return false;
+    }
+
+    if (auth_find(uid, size) >= 0) {
+        return true;  // Already present
+    }
+
+    // Sorted insert (rare, front-desk provisioning only - lookup is the hot path)
+    int pos = g_authCount;
+    while (pos > 0 && auth_uid_cmp(g_authTable[pos - 1].uid, g_authTable[pos - 1].size,
+                                   uid, size) > 0) {
+        g_authTable[pos] = g_authTable[pos - 1];
+        pos--;
+    }
+
+    memcpy(g_authTable[pos].uid, uid, size);
+    g_authTable[pos].size = size;
+    g_authCount++;
+
+    return true;
+}
+
+bool RFID_Auth_AddFromString(const char *uidStr)
+{
+    byte raw[RFID_UID_MAX_BYTES];
+    byte size = auth_parse_uid(uidStr, raw);
+
+    if (size == 0) {
+        Serial.printf("[RFID] Bad UID in card list: %s\n", uidStr);
+        return false;
+    }
+
+    return RFID_Auth_Add(raw, size);
+}
+
+uint16_t RFID_Auth_Count(void)
+{
+    return g_authCount;
+}
+
+/**
+ * @brief Replace the authorized-card list from a comma-separated UID string
+ * @param uidList e.g. "04:86:46:52:71:40:80,59:52:67:D9"
+ * @return Number of cards loaded
+ *
+ * @note Called from the MQTT access/load handler so the front desk can
+ *       push card lists without reflashing the door controller
+ */
+uint16_t RFID_Auth_BulkLoad(const char *uidList)
+{
+    char entry[RFID_UID_STR_LEN];
+    size_t len = 0;
+
+    RFID_Auth_Clear();
+
+    while (uidList != NULL && *uidList != '\0') {
+        len = 0;
+        while (*uidList != '\0' && *uidList != ',' && len < sizeof(entry) - 1) {
+            entry[len++] = *uidList++;
+        }
+        entry[len] = '\0';
+
+        if (len > 0) {
+            RFID_Auth_AddFromString(entry);
+        }
+        if (*uidList == ',') {
+            uidList++;
+        }
+    }
+
+    Serial.printf("[RFID] Card list loaded: %u cards\n", g_authCount);
+    return g_authCount;
+}
+
 /* ==================== Public Functions ==================== */
 
 /*
@@ -128,10 +274,16 @@ bool RFID_INIT(void)
         return false;
     }
     
+    // Load factory-default cards until the front desk pushes a list
+    for (size_t i = 0; i < sizeof(g_defaultAuth) / sizeof(g_defaultAuth[0]); i++) {
+        RFID_Auth_Add(g_defaultAuth[i].uid, g_defaultAuth[i].size);
+    }
+
     Serial.println("[RFID] Initialized successfully");
     Serial.printf("[RFID] Firmware version: 0x%02X\n", version);
+    Serial.printf("[RFID] Authorized cards: %u\n", RFID_Auth_Count());
     Serial.println("[RFID] Ready to scan cards...");
-    
+
     return true;
     #endif
 }
@@ -144,6 +296,81 @@ bool RFID_IsNewCardPresent(void)
     #endif
 }
 
+/* ==================== Interrupt-Driven Detection ==================== */
+// The MFRC522 IRQ pin is wired to RFID_IRQ_PIN. We enable the receiver
+// interrupt (RxIRq) and park the reader in a transceive waiting for a
+// REQA response; a card tap pulls IRQ low and the ISR wakes the RFID
+// task with a direct-to-task notification - no polling, sub-10 ms
+// reaction instead of the old 200 ms poll interval.
+
+static TaskHandle_t g_rfidNotifyTask = NULL;
+
+static void IRAM_ATTR rfid_isr(void)
+{
+    BaseType_t higherPrioWoken = pdFALSE;
+
+    if (g_rfidNotifyTask != NULL) {
+        vTaskNotifyGiveFromISR(g_rfidNotifyTask, &higherPrioWoken);
+    }
+
+    portYIELD_FROM_ISR(higherPrioWoken);
+}
+
+bool RFID_EnableIRQMode(TaskHandle_t taskToNotify)
+{
+    #if  RFID_ENABLED == STD_ON
+    if (taskToNotify == NULL) {
+        return false;
+    }
+
+    g_rfidNotifyTask = taskToNotify;
+
+    int irq = digitalPinToInterrupt(RFID_IRQ_PIN);
+    if (irq < 0) {
+        Serial.println("[ERROR] RFID IRQ pin has no interrupt - polling fallback");
+        g_rfidNotifyTask = NULL;
+        return false;
+    }
+
+    pinMode(RFID_IRQ_PIN, INPUT_PULLUP);
+
+    // Enable the RxIRq propagation to the IRQ pin (active low), and
+    // read it back: a reader that is absent or wedged on the SPI bus
+    // would leave the IRQ line dead, so the caller must keep polling
+    mfrc522.PCD_WriteRegister(mfrc522.ComIEnReg, 0xA0);
+    if (mfrc522.PCD_ReadRegister(mfrc522.ComIEnReg) != 0xA0) {
+        Serial.println("[ERROR] RFID IRQ config readback failed - polling fallback");
+        g_rfidNotifyTask = NULL;
+        return false;
+    }
+
+    attachInterrupt(irq, rfid_isr, FALLING);
+
+    Serial.println("[RFID] IRQ mode enabled");
+    return true;
+    #else
+    return false;
+    #endif
+}
+
+void RFID_ArmIRQ(void)
+{
+    #if  RFID_ENABLED == STD_ON
+    // Park the reader waiting for a card: send REQA and leave the
+    // receiver running so RxIRq fires on the first tag response
+    mfrc522.PCD_WriteRegister(mfrc522.FIFODataReg, mfrc522.PICC_CMD_REQA);
+    mfrc522.PCD_WriteRegister(mfrc522.CommandReg, mfrc522.PCD_Transceive);
+    mfrc522.PCD_WriteRegister(mfrc522.BitFramingReg, 0x87);  // StartSend, 7-bit frame
+    #endif
+}
+
+void RFID_ClearIRQ(void)
+{
+    #if  RFID_ENABLED == STD_ON
+    mfrc522.PCD_WriteRegister(mfrc522.ComIrqReg, 0x7F);
+    #endif
+}
+
 
 void RFID_DiagnosticScan(void)
 {
@@ -168,60 +395,51 @@ void RFID_DiagnosticScan(void)
 }
 
 
-bool RFID_ReadCard(String *uid, byte *rawUID, byte *size)
+bool RFID_ReadCard(char *uid, size_t uidSize, byte *rawUID, byte *size)
 {
     #if  RFID_ENABLED == STD_ON
     if (!mfrc522.PICC_ReadCardSerial()) {
         return false;
     }
-    
+
     // Store UID
     lastUIDSize = mfrc522.uid.size;
     memcpy(lastUID, mfrc522.uid.uidByte, lastUIDSize);
-    
-    // Convert to string
-    *uid = uid_to_string(mfrc522.uid.uidByte, mfrc522.uid.size);
-    
+
+    // Format straight into caller's buffer - no allocations on the scan path
+    uid_to_cstr(uid, uidSize, mfrc522.uid.uidByte, mfrc522.uid.size);
+
     // Optional: Return raw UID bytes
     if (rawUID != nullptr && size != nullptr) {
         memcpy(rawUID, mfrc522.uid.uidByte, mfrc522.uid.size);
         *size = mfrc522.uid.size;
     }
-    
+
     // Get card type
     MFRC522::PICC_Type piccType = mfrc522.PICC_GetType(mfrc522.uid.sak);
-    String cardType = mfrc522.PICC_GetTypeName(piccType);
-    
-    Serial.printf("[RFID] Card detected - UID: %s, Type: %s\n", 
-                  uid->c_str(), cardType.c_str());
-    
+
+    Serial.printf("[RFID] Card detected - UID: %s, Type: %s\n",
+                  uid, mfrc522.PICC_GetTypeName(piccType));
+
     // Halt PICC
     mfrc522.PICC_HaltA();
-    
+
     return true;
     #endif
 }
 
-bool RFID_CheckAuthorization(const String &uid)
+bool RFID_CheckAuthorization(const char *uid)
 {
     #if  RFID_ENABLED == STD_ON
-    // Authorized UIDs list
-    const char *authorizedUIDs[] = {
-        "04:86:46:52:71:40:80",  // Card 1
-        "59:52:67:D9",            // Card 2
-        // Add more authorized UIDs here
-    };
-    
-    const int numAuthorized = sizeof(authorizedUIDs) / sizeof(authorizedUIDs[0]);
-    
-    for (int i = 0; i < numAuthorized; i++) {
-        if (uid == String(authorizedUIDs[i])) {
-            Serial.printf("[RFID] Access GRANTED for UID: %s\n", uid.c_str());
-            return true;
-        }
+    byte raw[RFID_UID_MAX_BYTES];
+    byte size = auth_parse_uid(uid, raw);
+
+    if (size > 0 && auth_find(raw, size) >= 0) {
+        Serial.printf("[RFID] Access GRANTED for UID: %s\n", uid);
+        return true;
     }
-    
-    Serial.printf("[RFID] Access DENIED for UID: %s\n", uid.c_str());
+
+    Serial.printf("[RFID] Access DENIED for UID: %s\n", uid);
     return false;
     #endif
 }
@@ -229,27 +447,15 @@ bool RFID_CheckAuthorization(const String &uid)
 bool RFID_CheckAuthorizationRaw(byte *uid, byte size)
 {
     #if  RFID_ENABLED == STD_ON
-    // Authorized UIDs (byte arrays)
-    const byte authorizedUID1[] = {0x04, 0x86, 0x46, 0x52, 0x71, 0x40, 0x80};
-    const byte authorizedUID2[] = {0x59, 0x52, 0x67, 0xD9};
-    
-    if (compare_uid(uid, size, (byte*)authorizedUID1, sizeof(authorizedUID1))) {
-        return true;
-    }
-    
-    if (compare_uid(uid, size, (byte*)authorizedUID2, sizeof(authorizedUID2))) {
-        return true;
-    }
-    
-    return false;
+    return auth_find(uid, size) >= 0;
     #endif
 }
 
 
-String RFID_GetLastUID(void)
+void RFID_GetLastUID(char *out, size_t outSize)
 {
     #if  RFID_ENABLED == STD_ON
-    return uid_to_string(lastUID, lastUIDSize);
+    uid_to_cstr(out, outSize, lastUID, lastUIDSize);
     #endif
 }
 
@@ -287,10 +493,13 @@ bool RFID_SelfTest(void)
 void RFID_GetStatus(void)
 {
     #if  RFID_ENABLED == STD_ON
+    char lastUidStr[RFID_UID_STR_LEN];
+    RFID_GetLastUID(lastUidStr, sizeof(lastUidStr));
+
     Serial.println("\n[RFID] Reader Status:");
-    Serial.printf("  Version: 0x%02X\n", 
+    Serial.printf("  Version: 0x%02X\n",
                   mfrc522.PCD_ReadRegister(mfrc522.VersionReg));
-    Serial.printf("  Last UID: %s\n", RFID_GetLastUID().c_str());
+    Serial.printf("  Last UID: %s\n", lastUidStr);
     #endif    
 }
 
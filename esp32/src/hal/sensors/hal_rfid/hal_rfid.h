@@ -4,6 +4,24 @@
 
 #define RFID_SS_PIN 21
 #define RFID_RST_PIN 22
+// GPIO 27 drives LED_HIGH_SPEED in the combined image - keep the IRQ
+// line on a pin the thermostat side does not touch
+#define RFID_IRQ_PIN 4
+
+// Formatted UID buffer size ("XX:" per byte, up to 10 bytes)
+#define RFID_UID_STR_LEN 32
+
+// Max raw UID length (MIFARE supports 4/7/10 byte UIDs)
+#define RFID_UID_MAX_BYTES 10
+
+// Authorized card list capacity (~100 staff/guest cards per door)
+#define RFID_AUTH_MAX 128
+
+// Binary authorized-card entry
+typedef struct {
+    byte uid[RFID_UID_MAX_BYTES];
+    byte size;
+} RFID_AuthUID_t;
 
 // function declarations
 bool RFID_INIT(void);
@@ -11,11 +29,23 @@ bool RFID_INIT(void);
 bool RFID_IsNewCardPresent(void);
 
 void RFID_DiagnosticScan(void);
-bool RFID_ReadCard(String *uid, byte *rawUID = nullptr, byte *size = nullptr);
+bool RFID_ReadCard(char *uid, size_t uidSize, byte *rawUID = nullptr, byte *size = nullptr);
 
-bool RFID_CheckAuthorization(const String &uid);
+bool RFID_CheckAuthorization(const char *uid);
 bool RFID_CheckAuthorizationRaw(byte *uid, byte size);
-String RFID_GetLastUID(void);
+void RFID_GetLastUID(char *out, size_t outSize);
+
+// Interrupt-driven card detection (replaces 200 ms polling)
+bool RFID_EnableIRQMode(TaskHandle_t taskToNotify);
+void RFID_ArmIRQ(void);
+void RFID_ClearIRQ(void);
+
+// Authorized-card list management (sorted array, binary searched)
+void RFID_Auth_Clear(void);
+bool RFID_Auth_Add(const byte *uid, byte size);
+bool RFID_Auth_AddFromString(const char *uidStr);
+uint16_t RFID_Auth_Count(void);
+uint16_t RFID_Auth_BulkLoad(const char *uidList);
 void RFID_Reset(void);
 bool RFID_SelfTest(void);
 void RFID_GetStatus(void);
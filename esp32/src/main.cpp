@@ -5,38 +5,110 @@
 
 #include "app/thermostat/thermostat_rtos.h"
 #include "app/room/room_rtos.h"
+#include "app/common/log_ring.h"
+#include "app/common/blackbox.h"
+#include "app/common/app_config.h"
+#include "app/common/scheduler.h"
+#include "app/common/power_mgr.h"
+#include "app/common/boot_bench.h"
 
 #include "app_cfg.h"
 
 
 
-void setup() 
+/*
+ * Bring-up is a dependency graph, not a sequence of delays:
+ *
+ *   Serial/logging ─┬─> local inits (topics, config, thermostat, room)
+ *                   └─> WIFI_Init_ (association runs in the radio)
+ *                              └─> Task_Wifi observes the link and gives
+ *                                  wifiConnectedSem -> Task_Mqtt starts
+ *
+ * Everything above the semaphore is hardware-only and starts sampling
+ * immediately; nothing below it runs until the link is really up, so
+ * there is no fixed delay anywhere on the boot path. After a building
+ * power event the fleet reconnects as fast as the APs can take them.
+ */
+void setup()
 {
     Serial.begin(9600);
-    delay(1000);
-    
+
     Serial.println("\n=== Smart Room System ===");
-    Serial.println("Initializing...");  
+    Serial.println("Initializing...");
+
+#if LOG_RING_ENABLED == STD_ON
+    LogRing_Init();
+#endif
+
+#if BLACKBOX_ENABLED == STD_ON
+    // Validate the RTC event ring and capture the reset reason before
+    // any task starts writing new breadcrumbs
+    Blackbox_Init();
+#endif
+
+#if TOPIC_FROM_NVS == STD_ON
+    // Single-image fleet: build the topic set from the NVS room id
+    Topics_Init();
+#endif
+
+#if CONFIG_CACHE_ENABLED == STD_ON
+    // One NVS read; everything after this reads plain struct fields
+    Config_Init();
+#endif
 
     // Configure WiFi
     WIFI_Config_t g_wifiCfg_cpy = {
+#if CONFIG_CACHE_ENABLED == STD_ON
+        .ssid = Config_Get()->wifi_ssid,
+        .password = Config_Get()->wifi_password,
+#else
         .ssid = WIFI_SSID,
         .password = WIFI_PASSWORD,
+#endif
         .reconnect_interval_ms = 5000,
         .on_connect = onWifiConnected,
-        .on_disconnect = onWifiDisconnected
+        .on_disconnect = onWifiDisconnected,
+        .fast_reconnect = (WIFI_FAST_RECONNECT == STD_ON),
+#if WIFI_STATIC_IP_ENABLED == STD_ON
+        .static_ip = WIFI_STATIC_IP,
+        .static_gateway = WIFI_STATIC_GATEWAY,
+        .static_subnet = WIFI_STATIC_SUBNET
+#else
+        .static_ip = NULL,
+        .static_gateway = NULL,
+        .static_subnet = NULL
+#endif
     };
 
-    // Initialize WiFi
+    // Start WiFi association first - it proceeds in the radio while the
+    // local subsystems below come up, and the network-dependent stage
+    // (Task_Mqtt) gates on wifiConnectedSem rather than a fixed wait
     WIFI_Init_(&g_wifiCfg_cpy);
-    
+
     Serial.println("WiFi initialization started");
-    
-    delay(2000);
-    
+
+#if POWER_MGR_ENABLED == STD_ON
+    // DFS + automatic light sleep + WiFi modem-sleep; after the radio
+    // exists so the power-save mode sticks
+    PowerMgr_Init();
+#endif
+
+#if BOOT_BENCH_ENABLED == STD_ON
+    // Hot-path micro-benchmark while the CPU is still quiet - the
+    // report publishes from Task_Mqtt once the broker is up
+    BootBench_Run();
+#endif
+
+    // Hardware-only inits - no network dependency, tasks start sampling
+    // as soon as they are created
     InitThermostat();
     Room_RTOS_Init();
 
+#if SCHEDULER_ENABLED == STD_ON
+    // All modules have registered their jobs - start the executor
+    Scheduler_Start();
+#endif
+
     Serial.println("System ready!");
     vTaskDelete(NULL); //remove void loop() 
 
@@ -0,0 +1,55 @@
+#include <Arduino.h>
+#include <stdio.h>
+#include "app_cfg.h"
+
+#if TOPIC_FROM_NVS == STD_ON
+
+#include <Preferences.h>
+
+// Buffer definitions for every topic in the table
+#define TOPIC_DEFINE(name, kind, suffix) char name[TOPIC_MAX_LEN];
+TOPIC_TABLE(TOPIC_DEFINE)
+#undef TOPIC_DEFINE
+
+typedef enum {
+    TOPIC_KIND_BASE,  // hotel/<id>/...
+    TOPIC_KIND_ROOM   // hotel/room<id>/...
+} TopicKind_t;
+
+static const struct {
+    char* buf;
+    TopicKind_t kind;
+    const char* suffix;
+} g_topicTable[] = {
+#define TOPIC_ENTRY(name, kind, suffix) { name, TOPIC_KIND_##kind, suffix },
+TOPIC_TABLE(TOPIC_ENTRY)
+#undef TOPIC_ENTRY
+};
+
+#define TOPIC_COUNT (sizeof(g_topicTable) / sizeof(g_topicTable[0]))
+
+void Topics_Init(void)
+{
+    char room_id[8];
+
+    Preferences prefs;
+    prefs.begin("device", true);
+    size_t len = prefs.getString("room_id", room_id, sizeof(room_id));
+    prefs.end();
+
+    if (len == 0) {
+        strlcpy(room_id, ROOM_ID_STR, sizeof(room_id));
+    }
+
+    for (size_t i = 0; i < TOPIC_COUNT; i++) {
+        snprintf(g_topicTable[i].buf, TOPIC_MAX_LEN,
+                 (g_topicTable[i].kind == TOPIC_KIND_ROOM)
+                     ? "hotel/room%s/%s" : "hotel/%s/%s",
+                 room_id, g_topicTable[i].suffix);
+    }
+
+    Serial.printf("[TOPICS] Built %u topics for room %s\n",
+                  (unsigned)TOPIC_COUNT, room_id);
+}
+
+#endif /* TOPIC_FROM_NVS */
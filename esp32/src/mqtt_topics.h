@@ -0,0 +1,115 @@
+#ifndef MQTT_TOPICS_H
+#define MQTT_TOPICS_H
+
+/*
+ * Topic builder - included at the end of app_cfg.h.
+ *
+ * Every topic is assembled from ROOM_ID_STR by string-literal
+ * concatenation at build time: zero runtime formatting, zero heap.
+ * Provisioning a room is one build flag (-DROOM_ID_STR='"204"')
+ * instead of editing every literal.
+ *
+ * For single-image fleets set TOPIC_FROM_NVS to STD_ON: the room
+ * identifier is loaded from NVS once at boot (Topics_Init, called from
+ * setup()) and each topic is formatted once into a fixed static buffer.
+ * In both modes topic construction stays off the publish hot path -
+ * publishers only ever see finished strings.
+ */
+
+#ifndef ROOM_ID_STR
+#define ROOM_ID_STR     "101"
+#endif
+
+#define TOPIC_FROM_NVS  STD_OFF
+#define TOPIC_MAX_LEN   48
+
+/* Topic set: name, prefix kind, suffix.
+ * BASE = "hotel/<id>/...", ROOM = "hotel/room<id>/..." (control-plane
+ * namespace the front desk publishes into).
+ * The literal #defines below must stay in sync with this table. */
+#define TOPIC_TABLE(X)                                          \
+    X(ROOM_TOPIC_LED1_CTRL,    ROOM, "led1/control")            \
+    X(ROOM_TOPIC_LED2_CTRL,    ROOM, "led2/control")            \
+    X(ROOM_TOPIC_MODE_CTRL,    ROOM, "mode/control")            \
+    X(ROOM_TOPIC_AUTO_DIM,     ROOM, "auto_dim/control")        \
+    X(ROOM_TOPIC_AUTH_LOAD,    ROOM, "access/load")             \
+    X(ROOM_TOPIC_CONFIG_SET,   ROOM, "config/set")              \
+    X(ROOM_TOPIC_LED1_STATUS,  BASE, "status/led1")             \
+    X(ROOM_TOPIC_LED2_STATUS,  BASE, "status/led2")             \
+    X(ROOM_TOPIC_MODE_STATUS,  BASE, "status/mode")             \
+    X(ROOM_TOPIC_STATUS_DOC,   BASE, "status/json")             \
+    X(ROOM_TOPIC_LDR_RAW,      BASE, "telemetry/ldr_raw")       \
+    X(ROOM_TOPIC_LDR_PERCENT,  BASE, "telemetry/ldr_percent")   \
+    X(MQTT_TOPIC_TELEMETRY,    BASE, "telemetry/json")          \
+    X(MQTT_TOPIC_TELEMETRY_BIN,BASE, "telemetry/bin")           \
+    X(MQTT_TOPIC_BACKFILL,     BASE, "telemetry/backfill")      \
+    X(MQTT_TOPIC_TEMP,         BASE, "telemetry/temperature")   \
+    X(MQTT_TOPIC_HUMIDITY,     BASE, "telemetry/humidity")      \
+    X(MQTT_TOPIC_LUMINOSITY,   BASE, "telemetry/luminosity")    \
+    X(MQTT_TOPIC_GAS,          BASE, "telemetry/gas")           \
+    X(MQTT_TOPIC_HEATING,      BASE, "telemetry/heating")       \
+    X(MQTT_TOPIC_AGGREGATE,    BASE, "telemetry/aggregate")     \
+    X(MQTT_TOPIC_TARGET,       BASE, "control/target_temp")     \
+    X(MQTT_TOPIC_CONTROL,      BASE, "control/mode")            \
+    X(MQTT_TOPIC_SET_SPEED,    BASE, "control/fan_speed")       \
+    X(MQTT_TOPIC_DIAG_TASKS,   BASE, "diag/tasks")              \
+    X(MQTT_TOPIC_DIAG_HEAP,    BASE, "diag/heap")               \
+    X(MQTT_TOPIC_DIAG_BOOT,    BASE, "diag/boot")               \
+    X(MQTT_TOPIC_DIAG_BENCH,   BASE, "diag/bench")              \
+    X(MQTT_TOPIC_PRESENCE,     BASE, "status/presence")
+
+#if TOPIC_FROM_NVS == STD_OFF
+
+/* Compile-time form: every topic is a string literal */
+#define HOTEL_TOPIC(suffix)       "hotel/" ROOM_ID_STR "/" suffix
+#define HOTEL_ROOM_TOPIC(suffix)  "hotel/room" ROOM_ID_STR "/" suffix
+
+#define ROOM_TOPIC_LED1_CTRL    HOTEL_ROOM_TOPIC("led1/control")
+#define ROOM_TOPIC_LED2_CTRL    HOTEL_ROOM_TOPIC("led2/control")
+#define ROOM_TOPIC_MODE_CTRL    HOTEL_ROOM_TOPIC("mode/control")
+#define ROOM_TOPIC_AUTO_DIM     HOTEL_ROOM_TOPIC("auto_dim/control")
+#define ROOM_TOPIC_AUTH_LOAD    HOTEL_ROOM_TOPIC("access/load")
+#define ROOM_TOPIC_CONFIG_SET   HOTEL_ROOM_TOPIC("config/set")
+#define ROOM_TOPIC_LED1_STATUS  HOTEL_TOPIC("status/led1")
+#define ROOM_TOPIC_LED2_STATUS  HOTEL_TOPIC("status/led2")
+#define ROOM_TOPIC_MODE_STATUS  HOTEL_TOPIC("status/mode")
+#define ROOM_TOPIC_STATUS_DOC   HOTEL_TOPIC("status/json")
+#define ROOM_TOPIC_LDR_RAW      HOTEL_TOPIC("telemetry/ldr_raw")
+#define ROOM_TOPIC_LDR_PERCENT  HOTEL_TOPIC("telemetry/ldr_percent")
+#define MQTT_TOPIC_TELEMETRY    HOTEL_TOPIC("telemetry/json")
+#define MQTT_TOPIC_TELEMETRY_BIN HOTEL_TOPIC("telemetry/bin")
+#define MQTT_TOPIC_BACKFILL     HOTEL_TOPIC("telemetry/backfill")
+#define MQTT_TOPIC_TEMP         HOTEL_TOPIC("telemetry/temperature")
+#define MQTT_TOPIC_HUMIDITY     HOTEL_TOPIC("telemetry/humidity")
+#define MQTT_TOPIC_LUMINOSITY   HOTEL_TOPIC("telemetry/luminosity")
+#define MQTT_TOPIC_GAS          HOTEL_TOPIC("telemetry/gas")
+#define MQTT_TOPIC_HEATING      HOTEL_TOPIC("telemetry/heating")
+#define MQTT_TOPIC_AGGREGATE    HOTEL_TOPIC("telemetry/aggregate")
+#define MQTT_TOPIC_TARGET       HOTEL_TOPIC("control/target_temp")
+#define MQTT_TOPIC_CONTROL      HOTEL_TOPIC("control/mode")
+#define MQTT_TOPIC_SET_SPEED    HOTEL_TOPIC("control/fan_speed")
+#define MQTT_TOPIC_DIAG_TASKS   HOTEL_TOPIC("diag/tasks")
+#define MQTT_TOPIC_DIAG_HEAP    HOTEL_TOPIC("diag/heap")
+#define MQTT_TOPIC_DIAG_BOOT    HOTEL_TOPIC("diag/boot")
+#define MQTT_TOPIC_DIAG_BENCH   HOTEL_TOPIC("diag/bench")
+#define MQTT_TOPIC_PRESENCE     HOTEL_TOPIC("status/presence")
+
+#else /* TOPIC_FROM_NVS == STD_ON */
+
+/* Runtime form: fixed buffers, filled once by Topics_Init(). Array
+ * names keep their addresses constant, so static initializers (the
+ * MQTT dispatch table) stay valid. */
+#define TOPIC_DECLARE(name, kind, suffix) extern char name[TOPIC_MAX_LEN];
+TOPIC_TABLE(TOPIC_DECLARE)
+#undef TOPIC_DECLARE
+
+/**
+ * @brief Load the room id from NVS ("device"/"room_id", default
+ *        ROOM_ID_STR) and format every topic buffer once
+ * @note Call from setup() before any MQTT use
+ */
+void Topics_Init(void);
+
+#endif /* TOPIC_FROM_NVS */
+
+#endif /* MQTT_TOPICS_H */